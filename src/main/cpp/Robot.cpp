@@ -8,20 +8,31 @@
 #include <string>
 
 #include <cameraserver/CameraServer.h>
+#include <frc/RobotController.h>
+#include <networktables/NetworkTableInstance.h>
 
 #include <auton/CyclePrimitives.h>
 #include <chassis/ChassisFactory.h>
 #include <chassis/IChassis.h>
 #include <chassis/swerve/SwerveDrive.h>
 #include <TeleopControl.h>
+#include <hw/CanFramePlanner.h>
+#include <hw/CurrentGovernor.h>
 #include <hw/DragonLimelight.h>
+#include <hw/factories/DragonMotorControllerFactory.h>
 #include <hw/factories/LimelightFactory.h>
+#include <hw/MotorOutputCache.h>
+#include <hw/PowerMonitor.h>
 #include <mechanisms/climber/ClimberStateMgr.h>
 #include <mechanisms/indexer/IndexerStateMgr.h>
 #include <mechanisms/Intake/LeftIntakeStateMgr.h>
 #include <mechanisms/Intake/RightIntakeStateMgr.h>
 #include <mechanisms/shooter/ShooterStateMgr.h>
+#include <mechanisms/StateMgrScheduler.h>
 #include <utils/Logger.h>
+#include <utils/LoopProfiler.h>
+#include <utils/LoopWatchdog.h>
+#include <utils/TelemetryRecorder.h>
 #include <RobotXmlParser.h>
 
 using namespace std;
@@ -31,12 +42,39 @@ void Robot::RobotInit()
     Logger::GetLogger()->PutLoggingSelectionsOnDashboard();
     Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("ArrivedAt"), string("RobotInit"), string("arrived"));   
 
+    // time (ms) for each part of RobotInit goes to the "RobotInit" network table and the log
+    auto initStart = frc::RobotController::GetFPGATime();
+    auto stageStart = initStart;
+    auto initTable = nt::NetworkTableInstance::GetDefault().GetTable("RobotInit");
+    auto endStage = [&stageStart, &initTable] (const string& stage, uint64_t start)
+    {
+        auto now = frc::RobotController::GetFPGATime();
+        auto ms = static_cast<double>(now - start) / 1000.0;
+        initTable->PutNumber(stage + " (ms)", ms);
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("RobotInit"), stage + " (ms)", ms);
+        stageStart = now;
+    };
+
+    auto profiler = LoopProfiler::GetInstance();
+    m_robotPeriodicZone = profiler->RegisterZone("Robot::RobotPeriodic");
+    m_teleopPeriodicZone = profiler->RegisterZone("Robot::TeleopPeriodic");
+    m_loggerZone = profiler->RegisterZone("Logger::PeriodicLog");
+    m_visionZone = profiler->RegisterZone("Robot::Vision");
+
+    // loop budgets (ms); each StateMgr sets its own when it is initialized
+    auto watchdog = LoopWatchdog::GetInstance();
+    watchdog->SetBudget(profiler->RegisterZone("SwerveChassis::Drive"), 4.0);
+    watchdog->SetBudget(profiler->RegisterZone("SwerveChassis::UpdateOdometry"), 2.0);
+    watchdog->SetBudget(m_loggerZone, 1.0);
+    watchdog->SetBudget(m_visionZone, 1.0);
+
     //CameraServer::SetSize(CameraServer::kSize320x240);
     //CameraServer::StartAutomaticCapture();
 
     // Read the XML file to build the robot 
     auto XmlParser = new RobotXmlParser();
     XmlParser->ParseXML();
+    endStage("ParseXML", stageStart);
 
     // Get local copies of the teleop controller and the chassis
     m_controller = TeleopControl::GetInstance();
@@ -44,15 +82,36 @@ void Robot::RobotInit()
     m_chassis = factory->GetIChassis();
     m_swerve = (m_chassis != nullptr) ? new SwerveDrive() : nullptr;
         
+    // creating the state managers registers them with the StateMgrScheduler
     m_leftIntakeStateMgr = LeftIntakeStateMgr::GetInstance();
     m_rightIntakeStateMgr = RightIntakeStateMgr::GetInstance();
     m_indexerStateMgr = IndexerStateMgr::GetInstance();
     m_liftStateMgr = LiftStateMgr::GetInstance();
     m_shooterStateMgr = ShooterStateMgr::GetInstance();
     m_climberStateMgr = ClimberStateMgr::GetInstance();
+    StateMgrScheduler::GetInstance()->SetWorkerThreads(1);    // the roboRIO has two cores; serial until switched on (dashboard)
     m_dragonLimeLight = LimelightFactory::GetLimelightFactory()->GetLimelight();
 
     m_cyclePrims = new CyclePrimitives();
+    endStage("state managers", stageStart);
+
+    // the mechanisms have added their settings (PID slots, ...), so each motor controller gets one ConfigAllSettings
+    DragonMotorControllerFactory::GetInstance()->ApplyConfigurations();
+    endStage("motor configuration", stageStart);
+
+    // every CTRE device is known, so the status frame periods can be planned against the bus budget
+    CanFramePlanner::GetInstance()->Start();
+
+    // everything that records telemetry has been created, so the signal list can be frozen
+    auto recorder = TelemetryRecorder::GetInstance();
+    if (m_dragonLimeLight != nullptr)
+    {
+        m_limelightTxSignal = recorder->RegisterSignal("DragonLimelight/tx");
+        m_limelightTySignal = recorder->RegisterSignal("DragonLimelight/ty");
+    }
+    recorder->Start();
+    endStage("total", initStart);
+
     Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("ArrivedAt"), string("RobotInit"), string("end"));}
 
 /**
@@ -65,16 +124,36 @@ void Robot::RobotInit()
  */
 void Robot::RobotPeriodic() 
 {
+    ProfileScope scope(m_robotPeriodicZone);
+    PowerMonitor::GetInstance()->Update();     // currents for the next loop's mechanisms
+    CurrentGovernor::GetInstance()->Update();
     if (m_chassis != nullptr)
     {
         m_chassis->UpdateOdometry();
     }
-    if (m_dragonLimeLight != nullptr)
-    {
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("horizontal angle "), m_dragonLimeLight->GetTargetHorizontalOffset().to<double>());
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("distance "), m_dragonLimeLight->EstimateTargetDistance().to<double>());
-    }
-    Logger::GetLogger()->PeriodicLog();
+    auto recorder = TelemetryRecorder::GetInstance();
+    auto watchdog = LoopWatchdog::GetInstance();
+    if (m_dragonLimeLight != nullptr && watchdog->ShouldRun(LoopWatchdog::SHED_LEVEL::VISION, LoopWatchdog::VISION_DIVISOR))
+    {
+        ProfileScope visionScope(m_visionZone);
+        auto tx = m_dragonLimeLight->GetTargetHorizontalOffset().to<double>();
+        recorder->Record(m_limelightTxSignal, tx);
+        recorder->Record(m_limelightTySignal, m_dragonLimeLight->GetTargetVerticalOffset().to<double>());
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "horizontal angle ", tx);
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "distance ", m_dragonLimeLight->EstimateTargetDistance().to<double>());
+        }
+    }
+    {
+        ProfileScope loggerScope(m_loggerZone);
+        Logger::GetLogger()->PeriodicLog();
+    }
+    recorder->EndCycle();
+    LoopProfiler::GetInstance()->PeriodicPublish();
+    MotorOutputCache::GetInstance()->PeriodicPublish();
+    CanFramePlanner::GetInstance()->PeriodicPublish();
+    watchdog->EndLoop();
 }
 
 /**
@@ -100,6 +179,7 @@ void Robot::AutonomousInit()
 
 void Robot::AutonomousPeriodic() 
 {
+    LoopWatchdog::GetInstance()->BeginLoop();
     if (m_cyclePrims != nullptr)
     {
         m_cyclePrims->Run();
@@ -113,74 +193,35 @@ void Robot::TeleopInit()
     {
         m_swerve->Init();
     }
-    if (m_leftIntakeStateMgr != nullptr)
-    {
-        m_leftIntakeStateMgr->RunCurrentState();
-    }
-    if (m_rightIntakeStateMgr != nullptr)
-    {
-        m_rightIntakeStateMgr->RunCurrentState();
-    }
     if (m_shooterStateMgr != nullptr)
     {
-        m_shooterStateMgr->SetCurrentState(ShooterStateMgr::SHOOTER_STATE::PREPARE_TO_SHOOT, true);
-    }
-    if (m_climberStateMgr != nullptr)
-    {
-        m_climberStateMgr->RunCurrentState();
-    }
-    if (m_indexerStateMgr != nullptr)
-    {
-        m_indexerStateMgr->RunCurrentState();
-    }
-    if (m_liftStateMgr != nullptr)
-    {
-        m_liftStateMgr->RunCurrentState();
+        m_shooterStateMgr->SetCurrentState(ShooterStateMgr::SHOOTER_STATE::PREPARE_TO_SHOOT, false);
     }
+    StateMgrScheduler::GetInstance()->RunAll();
     Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("ArrivedAt"), string("TeleopInit"), string("end"));
 }
 
 void Robot::TeleopPeriodic() 
 {
+    LoopWatchdog::GetInstance()->BeginLoop();
+    ProfileScope scope(m_teleopPeriodicZone);
     if (m_chassis != nullptr && m_controller != nullptr && m_swerve != nullptr)
     {
         m_swerve->Run();
     }
 
-    if (m_leftIntakeStateMgr != nullptr)
-    {
-        m_leftIntakeStateMgr->RunCurrentState();
-    }
-    if (m_rightIntakeStateMgr != nullptr)
-    {
-        m_rightIntakeStateMgr->RunCurrentState();
-    }
-    if (m_shooterStateMgr != nullptr)
-    {
-        m_shooterStateMgr->RunCurrentState();
-    }
-    if (m_climberStateMgr != nullptr)
-    {
-        m_climberStateMgr->RunCurrentState();
-    }
-    if (m_indexerStateMgr != nullptr)
-    {
-        m_indexerStateMgr->RunCurrentState();
-    }
-    if (m_liftStateMgr != nullptr)
-    {
-        m_liftStateMgr->RunCurrentState();
-    }
+    StateMgrScheduler::GetInstance()->Run();
 }
 
 void Robot::DisabledInit() 
 {
     Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("ArrivedAt"), string("DisabledInit"), string("arrived"));   
+    TelemetryRecorder::GetInstance()->Flush();  // get the end of the match onto the disk
 }
 
 void Robot::DisabledPeriodic() 
 {
-
+    LoopWatchdog::GetInstance()->BeginLoop();
 }
 
 void Robot::TestInit() 
@@ -190,7 +231,7 @@ void Robot::TestInit()
 
 void Robot::TestPeriodic() 
 {
-
+    LoopWatchdog::GetInstance()->BeginLoop();
 }
 
 #ifndef RUNNING_FRC_TESTS
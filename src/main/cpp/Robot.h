@@ -49,4 +49,10 @@ class Robot : public frc::TimedRobot
   ShooterStateMgr*      m_shooterStateMgr;
   ClimberStateMgr*      m_climberStateMgr;
   DragonLimelight*      m_dragonLimeLight;
+  int                   m_limelightTxSignal = -1;
+  int                   m_limelightTySignal = -1;
+  int                   m_robotPeriodicZone = -1;
+  int                   m_teleopPeriodicZone = -1;
+  int                   m_loggerZone = -1;
+  int                   m_visionZone = -1;
 };
@@ -22,6 +22,7 @@
 // Team 302 includes
 
 // Third Party Includes
+#include <mutex>
 #include <string>
 #include <frc/GenericHID.h>
 #include <gamepad/IDragonGamePad.h>
@@ -356,6 +357,7 @@ double TeleopControl::GetAxisValue
     TeleopControl::FUNCTION_IDENTIFIER  function    // <I> - function that whose axis will be read
 ) const
 {
+    lock_guard<mutex> lock(m_mutex);
     double value = 0.0;
 	int ctlIndex = m_controllerIndex[ function];
 	IDragonGamePad::AXIS_IDENTIFIER axis = m_axisIDs[ function ];
@@ -380,6 +382,7 @@ bool TeleopControl::IsButtonPressed
     TeleopControl::FUNCTION_IDENTIFIER  function    // <I> - function that whose button will be read
 ) const
 {
+    lock_guard<mutex> lock(m_mutex);
     bool isSelected = false;
 	int ctlIndex = m_controllerIndex[ function];
 	IDragonGamePad::BUTTON_IDENTIFIER btn = m_buttonIDs[ function ];
@@ -416,6 +419,7 @@ void TeleopControl::SetRumble
 	bool                                rightRumble     // <I> - rumble right
 ) const
 {
+	lock_guard<mutex> lock(m_mutex);
 	if (m_controller[ controller ] != nullptr)
 	{
 		m_controller[ controller ]->SetRumble(leftRumble, rightRumble);
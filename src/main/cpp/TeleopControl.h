@@ -19,6 +19,7 @@
 // C++ Includes
 #include <memory>
 #include <map>
+#include <mutex>
 
 
 // FRC includes
@@ -215,5 +216,6 @@ class TeleopControl
         int                                             m_numControllers;
 
         IDragonGamePad*			                        m_controller[frc::DriverStation::kJoystickPorts];
+        mutable std::mutex                              m_mutex;    // state managers can read the controllers from StateMgrScheduler workers (toggle buttons change when read)
 };
 
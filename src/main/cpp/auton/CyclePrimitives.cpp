@@ -31,14 +31,14 @@
 #include <auton/PrimitiveParser.h>
 #include <auton/drivePrimitives/IPrimitive.h>
 #include <mechanisms/MechanismFactory.h>
-#include <mechanisms/indexer/IndexerStateMgr.h>
 #include <mechanisms/intake/Intake.h>
 #include <mechanisms/intake/LeftIntakeStateMgr.h>
 #include <mechanisms/intake/RightIntakeStateMgr.h>
-#include <mechanisms/lift/LiftStateMgr.h>
 #include <mechanisms/shooter/Shooter.h>
 #include <mechanisms/shooter/ShooterStateMgr.h>
+#include <mechanisms/StateMgrScheduler.h>
 #include <utils/Logger.h>
+#include <utils/LoopProfiler.h>
 
 // Third Party Includes
 
@@ -54,7 +54,8 @@ CyclePrimitives::CyclePrimitives() : m_primParams(),
 									 m_autonSelector( new AutonSelector()) ,
 									 m_timer( make_unique<Timer>()),
 									 m_maxTime( 0.0 ),
-									 m_isDone( false )
+									 m_isDone( false ),
+									 m_profileZone( LoopProfiler::GetInstance()->RegisterZone("CyclePrimitives::Run") )
 {
 }
 
@@ -72,38 +73,11 @@ void CyclePrimitives::Init()
 
 void CyclePrimitives::Run()
 {
+	ProfileScope scope(m_profileZone);
 	if (m_currentPrim != nullptr)
 	{
 		m_currentPrim->Run();
-		
-		auto leftIntakeStateMgr = LeftIntakeStateMgr::GetInstance();
-		if (leftIntakeStateMgr != nullptr)
-		{
-			leftIntakeStateMgr->RunCurrentState();
-		}
-		auto rightIntakeStateMgr = RightIntakeStateMgr::GetInstance();
-		if (rightIntakeStateMgr != nullptr)
-		{
-			rightIntakeStateMgr->RunCurrentState();
-		}
-
-		auto shooterStateMgr = ShooterStateMgr::GetInstance();
-		if (shooterStateMgr != nullptr)
-		{
-			shooterStateMgr->RunCurrentState();
-		}
-
-		auto indexerStateMgr = IndexerStateMgr::GetInstance();
-		if (indexerStateMgr != nullptr)
-		{
-			indexerStateMgr->RunCurrentState();
-		}
-
-		auto liftStateMgr = LiftStateMgr::GetInstance();
-		if (liftStateMgr != nullptr)
-		{
-			liftStateMgr->RunCurrentState();
-		}
+		StateMgrScheduler::GetInstance()->Run();
 
 		if (m_currentPrim->IsDone())
 		{
@@ -154,18 +128,6 @@ void CyclePrimitives::GetNextPrim()
 			shooterStateMgr->SetCurrentState(currentPrimParam->GetShooterState(), true);
 		}
 
-		auto indexerStateMgr = IndexerStateMgr::GetInstance();
-		if (indexerStateMgr != nullptr)
-		{
-			indexerStateMgr->RunCurrentState();
-		}
-
-		auto liftStateMgr = LiftStateMgr::GetInstance();
-		if (liftStateMgr != nullptr)
-		{
-			liftStateMgr->RunCurrentState();
-		}
-
 
 		m_maxTime = currentPrimParam->GetTime();
 		m_timer->Reset();
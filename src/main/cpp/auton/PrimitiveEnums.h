@@ -38,6 +38,7 @@
              TURN_ANGLE_REL,
              DRIVE_PATH,
              RESET_POSITION,
+             STREAM_PATH,
              MAX_AUTON_PRIMITIVES
          };
 
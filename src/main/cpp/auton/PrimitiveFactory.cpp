@@ -28,6 +28,7 @@
 #include <auton/drivePrimitives/HoldPosition.h>
 #include <auton/drivePrimitives/IPrimitive.h>
 #include <auton/drivePrimitives/ResetPosition.h>
+#include <auton/drivePrimitives/StreamPath.h>
 #include <auton/drivePrimitives/TurnAngle.h>
 
 PrimitiveFactory* PrimitiveFactory::m_instance = nullptr;
@@ -50,7 +51,8 @@ PrimitiveFactory::PrimitiveFactory() :
 				m_driveToWall(nullptr),
 				m_driveLidarDistance( nullptr ),
 				m_resetPosition( nullptr ),
-				m_drivePath(nullptr)
+				m_drivePath(nullptr),
+				m_streamPath(nullptr)
 {
 }
 
@@ -135,6 +137,14 @@ IPrimitive* PrimitiveFactory::GetIPrimitive(PrimitiveParams* primitivePasser)
 			}
 			primitive = m_drivePath;
 			break;
+
+		case STREAM_PATH :
+			if (m_streamPath == nullptr)
+			{
+				m_streamPath = new StreamPath();
+			}
+			primitive = m_streamPath;
+			break;
 			
 		default:
 			break;	
@@ -53,5 +53,6 @@ private:
     IPrimitive* m_autoShoot;
     IPrimitive* m_resetPosition;
     IPrimitive* m_drivePath;
+    IPrimitive* m_streamPath;
 };
 
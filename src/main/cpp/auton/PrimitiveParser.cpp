@@ -59,6 +59,7 @@ PrimitiveParamsVector PrimitiveParser::ParseXML
     primStringToEnumMap["TURN_ANGLE_REL"] = TURN_ANGLE_REL;
     primStringToEnumMap["DRIVE_PATH"] = DRIVE_PATH;
     primStringToEnumMap["RESET_POSITION"] = RESET_POSITION;
+    primStringToEnumMap["STREAM_PATH"] = STREAM_PATH;
 
     map<string, IChassis::HEADING_OPTION> headingOptionMap;
     headingOptionMap["MAINTAIN"] = IChassis::HEADING_OPTION::MAINTAIN;
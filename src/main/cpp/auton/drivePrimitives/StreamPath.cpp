@@ -0,0 +1,103 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//C++ Includes
+#include <memory>
+#include <string>
+
+//FRC/WPI Includes
+#include <frc/Filesystem.h>
+#include <frc/trajectory/TrajectoryUtil.h>
+
+//Team 302 includes
+#include <auton/PrimitiveParams.h>
+#include <auton/drivePrimitives/StreamPath.h>
+#include <chassis/ChassisFactory.h>
+#include <chassis/swerve/SwerveChassis.h>
+#include <utils/Logger.h>
+
+using namespace std;
+using namespace frc;
+
+StreamPath::StreamPath() : m_chassis(ChassisFactory::GetChassisFactory()->GetSwerveChassis()),
+                           m_trajectory(),
+                           m_timer(),
+                           m_maxTime(-1.0),
+                           m_started(false),
+                           m_ntName("StreamPath")
+{
+}
+
+void StreamPath::Init(PrimitiveParams* params)
+{
+    m_ntName = string("StreamPath: ") + params->GetPathName();
+    m_maxTime = params->GetTime();
+    m_started = false;
+
+    if (m_chassis == nullptr || params->GetPathName().empty())
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, m_ntName, string("Init"), string("needs a swerve chassis and a path"));
+        return;
+    }
+
+    auto deployDir = frc::filesystem::GetDeployDirectory();
+    deployDir += "/paths/" + params->GetPathName();
+    m_trajectory = frc::TrajectoryUtil::FromPathweaverJson(deployDir);
+
+    m_started = m_chassis->StartTrajectoryStream(m_trajectory, params->GetHeadingOption());
+    m_timer.Reset();
+    m_timer.Start();
+
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_ntName, "Trajectory Time", m_trajectory.TotalTime().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_ntName, "Started", m_started ? "True" : "False");
+    }
+}
+
+void StreamPath::Run()
+{
+    // the Talons run the profile; the odometry still comes from the robot loop / odometry thread
+}
+
+bool StreamPath::IsDone()
+{
+    if (!m_started)
+    {
+        return true;
+    }
+
+    auto timedOut = m_maxTime > 0.0 && m_timer.Get().to<double>() > m_maxTime;
+    if (timedOut || m_chassis->IsTrajectoryStreamFinished())
+    {
+        m_chassis->StopTrajectoryStream();
+        m_started = false;
+
+        // the stream has no pose feedback, so report how far from the end of the path the robot stopped
+        auto endError = m_chassis->GetPose().Translation().Distance(m_trajectory.States().back().pose.Translation());
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::WARNING))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::WARNING, m_ntName, "End Pose Error (m)", endError.to<double>());
+        }
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_ntName, "WhyDone", timedOut ? "Timed out" : "Profile finished");
+        }
+        return true;
+    }
+    return false;
+}
@@ -0,0 +1,60 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+//C++ Includes
+#include <memory>
+#include <string>
+
+//FRC/WPI Includes
+#include <frc/Timer.h>
+#include <frc/trajectory/Trajectory.h>
+
+//Team 302 Includes
+#include <auton/drivePrimitives/IPrimitive.h>
+
+//Forward Declares
+class PrimitiveParams;
+class SwerveChassis;
+
+/// @class StreamPath
+/// @brief Follow a pathweaver path with the drive motors' motion profile executors.  Unlike DrivePath, the
+///        whole path is converted and streamed to the Talons when the primitive starts, so it keeps running
+///        at the Talons' rate however long the robot loop takes; there is no pose feedback while it runs,
+///        so errors (wheel slip, a bump) aren't corrected.  The end pose error is logged when it finishes.
+class StreamPath : public IPrimitive
+{
+    public:
+        StreamPath();
+
+        virtual ~StreamPath() = default;
+
+        void Init(PrimitiveParams* params) override;
+
+        void Run() override;
+
+        bool IsDone() override;
+
+    private:
+        SwerveChassis*          m_chassis;
+        frc::Trajectory         m_trajectory;
+        frc::Timer              m_timer;
+        double                  m_maxTime;
+        bool                    m_started;
+        std::string             m_ntName;
+};
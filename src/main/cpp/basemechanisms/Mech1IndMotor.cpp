@@ -85,17 +85,19 @@ std::string Mech1IndMotor::GetNetworkTableName() const
 void Mech1IndMotor::LogData()
 {
     auto ntName = GetNetworkTableName();
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Speed", GetSpeed() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Position", GetPosition() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Target", GetTarget() );
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Speed", GetSpeed() );
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Position", GetPosition() );
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Target", GetTarget() );
+    }
 }
 
 void Mech1IndMotor::Update()
 {
     if ( m_motor.get() != nullptr )
     {
-        auto ntName = GetNetworkTableName();
-        m_motor.get()->Set(ntName, m_target );
+        m_motor.get()->Set( m_target );
     }
     LogData();
 }
@@ -125,6 +127,20 @@ double Mech1IndMotor::GetSpeed() const
 }
 
 
+/// @brief  Load the control constants into a free slot so entering the state only selects the slot.
+/// @param [in] ControlData* pid:  the control constants
+/// @return void
+void Mech1IndMotor::PreloadControlConstants
+(
+    ControlData*                                pid                 
+)
+{
+    if ( m_motor.get() != nullptr )
+    {
+        m_motor.get()->PreloadControlConstants( pid );
+    }
+}
+
 /// @brief  Set the control constants (e.g. PIDF values).
 /// @param [in] ControlData* pid:  the control constants
 /// @return void
@@ -88,6 +88,14 @@ class Mech1IndMotor : public IMech1IndMotor
         /// @return double	speed in inches/second (translating mechanisms) or degrees/second (rotating mechanisms)
         double GetSpeed() const override;
 
+        /// @brief  Load the control constants into a free slot so entering the state only selects the slot.
+        /// @param [in] ControlData*                                   pid:  the control constants
+        /// @return void
+        void PreloadControlConstants
+        (
+            ControlData*                                pid                 
+        ) override;
+
         /// @brief  Set the control constants (e.g. PIDF values).
         /// @param [in] ControlData*                                   pid:  the control constants
         /// @return void
@@ -109,6 +109,11 @@ Mech1MotorState::Mech1MotorState
                 m_speedBased = false;
                 break;
         }
+
+        if ( mechanism != nullptr )
+        {
+            mechanism->PreloadControlConstants( control );
+        }
     }
     
 }
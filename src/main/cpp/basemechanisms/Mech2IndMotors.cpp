@@ -97,26 +97,28 @@ void Mech2IndMotors::LogData()
 {
     auto ntName = GetNetworkTableName();
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Speed - Primary", GetPrimarySpeed() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Speed - Secondary", GetSecondarySpeed() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Position - Primary", GetPrimaryPosition() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Position - Secondary", GetSecondaryPosition() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Target - Primary", m_primaryTarget);
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Target - Secondary", m_secondaryTarget);
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Speed - Primary", GetPrimarySpeed() );
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Speed - Secondary", GetSecondarySpeed() );
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Position - Primary", GetPrimaryPosition() );
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Position - Secondary", GetSecondaryPosition() );
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Target - Primary", m_primaryTarget);
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Target - Secondary", m_secondaryTarget);
+    }
 }
 
 /// @brief update the output to the mechanism using the current controller and target value(s)
 /// @return void 
 void Mech2IndMotors::Update()
 {
-    auto ntName = GetNetworkTableName();
     if ( m_primary.get() != nullptr )
     {
-        m_primary.get()->Set(ntName, m_primaryTarget);
+        m_primary.get()->Set(m_primaryTarget);
     }
     if ( m_secondary.get() != nullptr )
     {
-        m_secondary.get()->Set(ntName, m_secondaryTarget);
+        m_secondary.get()->Set(m_secondaryTarget);
     }
 
     LogData();
@@ -166,6 +168,27 @@ double Mech2IndMotors::GetSecondarySpeed() const
 /// @brief  Set the control constants (e.g. PIDF values).
 /// @param [in] ControlData*                                   pid:  the control constants
 /// @return void
+void Mech2IndMotors::PreloadControlConstants
+(
+    ControlData*                                pid                 
+) 
+{
+    if ( m_primary.get() != nullptr )
+    {
+        m_primary.get()->PreloadControlConstants(pid);
+    }
+}
+void Mech2IndMotors::PreloadSecondaryControlConstants
+(
+    ControlData*                                pid                 
+) 
+{
+    if ( m_secondary.get() != nullptr )
+    {
+        m_secondary.get()->PreloadControlConstants(pid);
+    }    
+}
+
 void Mech2IndMotors::SetControlConstants
 (
     int                                         slot,
@@ -95,6 +95,18 @@ class Mech2IndMotors : public IMech2IndMotors
         /// @return double	speed in inches/second (translating mechanisms) or degrees/second (rotating mechanisms)
         double GetSecondarySpeed() const override;
 
+        /// @brief  Load the control constants into a free slot so entering the state only selects the slot.
+        /// @param [in] ControlData*                                   pid:  the control constants
+        /// @return void
+        void PreloadControlConstants
+        (
+            ControlData*                                pid                 
+        ) override;
+        void PreloadSecondaryControlConstants
+        (
+            ControlData*                                pid                 
+        ) override;
+
         /// @brief  Set the control constants (e.g. PIDF values).
         /// @param [in] ControlData*                                   pid:  the control constants
         /// @return void
@@ -124,7 +124,9 @@ Mech2MotorState::Mech2MotorState
         {
             Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, mechanism->GetNetworkTableName(), ("Mech2MotorState::Mech2MotorState"), string("inconsistent control modes"));
         }
-        
+
+        mechanism->PreloadControlConstants( control );
+        mechanism->PreloadSecondaryControlConstants( control2 );
     }
     
 }
@@ -55,6 +55,14 @@ class IMech1IndMotor : public IMech
         /// @return double	speed in inches/second (translating mechanisms) or degrees/second (rotating mechanisms)
         virtual double GetSpeed() const =0;
 
+        /// @brief  Load the control constants into a free slot so entering the state only selects the slot.
+        /// @param [in] ControlData*                                   pid:  the control constants
+        /// @return void
+        virtual void PreloadControlConstants
+        (
+            ControlData*                                pid                 
+        ) = 0;
+
         /// @brief  Set the control constants (e.g. PIDF values).
         /// @param [in] ControlData*                                   pid:  the control constants
         /// @return void
@@ -31,6 +31,7 @@
 #include <units/angular_acceleration.h>
 #include <units/angular_velocity.h>
 #include <units/length.h>
+#include <units/time.h>
 #include <units/velocity.h>
 
 
@@ -73,6 +74,8 @@ IChassis* ChassisXmlParser::ParseXML
     units::length::inch_t wheelBase(0.0);
     units::length::inch_t track(0.0);
     double odometryComplianceCoefficient = 1.0;
+    double controlRate = 0.0;
+    double odometryRate = 0.0;
     units::velocity::meters_per_second_t maxVelocity(0.0);
     units::radians_per_second_t maxAngularSpeed(0.0);
     units::acceleration::meters_per_second_squared_t maxAcceleration(0.0);
@@ -145,6 +148,14 @@ IChassis* ChassisXmlParser::ParseXML
         {
             odometryComplianceCoefficient = attr.as_double();
         }
+        else if ( attrName.compare("controlRate") == 0 )
+        {
+            controlRate = attr.as_double();
+        }
+        else if ( attrName.compare("odometryRate") == 0 )
+        {
+            odometryRate = attr.as_double();
+        }
         else if (attrName.compare("networkTable") == 0)
         {
             networkTableName = attr.as_string();
@@ -301,6 +312,19 @@ IChassis* ChassisXmlParser::ParseXML
                                               //speedCalcOption,
                                               poseEstOption, 
                                               odometryComplianceCoefficient );
+
+            // swerve control and odometry on their own threads (rates in Hz); otherwise they run in the robot loop
+            if ( chassis != nullptr && type == ChassisFactory::CHASSIS_TYPE::SWERVE_CHASSIS )
+            {
+                if ( odometryRate > 0.0 )
+                {
+                    factory->GetSwerveChassis()->EnableOdometryThread( units::time::second_t(1.0 / odometryRate) );
+                }
+                if ( controlRate > 0.0 )
+                {
+                    factory->GetSwerveChassis()->EnableHighRateControl( units::time::second_t(1.0 / controlRate) );
+                }
+            }
         }
         else  // log errors
         {
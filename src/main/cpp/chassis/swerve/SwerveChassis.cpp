@@ -15,9 +15,13 @@
 //====================================================================================================================================================
 
 // C++ Includes
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
 #include <memory>
+#include <mutex>
 #include <cmath>
+#include <vector>
 
 // FRC includes
 #include <frc/drive/Vector2d.h>
@@ -26,6 +30,10 @@
 #include <frc/geometry/Rotation2d.h>
 #include <frc/geometry/Transform2d.h>
 #include <frc/geometry/Translation2d.h>
+#include <frc/Notifier.h>
+#include <frc/RobotController.h>
+#include <frc/kinematics/ChassisSpeeds.h>
+#include <frc/kinematics/SwerveModuleState.h>
 #include <units/acceleration.h>
 #include <units/angle.h>
 #include <units/angular_acceleration.h>
@@ -42,6 +50,9 @@
 #include <hw/factories/LimelightFactory.h>
 #include <utils/AngleUtils.h>
 #include <utils/Logger.h>
+#include <utils/LoopProfiler.h>
+#include <utils/LoopWatchdog.h>
+#include <utils/TelemetryRecorder.h>
 
 // Third Party Includes
 #include <ctre/phoenix/sensors/CANCoder.h>
@@ -50,6 +61,12 @@
 using namespace std;
 using namespace frc;
 
+namespace
+{
+    const units::time::second_t STREAM_PERIOD = units::time::second_t(0.01);   // time between trajectory points
+    const double HEADING_CATCH_UP_TIME = 0.5;   // seconds to turn from the start heading to the path's direction
+}
+
 /// @brief Construct a swerve chassis
 /// @param [in] std::shared_ptr<SwerveModule>           frontleft:          front left swerve module
 /// @param [in] std::shared_ptr<SwerveModule>           frontright:         front right swerve module
@@ -107,11 +124,58 @@ SwerveChassis::SwerveChassis
     m_storedYaw(m_pigeon->GetYaw()),
     m_yawCorrection(units::angular_velocity::degrees_per_second_t(0.0)),
     m_targetHeading(units::angle::degree_t(0)),
-    m_limelight(LimelightFactory::GetLimelightFactory()->GetLimelight())
+    m_limelight(LimelightFactory::GetLimelightFactory()->GetLimelight()),
+    m_driveSignals(),
+    m_aggregateSignals(),
+    m_driveZone(LoopProfiler::GetInstance()->RegisterZone("SwerveChassis::Drive")),
+    m_odometryZone(LoopProfiler::GetInstance()->RegisterZone("SwerveChassis::UpdateOdometry")),
+    m_telemetrySignals(),
+    m_stateMutex(),
+    m_commands(),
+    m_poseSamples(),
+    m_snapshot(),
+    m_snapshotLoop(UINT64_MAX),
+    m_odometryThreadRunning(false),
+    m_streaming(false),
+    m_controlStopped(false),
+    m_controlLoop(),
+    m_odometryLoop()
 {
+    m_frontLeft.get()->SetSnapshot(&m_snapshot);
+    m_frontRight.get()->SetSnapshot(&m_snapshot);
+    m_backLeft.get()->SetSnapshot(&m_snapshot);
+    m_backRight.get()->SetSnapshot(&m_snapshot);
+
     m_timer.Reset();
     m_timer.Start();
 
+    auto logger = Logger::GetLogger();
+    m_driveSignals[X_SPEED]     = logger->RegisterSignal("Swerve Chassis", "XSpeed");
+    m_driveSignals[Y_SPEED]     = logger->RegisterSignal("Swerve Chassis", "YSpeed");
+    m_driveSignals[Z_SPEED]     = logger->RegisterSignal("Swerve Chassis", "ZSpeed");
+    m_driveSignals[YAW]         = logger->RegisterSignal("Swerve Chassis", "yaw");
+    m_driveSignals[ANGLE_ERROR] = logger->RegisterSignal("Swerve Chassis", "angle error Degrees Per Second");
+    m_driveSignals[CURRENT_X]   = logger->RegisterSignal("Swerve Chassis", "Current X");
+    m_driveSignals[CURRENT_Y]   = logger->RegisterSignal("Swerve Chassis", "Current Y");
+    m_driveSignals[CURRENT_ROT] = logger->RegisterSignal("Swerve Chassis", "Current Rot(Degrees)");
+
+    m_aggregateSignals[ACCEL_X] = logger->RegisterAggregate("Swerve Chassis", "AccelX");
+    m_aggregateSignals[ACCEL_Y] = logger->RegisterAggregate("Swerve Chassis", "AccelY");
+    m_aggregateSignals[ACCEL_Z] = logger->RegisterAggregate("Swerve Chassis", "AccelZ");
+
+    auto recorder = TelemetryRecorder::GetInstance();
+    m_telemetrySignals[POSE_X]            = recorder->RegisterSignal("Swerve Chassis/pose x (m)");
+    m_telemetrySignals[POSE_Y]            = recorder->RegisterSignal("Swerve Chassis/pose y (m)");
+    m_telemetrySignals[POSE_ROT]          = recorder->RegisterSignal("Swerve Chassis/pose rot (deg)");
+    m_telemetrySignals[FRONT_LEFT_SPEED]  = recorder->RegisterSignal("Swerve Chassis/front left speed (mps)");
+    m_telemetrySignals[FRONT_LEFT_ANGLE]  = recorder->RegisterSignal("Swerve Chassis/front left angle (deg)");
+    m_telemetrySignals[FRONT_RIGHT_SPEED] = recorder->RegisterSignal("Swerve Chassis/front right speed (mps)");
+    m_telemetrySignals[FRONT_RIGHT_ANGLE] = recorder->RegisterSignal("Swerve Chassis/front right angle (deg)");
+    m_telemetrySignals[BACK_LEFT_SPEED]   = recorder->RegisterSignal("Swerve Chassis/back left speed (mps)");
+    m_telemetrySignals[BACK_LEFT_ANGLE]   = recorder->RegisterSignal("Swerve Chassis/back left angle (deg)");
+    m_telemetrySignals[BACK_RIGHT_SPEED]  = recorder->RegisterSignal("Swerve Chassis/back right speed (mps)");
+    m_telemetrySignals[BACK_RIGHT_ANGLE]  = recorder->RegisterSignal("Swerve Chassis/back right angle (deg)");
+
     frontLeft.get()->Init( wheelDiameter, maxSpeed, maxAngularSpeed, maxAcceleration, maxAngularAcceleration, m_frontLeftLocation );
     frontRight.get()->Init( wheelDiameter, maxSpeed, maxAngularSpeed, maxAcceleration, maxAngularAcceleration, m_frontRightLocation );
     backLeft.get()->Init( wheelDiameter, maxSpeed, maxAngularSpeed, maxAcceleration, maxAngularAcceleration, m_backLeftLocation );
@@ -122,6 +186,8 @@ SwerveChassis::SwerveChassis
 /// @brief Align all of the swerve modules to point forward
 void SwerveChassis::ZeroAlignSwerveModules()
 {
+    lock_guard<recursive_mutex> lock(m_stateMutex);
+    RefreshSnapshot();
     m_frontLeft.get()->ZeroAlignModule();
     m_frontRight.get()->ZeroAlignModule();
     m_backLeft.get()->ZeroAlignModule();
@@ -139,9 +205,12 @@ units::angular_velocity::degrees_per_second_t SwerveChassis::CalcHeadingCorrecti
     auto correction = units::angular_velocity::degrees_per_second_t(errorAngle.to<double>()*kP);
 
     //Debugging
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Heading: Current Angle (Degrees): ", currentAngle.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Heading: Error Angle (Degrees): ", errorAngle.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Heading: Yaw Correction (Degrees Per Second): ", m_yawCorrection.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Heading: Current Angle (Degrees): ", currentAngle.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Heading: Error Angle (Degrees): ", errorAngle.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Heading: Yaw Correction (Degrees Per Second): ", m_yawCorrection.to<double>());
+    }
 
     return correction;
 }
@@ -157,6 +226,232 @@ void SwerveChassis::Drive
     HEADING_OPTION              headingOption
 )
 {
+    if (IsStreaming())
+    {
+        StopTrajectoryStream();
+    }
+
+    if (IsHighRateControlEnabled())
+    {
+        m_commands.Write(DriveCommand{speeds.vx.to<double>(), speeds.vy.to<double>(), speeds.omega.to<double>(), 
+                                      mode, headingOption, false, RobotController::GetFPGATime()});
+    }
+    else
+    {
+        ProfileScope scope(m_driveZone);
+        RefreshSnapshot();
+        ExecuteDrive(speeds, mode, headingOption);
+    }
+}
+
+/// @brief Start running the swerve control on its own thread
+/// @param [in] units::time::second_t   period:     control loop period (e.g. 5 ms for 200 Hz)
+void SwerveChassis::EnableHighRateControl
+(
+    units::time::second_t       period
+)
+{
+    if (period <= 0_s)
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, "Swerve Chassis", "EnableHighRateControl", "invalid period; the swerve control stays in the robot loop");
+        return;
+    }
+
+    DisableHighRateControl();
+    m_controlStopped = false;
+    m_controlLoop = make_unique<Notifier>([this] { RunControlLoop(); });
+    m_controlLoop.get()->SetName("SwerveControl");
+    m_controlLoop.get()->StartPeriodic(period);
+}
+
+/// @brief Go back to running the swerve control from Drive (in the robot loop)
+void SwerveChassis::DisableHighRateControl()
+{
+    if (m_controlLoop.get() != nullptr)
+    {
+        m_controlLoop.get()->Stop();
+        m_controlLoop.reset();
+    }
+}
+
+/// @brief control thread:  run the latest command published by Drive
+void SwerveChassis::RunControlLoop()
+{
+    DriveCommand command;
+    if (IsStreaming() || !m_commands.Read(command))
+    {
+        return;
+    }
+
+    if (command.stop || RobotController::GetFPGATime() - command.time > COMMAND_TIMEOUT)
+    {
+        if (!m_controlStopped)
+        {
+            lock_guard<recursive_mutex> lock(m_stateMutex);
+            StopModules();
+            m_drive = units::velocity::meters_per_second_t(0.0);
+            m_steer = units::velocity::meters_per_second_t(0.0);
+            m_rotate = units::angular_velocity::radians_per_second_t(0.0);
+            m_controlStopped = true;
+        }
+        return;
+    }
+
+    m_controlStopped = false;
+    lock_guard<recursive_mutex> lock(m_stateMutex);
+    SampleModules();
+    ExecuteDrive(ChassisSpeeds{units::meters_per_second_t(command.vx), units::meters_per_second_t(command.vy), units::radians_per_second_t(command.omega)}, 
+                 command.mode, 
+                 command.headingOption);
+}
+
+/// @brief odometry thread:  read the modules and update the pose
+void SwerveChassis::RunOdometryLoop()
+{
+    lock_guard<recursive_mutex> lock(m_stateMutex);
+    SampleModules();
+    UpdatePoseEstimate();
+}
+
+/// @brief read all four modules into m_snapshot (m_stateMutex must be held)
+void SwerveChassis::SampleModules() const
+{
+    m_snapshot.time = RobotController::GetFPGATime();
+    m_frontLeft.get()->Sample(m_snapshot);
+    m_frontRight.get()->Sample(m_snapshot);
+    m_backLeft.get()->Sample(m_snapshot);
+    m_backRight.get()->Sample(m_snapshot);
+}
+
+/// @brief robot loop:  read the modules if they haven't been read yet this loop (the control
+///        and odometry threads read them at the start of each of their cycles instead)
+void SwerveChassis::RefreshSnapshot() const
+{
+    if (IsOdometryThreadEnabled())
+    {
+        return;     // read every odometry period, which is faster than the robot loop
+    }
+
+    lock_guard<recursive_mutex> lock(m_stateMutex);
+    auto loop = LoopWatchdog::GetInstance()->GetLoopCount();
+    if (loop != m_snapshotLoop)
+    {
+        SampleModules();
+        m_snapshotLoop = loop;
+    }
+}
+
+/// @brief set all of the swerve module motors to zero
+void SwerveChassis::StopModules()
+{
+    m_frontLeft.get()->StopMotors();
+    m_frontRight.get()->StopMotors();
+    m_backLeft.get()->StopMotors();
+    m_backRight.get()->StopMotors();
+}
+
+/// @brief Follow a trajectory with the Talons' motion profile executors
+/// @param [in] const frc::Trajectory&  trajectory:     path to follow (field coordinates)
+/// @param [in] HEADING_OPTION          headingOption:  MAINTAIN - keep the current heading, anything else - face along the path
+/// @returns bool: true - all of the modules started their profiles
+///
+/// The heading is planned from the estimated heading at the start:  the robot turns toward the path's direction
+/// over HEADING_CATCH_UP_TIME and then follows its curvature.  There is no pose feedback while the stream runs.
+bool SwerveChassis::StartTrajectoryStream
+(
+    const Trajectory&           trajectory,
+    HEADING_OPTION              headingOption
+)
+{
+    if (trajectory.States().empty())
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, "Swerve Chassis", "StartTrajectoryStream", "empty trajectory");
+        return false;
+    }
+
+    lock_guard<recursive_mutex> lock(m_stateMutex);
+    auto robotHeading = GetEstimatedPose().Rotation();
+    auto count = static_cast<size_t>(trajectory.TotalTime().to<double>() / STREAM_PERIOD.to<double>()) + 2;
+
+    vector<SwerveModuleState> frontLeft;
+    vector<SwerveModuleState> frontRight;
+    vector<SwerveModuleState> backLeft;
+    vector<SwerveModuleState> backRight;
+    frontLeft.reserve(count);
+    frontRight.reserve(count);
+    backLeft.reserve(count);
+    backRight.reserve(count);
+
+    for (size_t inx=0; inx<count; ++inx)
+    {
+        // the last point is the end of the path, so the modules finish stopped at the final pose
+        auto time = inx+1 < count ? STREAM_PERIOD * static_cast<double>(inx) : trajectory.TotalTime();
+        auto state = trajectory.Sample(time);
+        auto direction = state.pose.Rotation();
+        auto speed = inx+1 < count ? state.velocity : units::velocity::meters_per_second_t(0.0);
+
+        // robotHeading is where the planned rotation has the robot at this point, so the field relative
+        // conversion stays right when the robot doesn't start facing along the path
+        auto omega = units::radians_per_second_t(0.0);
+        if (headingOption != HEADING_OPTION::MAINTAIN && inx+1 < count)
+        {
+            auto error = (direction - robotHeading).Radians().to<double>();
+            auto maxOmega = m_maxAngularSpeed.to<double>();
+            omega = units::radians_per_second_t(clamp(state.curvature.to<double>() * speed.to<double>() + error / HEADING_CATCH_UP_TIME, -maxOmega, maxOmega));
+        }
+        auto speeds = ChassisSpeeds::FromFieldRelativeSpeeds(speed * direction.Cos(), speed * direction.Sin(), omega, robotHeading);
+        robotHeading = robotHeading + Rotation2d(units::radian_t(omega.to<double>() * STREAM_PERIOD.to<double>()));
+
+        auto states = m_kinematics.ToSwerveModuleStates(speeds);
+        m_kinematics.DesaturateWheelSpeeds(&states, m_maxSpeed);
+        auto [fl, fr, bl, br] = states;
+        frontLeft.emplace_back(fl);
+        frontRight.emplace_back(fr);
+        backLeft.emplace_back(bl);
+        backRight.emplace_back(br);
+    }
+
+    m_streaming.store(true, memory_order_release);
+    auto started = m_frontLeft.get()->StartProfile(frontLeft, STREAM_PERIOD);
+    started = m_frontRight.get()->StartProfile(frontRight, STREAM_PERIOD) && started;
+    started = m_backLeft.get()->StartProfile(backLeft, STREAM_PERIOD) && started;
+    started = m_backRight.get()->StartProfile(backRight, STREAM_PERIOD) && started;
+    if (!started)
+    {
+        StopTrajectoryStream();
+    }
+    return started;
+}
+
+/// @returns bool: true - every module has run the last point of its profile
+bool SwerveChassis::IsTrajectoryStreamFinished() const
+{
+    return m_frontLeft.get()->IsProfileFinished() && 
+           m_frontRight.get()->IsProfileFinished() && 
+           m_backLeft.get()->IsProfileFinished() && 
+           m_backRight.get()->IsProfileFinished();
+}
+
+/// @brief Stop following the trajectory and stop the modules
+void SwerveChassis::StopTrajectoryStream()
+{
+    lock_guard<recursive_mutex> lock(m_stateMutex);
+    m_streaming.store(false, memory_order_release);
+    StopModules();
+}
+
+/// @brief heading correction, kinematics and module outputs for one drive command
+/// @param [in] frc::ChassisSpeeds  speeds:         kinematics for how to move the chassis
+/// @param [in] CHASSIS_DRIVE_MODE  mode:           How the input chassis speeds are interpreted
+/// @param [in] HEADING_OPTION      headingOption:  How the robot top should be facing
+void SwerveChassis::ExecuteDrive
+( 
+    ChassisSpeeds               speeds, 
+    CHASSIS_DRIVE_MODE          mode,
+    HEADING_OPTION              headingOption
+)
+{
+    lock_guard<recursive_mutex> lock(m_stateMutex);
     auto xSpeed = (abs(speeds.vx.to<double>()) < m_deadband) ? units::meters_per_second_t(0.0) : speeds.vx; 
     auto ySpeed = (abs(speeds.vy.to<double>()) < m_deadband) ? units::meters_per_second_t(0.0) : speeds.vy; 
     auto rot = speeds.omega;
@@ -173,20 +468,29 @@ void SwerveChassis::Drive
 
         case HEADING_OPTION::TOWARD_GOAL:
             AdjustRotToPointTowardGoal(currentPose, rot);
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Chassis Heading: rot", rot.to<double>() );
+            if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+            {
+                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Chassis Heading: rot", rot.to<double>() );
+            }
             break;
 
         case HEADING_OPTION::TOWARD_GOAL_DRIVE:
              [[fallthrough]]; // intentional fallthrough 
         case HEADING_OPTION::TOWARD_GOAL_LAUNCHPAD:
             DriveToPointTowardGoal(currentPose,goalPose,xSpeed,ySpeed,rot);
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Chassis Heading: rot", rot.to<double>() );
+            if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+            {
+                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Chassis Heading: rot", rot.to<double>() );
+            }
             break;
 
         case HEADING_OPTION::SPECIFIED_ANGLE:
             rot -= CalcHeadingCorrection(m_targetHeading, kPAutonSpecifiedHeading);
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Chassis Heading: Specified Angle (Degrees): ", m_targetHeading.to<double>());
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Chassis Heading:Heading Correction", rot.to<double>());
+            if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+            {
+                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Chassis Heading: Specified Angle (Degrees): ", m_targetHeading.to<double>());
+                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Chassis Heading:Heading Correction", rot.to<double>());
+            }
             break;
 
         case HEADING_OPTION::LEFT_INTAKE_TOWARD_BALL:
@@ -201,24 +505,26 @@ void SwerveChassis::Drive
             break;
     }
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("XSpeed"), xSpeed.to<double>() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("YSpeed"), ySpeed.to<double>() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("ZSpeed"), rot.to<double>() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("yaw"), m_pigeon->GetYaw() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("angle error Degrees Per Second"), m_yawCorrection.to<double>());
-
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("Current X"), GetPose().X().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("Current Y"), GetPose().Y().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("Current Rot(Degrees)"), GetPose().Rotation().Degrees().to<double>());
+    auto logger = Logger::GetLogger();
+    if (logger->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        logger->LogSignal(Logger::LOGGER_LEVEL::PRINT, m_driveSignals[X_SPEED], xSpeed.to<double>() );
+        logger->LogSignal(Logger::LOGGER_LEVEL::PRINT, m_driveSignals[Y_SPEED], ySpeed.to<double>() );
+        logger->LogSignal(Logger::LOGGER_LEVEL::PRINT, m_driveSignals[Z_SPEED], rot.to<double>() );
+        logger->LogSignal(Logger::LOGGER_LEVEL::PRINT, m_driveSignals[YAW], m_pigeon->GetYaw() );
+        logger->LogSignal(Logger::LOGGER_LEVEL::PRINT, m_driveSignals[ANGLE_ERROR], m_yawCorrection.to<double>());
+
+        auto pose = GetPose();
+        logger->LogSignal(Logger::LOGGER_LEVEL::PRINT, m_driveSignals[CURRENT_X], pose.X().to<double>());
+        logger->LogSignal(Logger::LOGGER_LEVEL::PRINT, m_driveSignals[CURRENT_Y], pose.Y().to<double>());
+        logger->LogSignal(Logger::LOGGER_LEVEL::PRINT, m_driveSignals[CURRENT_ROT], pose.Rotation().Degrees().to<double>());
+    }
     
     if ( (abs(xSpeed.to<double>()) < m_deadband) && 
          (abs(ySpeed.to<double>()) < m_deadband) && 
          (abs(rot.to<double>())    < m_angularDeadband.to<double>()))  //our angular deadband, only used once, equates to 10 degrees per second
     {
-        m_frontLeft.get()->StopMotors();
-        m_frontRight.get()->StopMotors();
-        m_backLeft.get()->StopMotors();
-        m_backRight.get()->StopMotors();
+        StopModules();
         m_drive = units::velocity::meters_per_second_t(0.0);
         m_steer = units::velocity::meters_per_second_t(0.0);
         m_rotate = units::angular_velocity::radians_per_second_t(0.0);
@@ -255,10 +561,13 @@ void SwerveChassis::Drive
                 br.angle = UpdateForPolarDrive(currentPose, goalPose, Transform2d(m_backRightLocation, br.angle), chassisSpeeds);
                 fl.angle = UpdateForPolarDrive(currentPose, goalPose, Transform2d(m_frontLeftLocation, fl.angle), chassisSpeeds);
 
-                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: Front Left Angle", fl.angle.Degrees().to<double>());
-                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: Front Right Angle", fr.angle.Degrees().to<double>());
-                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: Back Left Angle", bl.angle.Degrees().to<double>());
-                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: Back Right Angle", br.angle.Degrees().to<double>());
+                if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+                {
+                    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: Front Left Angle", fl.angle.Degrees().to<double>());
+                    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: Front Right Angle", fr.angle.Degrees().to<double>());
+                    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: Back Left Angle", bl.angle.Degrees().to<double>());
+                    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: Back Right Angle", br.angle.Degrees().to<double>());
+                }
            }
         
             m_frontLeft.get()->SetDesiredState(fl);
@@ -302,19 +611,19 @@ void SwerveChassis::Drive
             m_frontRight.get()->SetDesiredState(m_frState);
             m_backLeft.get()->SetDesiredState(m_blState);
             m_backRight.get()->SetDesiredState(m_brState);
-            auto ax = m_accel.GetX();
-            auto ay = m_accel.GetY();
-            auto az = m_accel.GetZ();
-
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("AccelX"), ax);
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("AccelY"), ay);
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("AccelZ"), az);
+            if (logger->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+            {
+                logger->LogAggregate(Logger::LOGGER_LEVEL::PRINT, m_aggregateSignals[ACCEL_X], m_accel.GetX());
+                logger->LogAggregate(Logger::LOGGER_LEVEL::PRINT, m_aggregateSignals[ACCEL_Y], m_accel.GetY());
+                logger->LogAggregate(Logger::LOGGER_LEVEL::PRINT, m_aggregateSignals[ACCEL_Z], m_accel.GetZ());
+            }
         }
     }    
 }
 
 void SwerveChassis::HoldPosition()
 {
+    lock_guard<recursive_mutex> lock(m_stateMutex);
     m_hold = true;
 }
 
@@ -351,19 +660,25 @@ units::angle::degree_t SwerveChassis::UpdateForPolarDrive
     units::angle::degree_t thetaDeg = triangleThetaRads; //- robotPose.Rotation().Degrees(); Subtract robot pose to "normalize" wheels, zero for the wheels is the robot angle
 
     //Debugging
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: WheelPoseX (Meters)", WheelPose.X().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: WheelPoseY (Meters)", WheelPose.Y().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: WheelDeltaX (Meters)", wheelDeltaX.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: WheelDeltaY (Meters)", wheelDeltaY.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: Triangle Theta", thetaDeg.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: Ninety (Degrees)", ninety.Degrees().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: Field Quadrant", m_targetFinder.GetFieldQuadrant(WheelPose));
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: WheelPoseX (Meters)", WheelPose.X().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: WheelPoseY (Meters)", WheelPose.Y().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: WheelDeltaX (Meters)", wheelDeltaX.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: WheelDeltaY (Meters)", wheelDeltaY.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: Triangle Theta", thetaDeg.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: Ninety (Degrees)", ninety.Degrees().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: Field Quadrant", m_targetFinder.GetFieldQuadrant(WheelPose));
+    }
 
     auto radialAngle = thetaDeg;
     auto orbitAngle = thetaDeg + ninety.Degrees();
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: Orbit Angle (Degrees)", orbitAngle.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Polar Drive: Radial Angle (Degrees)", radialAngle.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: Orbit Angle (Degrees)", orbitAngle.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Polar Drive: Radial Angle (Degrees)", radialAngle.to<double>());
+    }
 
     auto hasRadialComp = (abs(speeds.vx.to<double>()) > 0.1);
     auto hasOrbitComp = (abs(speeds.vy.to<double>()) > 0.1);
@@ -405,15 +720,24 @@ void SwerveChassis::Drive
     HEADING_OPTION              headingOption
 )
 {
+    if (IsStreaming())
+    {
+        StopTrajectoryStream();
+    }
+
     if ( abs(drive)  < m_deadband && 
          abs(steer)  < m_deadband && 
          abs(rotate) < m_deadband)
     {
         // feed the motors
-        m_frontLeft.get()->StopMotors();
-        m_frontRight.get()->StopMotors();
-        m_backLeft.get()->StopMotors();
-        m_backRight.get()->StopMotors();       
+        if (IsHighRateControlEnabled())
+        {
+            m_commands.Write(DriveCommand{0.0, 0.0, 0.0, mode, headingOption, true, RobotController::GetFPGATime()});
+        }
+        else
+        {
+            StopModules();
+        }
     }
     else
     {    
@@ -528,7 +852,10 @@ void SwerveChassis::DriveToPointTowardGoal
     {
         AdjustRotToPointTowardGoal(robotPose, rot);
     }
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("Chassis Heading: TurnToGoal New ZSpeed: "), rot.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Chassis Heading: TurnToGoal New ZSpeed: ", rot.to<double>());
+    }
 }
 
 void SwerveChassis::AdjustRotToPointTowardGoal
@@ -554,10 +881,26 @@ void SwerveChassis::AdjustRotToPointTowardGoal
         m_hold = false;
     }
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), string("Chassis Heading: TurnToGoal New ZSpeed: "), rot.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Chassis Heading: TurnToGoal New ZSpeed: ", rot.to<double>());
+    }
 }
 
 Pose2d SwerveChassis::GetPose() const
+{
+    PoseSample sample;
+    if (IsOdometryThreadEnabled() && m_poseSamples.Read(sample))
+    {
+        return Pose2d{units::length::meter_t(sample.x), units::length::meter_t(sample.y), Rotation2d(units::angle::degree_t(sample.rotation))};
+    }
+
+    lock_guard<recursive_mutex> lock(m_stateMutex);
+    return GetEstimatedPose();
+}
+
+/// @brief current pose from the selected estimator (m_stateMutex must be held)
+Pose2d SwerveChassis::GetEstimatedPose() const
 {
     if (m_poseOpt==PoseEstimatorEnum::WPI)
     {
@@ -573,25 +916,67 @@ units::angle::degree_t SwerveChassis::GetYaw() const
 }
 
 /// @brief update the chassis odometry based on current states of the swerve modules and the pigeon
+///        (when the odometry thread is running, this only records the latest sample)
 void SwerveChassis::UpdateOdometry() 
 {
+    ProfileScope scope(m_odometryZone);
+    if (!IsOdometryThreadEnabled())
+    {
+        lock_guard<recursive_mutex> lock(m_stateMutex);
+        RefreshSnapshot();
+        UpdatePoseEstimate();
+    }
+
+    PoseSample sample;
+    if (m_poseSamples.Read(sample))
+    {
+        auto recorder = TelemetryRecorder::GetInstance();
+        recorder->Record(m_telemetrySignals[POSE_X], sample.x);
+        recorder->Record(m_telemetrySignals[POSE_Y], sample.y);
+        recorder->Record(m_telemetrySignals[POSE_ROT], sample.rotation);
+        recorder->Record(m_telemetrySignals[FRONT_LEFT_SPEED], sample.speeds[0]);
+        recorder->Record(m_telemetrySignals[FRONT_LEFT_ANGLE], sample.angles[0]);
+        recorder->Record(m_telemetrySignals[FRONT_RIGHT_SPEED], sample.speeds[1]);
+        recorder->Record(m_telemetrySignals[FRONT_RIGHT_ANGLE], sample.angles[1]);
+        recorder->Record(m_telemetrySignals[BACK_LEFT_SPEED], sample.speeds[2]);
+        recorder->Record(m_telemetrySignals[BACK_LEFT_ANGLE], sample.angles[2]);
+        recorder->Record(m_telemetrySignals[BACK_RIGHT_SPEED], sample.speeds[3]);
+        recorder->Record(m_telemetrySignals[BACK_RIGHT_ANGLE], sample.angles[3]);
+    }
+}
+
+/// @brief update the pose from the module states in m_snapshot and the pigeon yaw, and publish
+///        a PoseSample (robot loop or odometry thread)
+void SwerveChassis::UpdatePoseEstimate()
+{
+    lock_guard<recursive_mutex> lock(m_stateMutex);
+
+    // the pose is stamped with the time the modules were read
+    auto time = units::time::second_t(static_cast<double>(m_snapshot.time) * 1.0e-6);
     units::degree_t yaw{m_pigeon->GetYaw()};
+    auto flState = m_frontLeft.get()->GetState();
+    auto frState = m_frontRight.get()->GetState();
+    auto blState = m_backLeft.get()->GetState();
+    auto brState = m_backRight.get()->GetState();
     Rotation2d rot2d {yaw}; 
 
     if (m_poseOpt == PoseEstimatorEnum::WPI)
     {
         auto currentPose = m_poseEstimator.GetEstimatedPosition();
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Odometry: Current X", currentPose.X().to<double>());
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Odometry: Current Y", currentPose.Y().to<double>());
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Odometry: Current X", currentPose.X().to<double>());
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Odometry: Current Y", currentPose.Y().to<double>());
+        }
 
-        m_poseEstimator.Update(rot2d, m_frontLeft.get()->GetState(),
-                                      m_frontRight.get()->GetState(), 
-                                      m_backLeft.get()->GetState(),
-                                      m_backRight.get()->GetState());
+        m_poseEstimator.UpdateWithTime(time, rot2d, flState, frState, blState, brState);
 
         auto updatedPose = m_poseEstimator.GetEstimatedPosition();
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Odometry: Updated X", updatedPose.X().to<double>());
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Odometry: Updated Y", updatedPose.Y().to<double>());
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Odometry: Updated X", updatedPose.X().to<double>());
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Odometry: Updated Y", updatedPose.Y().to<double>());
+        }
     }
     else if (m_poseOpt==PoseEstimatorEnum::EULER_AT_CHASSIS)
     {
@@ -633,11 +1018,53 @@ void SwerveChassis::UpdateOdometry()
         auto trans = currPose - m_pose;
         m_pose = m_pose + trans;
     }
+
+    auto pose = GetEstimatedPose();
+    PoseSample sample { pose.X().to<double>(), 
+                        pose.Y().to<double>(), 
+                        pose.Rotation().Degrees().to<double>(), 
+                        time.to<double>(),
+                        { flState.speed.to<double>(), frState.speed.to<double>(), blState.speed.to<double>(), brState.speed.to<double>() },
+                        { flState.angle.Degrees().to<double>(), frState.angle.Degrees().to<double>(), blState.angle.Degrees().to<double>(), brState.angle.Degrees().to<double>() } };
+    m_poseSamples.Write(sample);
+}
+
+/// @brief Start updating the odometry on its own thread
+/// @param [in] units::time::second_t   period:     odometry period (e.g. 5 ms for 200 Hz)
+void SwerveChassis::EnableOdometryThread
+(
+    units::time::second_t       period
+)
+{
+    if (period <= 0_s)
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, "Swerve Chassis", "EnableOdometryThread", "invalid period; the odometry stays in the robot loop");
+        return;
+    }
+
+    DisableOdometryThread();
+    RunOdometryLoop();          // GetPose has a sample to return right away
+    m_odometryLoop = make_unique<Notifier>([this] { RunOdometryLoop(); });
+    m_odometryLoop.get()->SetName("SwerveOdometry");
+    m_odometryLoop.get()->StartPeriodic(period);
+    m_odometryThreadRunning = true;
+}
+
+/// @brief Go back to updating the odometry from UpdateOdometry (in the robot loop)
+void SwerveChassis::DisableOdometryThread()
+{
+    m_odometryThreadRunning = false;
+    if (m_odometryLoop.get() != nullptr)
+    {
+        m_odometryLoop.get()->Stop();
+        m_odometryLoop.reset();
+    }
 }
 
 /// @brief set all of the encoders to zero
 void SwerveChassis::SetEncodersToZero()
 {
+    lock_guard<recursive_mutex> lock(m_stateMutex);
     m_frontLeft.get()->SetEncodersToZero();
     m_frontRight.get()->SetEncodersToZero();
     m_backLeft.get()->SetEncodersToZero();
@@ -653,6 +1080,8 @@ double SwerveChassis::GetEncoderValues(std::shared_ptr<SwerveModule> motor)
 /// @brief Provide the current chassis speed information
 ChassisSpeeds SwerveChassis::GetChassisSpeeds() const
 {
+    lock_guard<recursive_mutex> lock(m_stateMutex);
+    RefreshSnapshot();
     return m_kinematics.ToChassisSpeeds({ m_frontLeft.get()->GetState(), 
                                           m_frontRight.get()->GetState(),
                                           m_backLeft.get()->GetState(),
@@ -668,6 +1097,8 @@ void SwerveChassis::ResetPose
     const Rotation2d&   angle
 )
 {
+    lock_guard<recursive_mutex> lock(m_stateMutex);
+    RefreshSnapshot();
     m_poseEstimator.ResetPosition(pose, angle);
     SetEncodersToZero();
     m_pose = pose;
@@ -695,6 +1126,15 @@ void SwerveChassis::ResetPose
     Transform2d t_br {m_backRightLocation,angle};
     auto brPose = m_pose + t_br;
     m_backRight.get()->UpdateCurrPose(brPose.X(), brPose.Y());
+
+    // GetPose shouldn't return the old pose until the next odometry update
+    PoseSample sample {};
+    m_poseSamples.Read(sample);
+    sample.x = pose.X().to<double>();
+    sample.y = pose.Y().to<double>();
+    sample.rotation = angle.Degrees().to<double>();
+    sample.time = Timer::GetFPGATimestamp().to<double>();
+    m_poseSamples.Write(sample);
 }
 
 
@@ -715,9 +1155,12 @@ ChassisSpeeds SwerveChassis::GetFieldRelativeSpeeds
     units::radians_per_second_t rot        
 )
 {
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Field Oriented Calcs: xSpeed (mps)", xSpeed.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Field Oriented Calcs: ySpeed (mps)", ySpeed.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Field Oriented Calcs: rot (radians per sec)", rot.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Field Oriented Calcs: xSpeed (mps)", xSpeed.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Field Oriented Calcs: ySpeed (mps)", ySpeed.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Field Oriented Calcs: rot (radians per sec)", rot.to<double>());
+    }
 
     units::angle::radian_t yaw{m_pigeon->GetYaw()*wpi::numbers::pi/180.0};
     auto temp = xSpeed*cos(yaw.to<double>()) + ySpeed*sin(yaw.to<double>());
@@ -726,9 +1169,12 @@ ChassisSpeeds SwerveChassis::GetFieldRelativeSpeeds
 
     ChassisSpeeds output{forward, strafe, rot};
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Field Oriented Calcs: yaw (radians)", yaw.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Field Oriented Calcs: forward (mps)", forward.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Field Oriented Calcs: stafe (mps)", strafe.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Field Oriented Calcs: yaw (radians)", yaw.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Field Oriented Calcs: forward (mps)", forward.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Field Oriented Calcs: stafe (mps)", strafe.to<double>());
+    }
 
     return output;
 }
@@ -758,9 +1204,12 @@ void SwerveChassis::CalcSwerveModuleStates
     // We will use these variable names in the code to help tie back to the document.
     // Variable names, though, will follow C++ standards and start with a lower case letter.
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Drive", speeds.vx.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs:Strafe", speeds.vy.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs:Rotate", speeds.omega.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Drive", speeds.vx.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs:Strafe", speeds.vy.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs:Rotate", speeds.omega.to<double>());
+    }
 
     auto l = GetWheelBase();
     auto w = GetTrack();
@@ -783,8 +1232,11 @@ void SwerveChassis::CalcSwerveModuleStates
     m_flState.speed = units::velocity::meters_per_second_t(sqrt( pow(b.to<double>(),2) + pow(d.to<double>(),2) ));
     auto maxCalcSpeed = abs(m_flState.speed.to<double>());
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Front Left Angle", m_flState.angle.Degrees().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Front Left Speed", m_flState.speed.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Front Left Angle", m_flState.angle.Degrees().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Front Left Speed", m_flState.speed.to<double>());
+    }
 
     m_frState.angle = units::angle::radian_t(atan2(b.to<double>(), c.to<double>()));
     m_frState.angle = -1.0 * m_frState.angle.Degrees();
@@ -794,8 +1246,11 @@ void SwerveChassis::CalcSwerveModuleStates
         maxCalcSpeed = abs(m_frState.speed.to<double>());
     }
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Front Right Angle", m_frState.angle.Degrees().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Front Right Speed - raw", m_frState.speed.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Front Right Angle", m_frState.angle.Degrees().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Front Right Speed - raw", m_frState.speed.to<double>());
+    }
 
     m_blState.angle = units::angle::radian_t(atan2(a.to<double>(), d.to<double>()));
     m_blState.angle = -1.0 * m_blState.angle.Degrees();
@@ -805,8 +1260,11 @@ void SwerveChassis::CalcSwerveModuleStates
         maxCalcSpeed = abs(m_blState.speed.to<double>());
     }
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Back Left Angle", m_blState.angle.Degrees().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Back Left Speed - raw", m_blState.speed.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Back Left Angle", m_blState.angle.Degrees().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Back Left Speed - raw", m_blState.speed.to<double>());
+    }
 
     m_brState.angle = units::angle::radian_t(atan2(a.to<double>(), c.to<double>()));
     m_brState.angle = -1.0 * m_brState.angle.Degrees();
@@ -816,8 +1274,11 @@ void SwerveChassis::CalcSwerveModuleStates
         maxCalcSpeed = abs(m_brState.speed.to<double>());
     }
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Back Right Angle", m_brState.angle.Degrees().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Back Right Speed - raw", m_brState.speed.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Back Right Angle", m_brState.angle.Degrees().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Back Right Speed - raw", m_brState.speed.to<double>());
+    }
 
 
     // normalize speeds if necessary (maxCalcSpeed > max attainable speed)
@@ -830,18 +1291,23 @@ void SwerveChassis::CalcSwerveModuleStates
         m_brState.speed *= ratio;
     }
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Front Left Speed - normalized", m_flState.speed.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Front Right Speed - normalized", m_frState.speed.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Back Left Speed - normalized", m_blState.speed.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("Swerve Chassis"), "Swerve Calcs: Back Right Speed - normalized", m_brState.speed.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Front Left Speed - normalized", m_flState.speed.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Front Right Speed - normalized", m_frState.speed.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Back Left Speed - normalized", m_blState.speed.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "Swerve Chassis", "Swerve Calcs: Back Right Speed - normalized", m_brState.speed.to<double>());
+    }
 }
 
 void SwerveChassis::SetTargetHeading(units::angle::degree_t targetYaw) 
 {
+    lock_guard<recursive_mutex> lock(m_stateMutex);
     m_targetHeading = targetYaw;
 }
 
 void SwerveChassis::ReZero()
 {
+    lock_guard<recursive_mutex> lock(m_stateMutex);
     m_storedYaw = units::angle::degree_t(0.0);
-}
\ No newline at end of file
+}
@@ -15,7 +15,11 @@
 //====================================================================================================================================================
 
 #pragma once
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 
 #include <frc/AnalogGyro.h>
 #include <frc/BuiltInAccelerometer.h>
@@ -25,13 +29,16 @@
 #include <frc/geometry/Translation2d.h>
 #include <frc/kinematics/SwerveDriveKinematics.h>
 #include <frc/kinematics/SwerveDriveOdometry.h>
+#include <frc/Notifier.h>
 #include <frc/Timer.h>
+#include <frc/trajectory/Trajectory.h>
 
 #include <units/acceleration.h>
 #include <units/angle.h>
 #include <units/angular_acceleration.h>
 #include <units/angular_velocity.h>
 #include <units/length.h>
+#include <units/time.h>
 #include <units/velocity.h>
 
 
@@ -39,9 +46,11 @@
 #include <chassis/IChassis.h>
 #include <chassis/PoseEstimatorEnum.h>
 #include <chassis/swerve/SwerveModule.h>
+#include <chassis/swerve/SwerveSnapshot.h>
 #include <hw/DragonLimelight.h>
 #include <hw/DragonPigeon.h>
 #include <hw/factories/PigeonFactory.h>
+#include <utils/DoubleBuffer.h>
 
 class SwerveChassis : public IChassis
 {
@@ -107,7 +116,62 @@ class SwerveChassis : public IChassis
             HEADING_OPTION      headingOption
         ) override;
 
+        /// @brief Run the swerve control (heading correction, kinematics and module outputs) on its own
+        ///        frc::Notifier instead of in the robot loop.  Drive then only publishes the command; the
+        ///        control thread uses the latest command every period.  The modules are stopped if no command
+        ///        has been published for COMMAND_TIMEOUT (e.g. disabled or the robot loop is stuck).
+        /// @param [in] units::time::second_t   period:     control loop period (e.g. 5 ms for 200 Hz)
+        void EnableHighRateControl
+        (
+            units::time::second_t   period
+        );
+
+        /// @brief Go back to running the swerve control from Drive (in the robot loop)
+        void DisableHighRateControl();
+
+        /// @brief Follow a trajectory with the Talons' motion profile executors.  The trajectory is converted
+        ///        into module states every STREAM_PERIOD up front and each module streams them to its motors,
+        ///        so the path doesn't depend on the robot loop timing.  The next Drive call ends the stream.
+        ///        It is open loop on pose (DrivePath corrects the pose every loop), so DrivePath stays the
+        ///        default for auton paths.
+        /// @param [in] const frc::Trajectory&  trajectory:     path to follow (field coordinates)
+        /// @param [in] HEADING_OPTION          headingOption:  MAINTAIN - keep the current heading, anything else - face along the path
+        /// @returns bool: true - all of the modules started their profiles
+        bool StartTrajectoryStream
+        (
+            const frc::Trajectory&  trajectory,
+            HEADING_OPTION          headingOption
+        );
+
+        /// @returns bool: true - every module has run the last point of its profile
+        bool IsTrajectoryStreamFinished() const;
+
+        /// @brief Stop following the trajectory and stop the modules
+        void StopTrajectoryStream();
+
+        /// @returns bool: true - the modules are running a trajectory stream
+        bool IsStreaming() const { return m_streaming.load(std::memory_order_acquire); }
+
+        /// @returns bool: true - swerve control runs on its own thread, false - it runs in Drive
+        bool IsHighRateControlEnabled() const { return m_controlLoop.get() != nullptr; }
+
+        /// @brief Update the odometry on its own frc::Notifier (e.g. 200 Hz) instead of once per robot loop.
+        ///        The module states and the pigeon yaw are read back to back and passed to the pose estimator
+        ///        with the time they were read.  GetPose then returns the latest snapshot without locking.
+        /// @param [in] units::time::second_t   period:     odometry period (e.g. 5 ms for 200 Hz)
+        void EnableOdometryThread
+        (
+            units::time::second_t   period
+        );
+
+        /// @brief Go back to updating the odometry from UpdateOdometry (in the robot loop)
+        void DisableOdometryThread();
+
+        /// @returns bool: true - odometry is updated on its own thread, false - it is updated by UpdateOdometry
+        bool IsOdometryThreadEnabled() const { return m_odometryThreadRunning.load(std::memory_order_acquire); }
+
         /// @brief update the chassis odometry based on current states of the swerve modules and the pigeon
+        ///        (when the odometry thread is running, this only records the latest sample)
         void UpdateOdometry();
 
         /// @brief Provide the current chassis speed information
@@ -167,6 +231,37 @@ class SwerveChassis : public IChassis
         void HoldPosition();
 
     private:
+        /// @brief heading correction, kinematics and module outputs for one drive command (robot loop or control thread)
+        void ExecuteDrive
+        (
+            frc::ChassisSpeeds  speeds,
+            CHASSIS_DRIVE_MODE  mode,
+            HEADING_OPTION      headingOption
+        );
+
+        /// @brief set all of the swerve module motors to zero
+        void StopModules();
+
+        /// @brief control thread:  run the latest command published by Drive
+        void RunControlLoop();
+
+        /// @brief odometry thread:  read the modules and update the pose
+        void RunOdometryLoop();
+
+        /// @brief read all four modules into m_snapshot (m_stateMutex must be held)
+        void SampleModules() const;
+
+        /// @brief robot loop:  read the modules if they haven't been read yet this loop (the control
+        ///        and odometry threads read them at the start of each of their cycles instead)
+        void RefreshSnapshot() const;
+
+        /// @brief update the pose from the module states in m_snapshot and the pigeon yaw, and publish
+        ///        a PoseSample (robot loop or odometry thread)
+        void UpdatePoseEstimate();
+
+        /// @brief current pose from the selected estimator (m_stateMutex must be held)
+        frc::Pose2d GetEstimatedPose() const;
+
         frc::ChassisSpeeds GetFieldRelativeSpeeds
         (
             units::meters_per_second_t xSpeed,
@@ -282,7 +377,93 @@ class SwerveChassis : public IChassis
         units::angle::degree_t m_targetHeading;
         DragonLimelight*        m_limelight;
 
+        /// @enum DRIVE_SIGNAL
+        /// @brief values logged every time Drive is called (registered once with the logger)
+        enum DRIVE_SIGNAL
+        {
+            X_SPEED,
+            Y_SPEED,
+            Z_SPEED,
+            YAW,
+            ANGLE_ERROR,
+            CURRENT_X,
+            CURRENT_Y,
+            CURRENT_ROT,
+            MAX_DRIVE_SIGNALS
+        };
+        std::array<int, MAX_DRIVE_SIGNALS>  m_driveSignals;
+
+        /// @enum AGGREGATE_SIGNAL
+        /// @brief values that change faster than the dashboard refreshes (min/max/mean/last are logged per window)
+        enum AGGREGATE_SIGNAL
+        {
+            ACCEL_X,
+            ACCEL_Y,
+            ACCEL_Z,
+            MAX_AGGREGATE_SIGNALS
+        };
+        std::array<int, MAX_AGGREGATE_SIGNALS>  m_aggregateSignals;
+
+        int                                 m_driveZone;        // LoopProfiler zones
+        int                                 m_odometryZone;
+
+        /// @enum TELEMETRY_SIGNAL
+        /// @brief values recorded by the telemetry recorder every time the odometry is updated
+        enum TELEMETRY_SIGNAL
+        {
+            POSE_X,
+            POSE_Y,
+            POSE_ROT,
+            FRONT_LEFT_SPEED,
+            FRONT_LEFT_ANGLE,
+            FRONT_RIGHT_SPEED,
+            FRONT_RIGHT_ANGLE,
+            BACK_LEFT_SPEED,
+            BACK_LEFT_ANGLE,
+            BACK_RIGHT_SPEED,
+            BACK_RIGHT_ANGLE,
+            MAX_TELEMETRY_SIGNALS
+        };
+        std::array<int, MAX_TELEMETRY_SIGNALS>  m_telemetrySignals;
+
         const units::length::inch_t m_shootingDistance = units::length::inch_t(105.0); // was 105.0
 
+        /// @struct DriveCommand
+        /// @brief  command published by Drive for the control thread (plain values, so it can go through the DoubleBuffer)
+        struct DriveCommand
+        {
+            double                  vx;             // meters per second
+            double                  vy;             // meters per second
+            double                  omega;          // radians per second
+            CHASSIS_DRIVE_MODE      mode;
+            HEADING_OPTION          headingOption;
+            bool                    stop;
+            uint64_t                time;           // FPGA time (microseconds) it was published
+        };
+
+        static constexpr uint64_t   COMMAND_TIMEOUT = 100000;  // microseconds without a command before the modules are stopped
+
+        /// @struct PoseSample
+        /// @brief  pose and the module states it was calculated from (plain values, so it can go through the DoubleBuffer)
+        struct PoseSample
+        {
+            double                  x;              // meters
+            double                  y;              // meters
+            double                  rotation;       // degrees
+            double                  time;           // FPGA time (seconds) the sensors were read
+            std::array<double, 4>   speeds;         // meters per second (front left, front right, back left, back right)
+            std::array<double, 4>   angles;         // degrees
+        };
+
+        mutable std::recursive_mutex    m_stateMutex;       // pose, module states and heading targets (robot loop and control thread)
+        DoubleBuffer<DriveCommand>      m_commands;         // robot loop -> control thread
+        DoubleBuffer<PoseSample>        m_poseSamples;      // latest pose (written with m_stateMutex held, read without it)
+        mutable SwerveSnapshot          m_snapshot;         // module sensors for the current cycle (m_stateMutex)
+        mutable uint64_t                m_snapshotLoop;     // LoopWatchdog loop the robot loop last read the modules in
+        std::atomic<bool>               m_odometryThreadRunning;    // GetPose is called from the control thread too
+        std::atomic<bool>               m_streaming;        // the modules run a motion profile, so the control thread leaves them alone
+        bool                            m_controlStopped;   // control thread only:  modules were stopped for a stop/stale command
+        std::unique_ptr<frc::Notifier>  m_controlLoop;      // the threads are declared last so they are stopped before anything they use is destroyed
+        std::unique_ptr<frc::Notifier>  m_odometryLoop;
 
 };
\ No newline at end of file
@@ -34,12 +34,15 @@
 #include <chassis/PoseEstimatorEnum.h>
 #include <chassis/swerve/SwerveChassis.h>
 #include <chassis/swerve/SwerveModule.h>
+#include <hw/MotorCommand.h>
 #include <mechanisms/controllers/ControlData.h>
 #include <mechanisms/controllers/ControlModes.h>
 #include <utils/AngleUtils.h>
+#include <utils/ConversionUtils.h>
 #include <utils/Logger.h>
 
 // Third Party Includes
+#include <ctre/phoenix/motion/TrajectoryPoint.h>
 #include <ctre/phoenix/motorcontrol/can/WPI_TalonFX.h>
 #include <ctre/phoenix/sensors/CANCoder.h>
 
@@ -81,7 +84,10 @@ SwerveModule::SwerveModule
     m_currentSpeed(0.0_rpm),
     m_currentRotations(0.0),
     m_maxVelocity(1_mps),
-    m_runClosedLoopDrive(false)
+    m_runClosedLoopDrive(false),
+    m_snapshot(nullptr),
+    m_driveProfile(),
+    m_turnProfile()
 {
     driveMotor.get()->SetFramePeriodPriority(IDragonMotorController::MOTOR_PRIORITY::HIGH);
     turnMotor.get()->SetFramePeriodPriority(IDragonMotorController::MOTOR_PRIORITY::HIGH);
@@ -97,8 +103,13 @@ SwerveModule::SwerveModule
     //fx->ConfigOpenloopRamp(0.4, 0);
     //fx->ConfigClosedloopRamp(0.4, 0);
 
-    fx->ConfigSelectedFeedbackSensor( ctre::phoenix::motorcontrol::FeedbackDevice::IntegratedSensor, 0, 10 );
-    fx->ConfigIntegratedSensorInitializationStrategy(BootToZero);
+    // settings go through DragonFalcon so they are part of its ConfigAllSettings call
+    auto falcon = dynamic_cast<DragonFalcon*>(m_driveMotor.get());
+    if ( falcon != nullptr )
+    {
+        falcon->ConfigSelectedFeedbackSensor( ctre::phoenix::motorcontrol::FeedbackDevice::IntegratedSensor, 0, 10 );
+        falcon->ConfigIntegratedSensorInitializationStrategy(BootToZero);
+    }
     auto driveMotorSensors = fx->GetSensorCollection();
     driveMotorSensors.SetIntegratedSensorPosition(0, 0);
 
@@ -111,8 +122,12 @@ SwerveModule::SwerveModule
     // Set up the Turn Motor
     motor = m_turnMotor.get()->GetSpeedController();
     fx = dynamic_cast<WPI_TalonFX*>(motor.get());
-    fx->ConfigSelectedFeedbackSensor( ctre::phoenix::motorcontrol::FeedbackDevice::IntegratedSensor, 0, 10 );
-    fx->ConfigIntegratedSensorInitializationStrategy(BootToZero);
+    falcon = dynamic_cast<DragonFalcon*>(m_turnMotor.get());
+    if ( falcon != nullptr )
+    {
+        falcon->ConfigSelectedFeedbackSensor( ctre::phoenix::motorcontrol::FeedbackDevice::IntegratedSensor, 0, 10 );
+        falcon->ConfigIntegratedSensorInitializationStrategy(BootToZero);
+    }
     auto turnMotorSensors = fx->GetSensorCollection();
     turnMotorSensors.SetIntegratedSensorPosition(0, 0);
     auto turnCData = make_shared<ControlData>(  ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE,
@@ -153,8 +168,11 @@ SwerveModule::SwerveModule
             break;
     }
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "CurrentPoseX", to_string(m_currentPose.X().to<double>()));
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "CurrentPoseY", to_string(m_currentPose.Y().to<double>()));
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "CurrentPoseX", to_string(m_currentPose.X().to<double>()));
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "CurrentPoseY", to_string(m_currentPose.Y().to<double>()));
+    }
 }
 
 /// @brief initialize the swerve module with information that the swerve chassis knows about
@@ -222,16 +240,62 @@ void SwerveModule::ZeroAlignModule()
 }
 
 
+/// @brief Read this module's sensors into a snapshot
+/// @param [out] SwerveSnapshot&        snapshot:   snapshot to update (this module's entries)
+void SwerveModule::Sample
+(
+    SwerveSnapshot&     snapshot
+) const
+{
+    auto motor = m_turnMotor.get()->GetSpeedController();
+    auto fx = dynamic_cast<WPI_TalonFX*>(motor.get());
+
+    snapshot.driveVelocity[m_type] = m_driveMotor.get()->GetRPS();
+    snapshot.drivePosition[m_type] = m_driveMotor.get()->GetRotations();
+    snapshot.absoluteAngle[m_type] = m_turnSensor.get()->GetAbsolutePosition();
+    snapshot.turnPosition[m_type]  = fx->GetSensorCollection().GetIntegratedSensorPosition();
+}
+
+/// @brief drive wheel revolutions per second
+double SwerveModule::GetDriveVelocity() const
+{
+    return m_snapshot != nullptr ? m_snapshot->driveVelocity[m_type] : m_driveMotor.get()->GetRPS();
+}
+
+/// @brief drive wheel revolutions
+double SwerveModule::GetDrivePosition() const
+{
+    return m_snapshot != nullptr ? m_snapshot->drivePosition[m_type] : m_driveMotor.get()->GetRotations();
+}
+
+/// @brief CANCoder absolute position (degrees)
+double SwerveModule::GetAbsoluteAngle() const
+{
+    return m_snapshot != nullptr ? m_snapshot->absoluteAngle[m_type] : m_turnSensor.get()->GetAbsolutePosition();
+}
+
+/// @brief turn motor integrated sensor (counts)
+double SwerveModule::GetTurnPosition() const
+{
+    if (m_snapshot != nullptr)
+    {
+        return m_snapshot->turnPosition[m_type];
+    }
+    auto motor = m_turnMotor.get()->GetSpeedController();
+    auto fx = dynamic_cast<WPI_TalonFX*>(motor.get());
+    return fx->GetSensorCollection().GetIntegratedSensorPosition();
+}
+
 /// @brief Get the current state of the module (speed of the wheel and angle of the wheel)
 /// @returns SwerveModuleState
 SwerveModuleState SwerveModule::GetState() const 
 {
     // Get the Module Drive Motor Speed
     auto mpr = units::length::meter_t(GetWheelDiameter() * wpi::numbers::pi );               
-    auto mps = units::velocity::meters_per_second_t(mpr.to<double>() * m_driveMotor.get()->GetRPS());
+    auto mps = units::velocity::meters_per_second_t(mpr.to<double>() * GetDriveVelocity());
 
     // Get the Module Current Rotation Angle
-    Rotation2d angle {units::angle::degree_t(m_turnSensor.get()->GetAbsolutePosition())};
+    Rotation2d angle {units::angle::degree_t(GetAbsoluteAngle())};
 
     // Create the state and return it
     SwerveModuleState state{mps,angle};
@@ -251,7 +315,7 @@ void SwerveModule::SetDesiredState
     // If the desired angle is less than 90 degrees from the target angle (e.g., -90 to 90 is the amount of turn), just use the angle and speed values
     // if it is more than 90 degrees (90 to 270), the can turn the opposite direction -- increase the angle by 180 degrees -- and negate the wheel speed
     // finally, get the value between -90 and 90
-    Rotation2d currAngle = Rotation2d(units::angle::degree_t(m_turnSensor.get()->GetAbsolutePosition()));
+    Rotation2d currAngle = Rotation2d(units::angle::degree_t(GetAbsoluteAngle()));
    auto optimizedState = Optimize(targetState, currAngle);
    // auto optimizedState = SwerveModuleState::Optimize(targetState, currAngle);
    // auto optimizedState = targetState;
@@ -284,9 +348,12 @@ SwerveModuleState SwerveModule::Optimize
 
     auto delta = AngleUtils::GetDeltaAngle(currentAngle.Degrees(), optimizedState.angle.Degrees());
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "Optimize current", currentAngle.Degrees().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "Optimize target", optimizedState.angle.Degrees().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "Optimize delta", delta.to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "Optimize current", currentAngle.Degrees().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "Optimize target", optimizedState.angle.Degrees().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "Optimize delta", delta.to<double>());
+    }
     
     // deal with roll over issues (e.g. want to go from -180 degrees to 180 degrees or vice versa)
     // keep the current angle
@@ -301,18 +368,27 @@ SwerveModuleState SwerveModule::Optimize
     {
         optimizedState.speed *= -1.0;
         optimizedState.angle = optimizedState.angle + Rotation2d{180_deg};
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "Optimize reversing", delta.to<double>());
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "Optimize reversing", delta.to<double>());
+        }
     }
 
     // if the delta is > 90 degrees, rotate the opposite way and reverse the wheel
     if ((units::math::abs(delta) - 90_deg) > 0.1_deg) 
     {
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "optimized", (desiredState.angle + Rotation2d{180_deg}).Degrees().to<double>());
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "optimized", (desiredState.angle + Rotation2d{180_deg}).Degrees().to<double>());
+        }
         return {-desiredState.speed, desiredState.angle + Rotation2d{180_deg}};
     } 
     else 
     {
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "optimized", desiredState.angle.Degrees().to<double>());
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "optimized", desiredState.angle.Degrees().to<double>());
+        }
         return {desiredState.speed, desiredState.angle};
     }
 }
@@ -322,10 +398,97 @@ SwerveModuleState SwerveModule::Optimize
 void SwerveModule::RunCurrentState()
 {
     SetDriveSpeed(m_activeState.speed);
+    m_turnMotor.get()->StopMotor();
+}
 
-    auto motor = m_turnMotor.get()->GetSpeedController();
-    auto fx = dynamic_cast<WPI_TalonFX*>(motor.get());
-    fx->StopMotor();  
+/// @brief Convert the module's states into Talon trajectory points and start both motors' motion profiles.
+///        The Talons run the points themselves, so nothing has to be sent from the robot loops until it finishes.
+/// @param [in] const std::vector<frc::SwerveModuleState>& states:  state of the module every period
+/// @param [in] units::time::second_t                    period:  time between the states
+/// @returns bool true - both motors started their profiles
+bool SwerveModule::StartProfile
+(
+    const vector<SwerveModuleState>&    states,
+    units::time::second_t               period
+)
+{
+    auto driveFalcon = dynamic_cast<DragonFalcon*>(m_driveMotor.get());
+    auto turnFalcon  = dynamic_cast<DragonFalcon*>(m_turnMotor.get());
+    if ( driveFalcon == nullptr || turnFalcon == nullptr || states.empty() )
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, m_nt, string("StartProfile"), string("needs falcons and states"));
+        return false;
+    }
+
+    // the Talons have to stop reading the streams before they are rewritten
+    StopMotors();
+    m_driveProfile.Clear();
+    m_turnProfile.Clear();
+
+    // drive counts per meter, converted the same way as the SetDriveSpeed closed loop target
+    auto circumference  = units::length::meter_t(m_wheelDiameter).to<double>() * wpi::numbers::pi;
+    auto gearRatio      = m_driveMotor.get()->GetGearRatio();
+    auto countsPerMeter = ConversionUtils::RPSToCounts100ms(1.0 / (circumference * gearRatio), static_cast<int>(m_driveMotor.get()->GetCountsPerRev())) * gearRatio * 10.0;
+
+    auto driveFx = dynamic_cast<WPI_TalonFX*>(m_driveMotor.get()->GetSpeedController().get());
+    auto turnFx  = dynamic_cast<WPI_TalonFX*>(m_turnMotor.get()->GetSpeedController().get());
+    auto driveCounts = driveFx->GetSelectedSensorPosition();
+    auto turnCounts  = turnFx->GetSelectedSensorPosition();
+    Rotation2d angle {units::angle::degree_t(m_turnSensor.get()->GetAbsolutePosition())};
+
+    auto seconds = period.to<double>();
+    motion::TrajectoryPoint drivePoint;
+    motion::TrajectoryPoint turnPoint;
+    drivePoint.timeDur = static_cast<uint32_t>(units::time::millisecond_t(period).to<double>());
+    turnPoint.timeDur  = drivePoint.timeDur;
+
+    for ( size_t inx=0; inx<states.size(); ++inx )
+    {
+        // a stopped wheel keeps its angle instead of turning to the zero angle kinematics gives it
+        auto state = states[inx];
+        if ( abs(state.speed.to<double>()/m_maxVelocity.to<double>()) < 0.01 )
+        {
+            state.speed = 0_mps;
+            state.angle = angle;
+        }
+        state = Optimize(state, angle);
+        auto deltaAngle = AngleUtils::GetDeltaAngle(angle.Degrees(), state.angle.Degrees());
+        angle = state.angle;
+
+        //=============================================================================
+        // 5592 counts on the falcon for 76.729 degree change on the CANCoder (wheel)
+        //=============================================================================
+        auto deltaTicks = deltaAngle.to<double>() * 5592 / 76.729;
+        turnCounts += deltaTicks;
+        turnPoint.position    = turnCounts;
+        turnPoint.velocity    = deltaTicks / seconds / 10.0;      // counts per 100 ms
+        turnPoint.isLastPoint = inx+1 == states.size();
+
+        auto speed = state.speed.to<double>();
+        driveCounts += speed * seconds * countsPerMeter;
+        drivePoint.position    = driveCounts;
+        drivePoint.velocity    = speed * countsPerMeter / 10.0;   // counts per 100 ms
+        drivePoint.isLastPoint = turnPoint.isLastPoint;
+
+        m_driveProfile.Write(drivePoint);
+        m_turnProfile.Write(turnPoint);
+    }
+    m_activeState.speed = 0_mps;
+    m_activeState.angle = angle;
+
+    auto started = driveFalcon->StartMotionProfile(m_driveProfile, MIN_BUFFERED_POINTS);
+    started = turnFalcon->StartMotionProfile(m_turnProfile, MIN_BUFFERED_POINTS) && started;
+    return started;
+}
+
+/// @brief Have both motors run the last point of their profiles
+/// @returns bool true - finished
+bool SwerveModule::IsProfileFinished() const
+{
+    auto driveFalcon = dynamic_cast<DragonFalcon*>(m_driveMotor.get());
+    auto turnFalcon  = dynamic_cast<DragonFalcon*>(m_turnMotor.get());
+    return ( driveFalcon == nullptr || driveFalcon->IsMotionProfileFinished() ) &&
+           ( turnFalcon == nullptr  || turnFalcon->IsMotionProfileFinished() );
 }
 
 /// @brief run the drive motor at a specified speed
@@ -335,9 +498,12 @@ void SwerveModule::SetDriveSpeed( units::velocity::meters_per_second_t speed )
 {
     m_activeState.speed = ( abs(speed.to<double>()/m_maxVelocity.to<double>()) < 0.05 ) ? 0_mps : speed;
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("State Speed - mps"), m_activeState.speed.to<double>() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("Wheel Diameter - meters"), units::length::meter_t(m_wheelDiameter).to<double>() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("drive motor id"), m_driveMotor.get()->GetID() );
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "State Speed - mps", m_activeState.speed.to<double>() );
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "Wheel Diameter - meters", units::length::meter_t(m_wheelDiameter).to<double>() );
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "drive motor id", m_driveMotor.get()->GetID() );
+    }
 
     if (m_runClosedLoopDrive)
     {
@@ -345,18 +511,22 @@ void SwerveModule::SetDriveSpeed( units::velocity::meters_per_second_t speed )
         auto driveTarget = m_activeState.speed.to<double>() / (units::length::meter_t(m_wheelDiameter).to<double>() * wpi::numbers::pi);  
         driveTarget /= m_driveMotor.get()->GetGearRatio();
         
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("drive target - rps"), driveTarget );
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "drive target - rps", driveTarget );
+        }
         
-        m_driveMotor.get()->SetControlMode(ControlModes::CONTROL_TYPE::VELOCITY_RPS);
-        m_driveMotor.get()->Set(m_nt, driveTarget);
+        m_driveMotor.get()->Set(VelocityRps(driveTarget));
     }
     else
     {
         double percent = m_activeState.speed / m_maxVelocity;
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("drive target - percent"), percent );
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "drive target - percent", percent );
+        }
 
-        m_driveMotor.get()->SetControlMode(ControlModes::CONTROL_TYPE::PERCENT_OUTPUT);
-        m_driveMotor.get()->Set(m_nt, percent);
+        m_driveMotor.get()->Set(PercentOut(percent));
     }
 }
 
@@ -367,38 +537,42 @@ void SwerveModule::SetTurnAngle( units::angle::degree_t targetAngle )
 {
     m_activeState.angle = targetAngle;
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("turn motor id"), m_turnMotor.get()->GetID() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("target angle"), targetAngle.to<double>() );
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "turn motor id", m_turnMotor.get()->GetID() );
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "target angle", targetAngle.to<double>() );
+    }
 
-    auto currAngle  = units::angle::degree_t(m_turnSensor.get()->GetAbsolutePosition());
+    auto currAngle  = units::angle::degree_t(GetAbsoluteAngle());
     auto deltaAngle = AngleUtils::GetDeltaAngle(currAngle, targetAngle);
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("current angle"), currAngle.to<double>() );
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("delta angle"), deltaAngle.to<double>() );
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "current angle", currAngle.to<double>() );
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "delta angle", deltaAngle.to<double>() );
+    }
 
     if ( abs(deltaAngle.to<double>()) > 1.0 )
     {
-        auto motor = m_turnMotor.get()->GetSpeedController();
-        auto fx = dynamic_cast<WPI_TalonFX*>(motor.get());
-        auto sensors = fx->GetSensorCollection();
         //=============================================================================
         // 5592 counts on the falcon for 76.729 degree change on the CANCoder (wheel)
         //=============================================================================
         double deltaTicks = (deltaAngle.to<double>() * 5592 / 76.729); 
-        double currentTicks = sensors.GetIntegratedSensorPosition();
+        double currentTicks = GetTurnPosition();
         double desiredTicks = currentTicks + deltaTicks;
 
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("currentTicks"), currentTicks );
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("deltaTicks"), deltaTicks );
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("desiredTicks"), desiredTicks );
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "currentTicks", currentTicks );
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "deltaTicks", deltaTicks );
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "desiredTicks", desiredTicks );
+        }
 
-        m_turnMotor.get()->SetControlMode(ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE);
-        m_turnMotor.get()->Set(m_nt, desiredTicks);
+        m_turnMotor.get()->Set(PositionTicks(desiredTicks));
     }
     else
     {
-        m_turnMotor.get()->SetControlMode(ControlModes::CONTROL_TYPE::PERCENT_OUTPUT);
-        m_turnMotor.get()->Set(m_nt, 0.0);
+        m_turnMotor.get()->Set(PercentOut(0.0));
     }
 
 }
@@ -407,8 +581,8 @@ void SwerveModule::SetTurnAngle( units::angle::degree_t targetAngle )
 /// @return void
 void SwerveModule::StopMotors()
 {
-    m_turnMotor.get()->GetSpeedController()->StopMotor();
-    m_driveMotor.get()->GetSpeedController()->StopMotor();
+    m_turnMotor.get()->StopMotor();
+    m_driveMotor.get()->StopMotor();
 }
 
 frc::Pose2d SwerveModule::GetCurrentPose(PoseEstimatorEnum opt)
@@ -421,8 +595,8 @@ frc::Pose2d SwerveModule::GetCurrentPose(PoseEstimatorEnum opt)
 
     // read sensor info (cancoder, encoders) for current speed and angle of the module
     // calculate the average from the last 
-    auto currentAngle   = units::angle::radian_t(units::angle::degree_t(m_turnSensor.get()->GetPosition()));
-    auto currentRotations = m_driveMotor.get()->GetRotations();
+    auto currentAngle   = units::angle::radian_t(units::angle::degree_t(GetAbsoluteAngle()));
+    auto currentRotations = GetDrivePosition();
 
     units::length::meter_t currentX {units::length::meter_t(0)};
     units::length::meter_t currentY {units::length::meter_t(0)};
@@ -441,16 +615,19 @@ frc::Pose2d SwerveModule::GetCurrentPose(PoseEstimatorEnum opt)
         currentX = startX + cos(startAngle.to<double>()) * circum;
         currentY = startY + sin(startAngle.to<double>()) * circum;
 
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "start rotations",startRotations);
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "current rotations",currentRotations);
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "delta", delta);
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "circumference", circum.to<double>());
-
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "WheelDiameter", m_wheelDiameter.to<double>());
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "CurrentX", currentX.to<double>());
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "CurrentY", currentY.to<double>());
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "startX", startX.to<double>());
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "startY", startY.to<double>());
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "start rotations",startRotations);
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "current rotations",currentRotations);
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "delta", delta);
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "circumference", circum.to<double>());
+
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "WheelDiameter", m_wheelDiameter.to<double>());
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "CurrentX", currentX.to<double>());
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "CurrentY", currentY.to<double>());
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "startX", startX.to<double>());
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "startY", startY.to<double>());
+        }
     }
     else if (opt == PoseEstimatorEnum::POSE_EST_USING_MODULES)
     {
@@ -492,10 +669,13 @@ frc::Pose2d SwerveModule::GetCurrentPose(PoseEstimatorEnum opt)
     auto trans   = newpose - m_currentPose;
     m_currentPose = m_currentPose + trans;
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "NewPoseX", newpose.X().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "NewPoseY", newpose.Y().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "TransX", trans.X().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "TransY", trans.Y().to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "NewPoseX", newpose.X().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "NewPoseY", newpose.Y().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "TransX", trans.X().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "TransY", trans.Y().to<double>());
+    }
 
     m_currentRotations = currentRotations;
     return m_currentPose;
@@ -507,5 +687,5 @@ void SwerveModule::UpdateCurrPose
     units::length::meter_t  y
 )
 {
-    m_currentPose = m_currentPose + Transform2d{Translation2d{x,y}, Rotation2d{units::angle::degree_t(m_turnSensor.get()->GetPosition())}};
+    m_currentPose = m_currentPose + Transform2d{Translation2d{x,y}, Rotation2d{units::angle::degree_t(GetAbsoluteAngle())}};
 }
\ No newline at end of file
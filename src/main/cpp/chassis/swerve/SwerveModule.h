@@ -19,6 +19,7 @@
 //C++ Includes
 #include <memory>
 #include <string>
+#include <vector>
 
 // FRC Includes
 #include <frc/Encoder.h>
@@ -37,10 +38,12 @@
 
 // Team 302 Includes
 #include <chassis/PoseEstimatorEnum.h>
+#include <chassis/swerve/SwerveSnapshot.h>
 #include <hw/DragonFalcon.h>
 #include <hw/interfaces/IDragonMotorController.h>
 
 // Third Party Includes
+#include <ctre/phoenix/motion/BufferedTrajectoryPointStream.h>
 #include <ctre/phoenix/sensors/CANCoder.h>
 
 
@@ -96,6 +99,14 @@ class SwerveModule
         /// @returns
         double GetEncoderValues();
 
+        /// @brief Use the chassis snapshot for the sensor values instead of reading them each time
+        /// @param [in] const SwerveSnapshot*   snapshot:   snapshot the chassis samples every cycle (nullptr - read the sensors)
+        void SetSnapshot( const SwerveSnapshot* snapshot ) { m_snapshot = snapshot; }
+
+        /// @brief Read this module's sensors into a snapshot
+        /// @param [out] SwerveSnapshot&        snapshot:   snapshot to update (this module's entries)
+        void Sample( SwerveSnapshot& snapshot ) const;
+
         /// @brief Get the current state of the module (speed of the wheel and angle of the wheel)
         /// @returns SwerveModuleState
         frc::SwerveModuleState GetState() const;
@@ -107,6 +118,21 @@ class SwerveModule
 
         void RunCurrentState();
 
+        /// @brief Convert the module's states into Talon trajectory points and start both motors' motion profiles.
+        ///        The Talons run the points themselves, so nothing has to be sent from the robot loops until it finishes.
+        /// @param [in] const std::vector<frc::SwerveModuleState>& states:  state of the module every period
+        /// @param [in] units::time::second_t                    period:  time between the states
+        /// @returns bool true - both motors started their profiles
+        bool StartProfile
+        (
+            const std::vector<frc::SwerveModuleState>&  states,
+            units::time::second_t                       period
+        );
+
+        /// @brief Have both motors run the last point of their profiles
+        /// @returns bool true - finished
+        bool IsProfileFinished() const;
+
         /// @brief Return which module this is
         /// @returns ModuleID
         ModuleID GetType() {return m_type;}
@@ -135,6 +161,14 @@ class SwerveModule
         void SetDriveSpeed( units::velocity::meters_per_second_t speed );
         void SetTurnAngle( units::angle::degree_t angle );
 
+        // sensor values from the snapshot (or the sensors when there isn't one)
+        double GetDriveVelocity() const;
+        double GetDrivePosition() const;
+        double GetAbsoluteAngle() const;
+        double GetTurnPosition() const;
+
+
+        static constexpr uint32_t MIN_BUFFERED_POINTS = 10;    // points in the Talon before the profile starts
 
         ModuleID                                            m_type;
 
@@ -155,4 +189,7 @@ class SwerveModule
 
         units::velocity::meters_per_second_t                m_maxVelocity;
         bool                                                m_runClosedLoopDrive;
+        const SwerveSnapshot*                               m_snapshot;
+        ctre::phoenix::motion::BufferedTrajectoryPointStream  m_driveProfile;   // must outlive the profile the Talon is running
+        ctre::phoenix::motion::BufferedTrajectoryPointStream  m_turnProfile;
 };
\ No newline at end of file
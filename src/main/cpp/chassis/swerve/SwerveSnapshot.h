@@ -0,0 +1,54 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// SwerveSnapshot.h
+//========================================================================================================
+///
+/// File Description:
+///     The swerve module sensor values for one control cycle.  SwerveChassis reads all four modules
+///     once at the start of a cycle and every module calculation in that cycle (optimize, turn
+///     target, module states for odometry and chassis speeds) uses the same values, instead of
+///     each one going back to the CAN bus.
+///
+///     Each array is indexed by SwerveModule::ModuleID.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <cstdint>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+struct SwerveSnapshot
+{
+    static constexpr int MODULES = 4;
+
+    std::array<double, MODULES>     driveVelocity;      ///< drive wheel revolutions per second (IDragonMotorController::GetRPS)
+    std::array<double, MODULES>     drivePosition;      ///< drive wheel revolutions (IDragonMotorController::GetRotations)
+    std::array<double, MODULES>     absoluteAngle;      ///< CANCoder absolute position (degrees, -180 to 180)
+    std::array<double, MODULES>     turnPosition;       ///< turn motor integrated sensor (counts)
+    uint64_t                        time;               ///< FPGA time (microseconds) when the modules were read
+};
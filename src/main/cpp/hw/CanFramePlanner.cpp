@@ -0,0 +1,380 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// CanFramePlanner.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Plans the CTRE status frame periods to keep the CAN bus within its budget
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+// FRC includes
+#include <frc/RobotController.h>
+#include <networktables/NetworkTable.h>
+#include <networktables/NetworkTableEntry.h>
+#include <networktables/NetworkTableInstance.h>
+
+// Team 302 includes
+#include <hw/CanFramePlanner.h>
+#include <utils/Logger.h>
+
+// Third Party Includes
+#include <ctre/phoenix/motorcontrol/ControlFrame.h>
+#include <ctre/phoenix/motorcontrol/StatusFrame.h>
+#include <ctre/phoenix/sensors/CANCoderStatusFrame.h>
+#include <ctre/phoenix/sensors/PigeonIMU_StatusFrame.h>
+
+using namespace std;
+using namespace ctre::phoenix::motorcontrol;
+using namespace ctre::phoenix::sensors;
+
+namespace
+{
+    constexpr const char* TABLE_NAME = "CAN Frame Planner";
+    constexpr int TALON_MAX_PERIOD = 255;       // DragonFalcon / DragonTalonSRX::UpdateFramePeriods takes a uint8_t
+}
+
+/// @brief Find or create the planner
+/// @returns CanFramePlanner* pointer to the planner
+CanFramePlanner* CanFramePlanner::m_instance = nullptr;
+CanFramePlanner* CanFramePlanner::GetInstance()
+{
+    if ( CanFramePlanner::m_instance == nullptr )
+    {
+        CanFramePlanner::m_instance = new CanFramePlanner();
+    }
+    return CanFramePlanner::m_instance;
+}
+
+CanFramePlanner::CanFramePlanner() : m_mutex(),
+                                     m_devices(),
+                                     m_budget(DEFAULT_BUDGET),
+                                     m_estimate(0.0),
+                                     m_started(false),
+                                     m_budgetEntry(),
+                                     m_estimateEntry(),
+                                     m_measuredEntry(),
+                                     m_overBudgetEntry(),
+                                     m_lastPublish(0)
+{
+    auto table = nt::NetworkTableInstance::GetDefault().GetTable(TABLE_NAME);
+    m_budgetEntry = table->GetEntry("budget (%)");
+    m_budgetEntry.SetDefaultDouble(DEFAULT_BUDGET * 100.0);
+    m_estimateEntry = table->GetEntry("estimated utilization (%)");
+    m_measuredEntry = table->GetEntry("measured utilization (%)");
+    m_overBudgetEntry = table->GetEntry("over budget");
+    m_devices.reserve(32);
+}
+
+/// @brief frames each device type sends:  id, configurable, factory period, HIGH / MEDIUM / LOW periods, maximum period.
+///        The factory periods are approximate (CTRE documentation); they only matter for the estimate.
+const vector<CanFramePlanner::FrameInfo>& CanFramePlanner::GetFrames
+(
+    DEVICE_TYPE     type
+)
+{
+    static const vector<FrameInfo> talonFX =
+    {
+        { StatusFrameEnhanced::Status_1_General,             true,  10, {  10,  60, 120 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_2_Feedback0,           true,  20, {  20, 120, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_3_Quadrature,          true, 160, { 100, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_4_AinTempVbat,         true, 160, { 150, 200, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_8_PulseWidth,          true, 160, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_10_Targets,            true, 160, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_11_UartGadgeteer,      true, 250, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_12_Feedback1,          true, 250, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_13_Base_PIDF0,         true, 160, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_14_Turn_PIDF1,         true, 250, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_15_FirmareApiStatus,   true, 160, { 200, 200, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_Brushless_Current,     true,  50, { 200, 200, 200 }, TALON_MAX_PERIOD },
+        { ControlFrame::Control_3_General,                   false, 10, {  10,  10,  10 }, 10 }
+    };
+    static const vector<FrameInfo> talonSRX =
+    {
+        { StatusFrameEnhanced::Status_1_General,             true,  10, {  10,  20,  30 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_2_Feedback0,           true,  20, {  20,  30, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_3_Quadrature,          true, 160, { 100, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_4_AinTempVbat,         true, 160, { 150, 200, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_8_PulseWidth,          true, 160, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_10_Targets,            true, 160, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_11_UartGadgeteer,      true, 250, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_12_Feedback1,          true, 250, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_13_Base_PIDF0,         true, 160, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_14_Turn_PIDF1,         true, 250, { 120, 150, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_15_FirmareApiStatus,   true, 160, { 200, 200, 200 }, TALON_MAX_PERIOD },
+        { StatusFrameEnhanced::Status_Brushless_Current,     true,  50, { 200, 200, 200 }, TALON_MAX_PERIOD },
+        { ControlFrame::Control_3_General,                   false, 10, {  10,  10,  10 }, 10 }
+    };
+    static const vector<FrameInfo> cancoder =
+    {
+        { CANCoderStatusFrame::CANCoderStatusFrame_SensorData,      true,  10, {  10,  20, 100 }, 255 },
+        { CANCoderStatusFrame::CANCoderStatusFrame_VbatAndFaults,   true, 100, { 100, 200, 255 }, 255 }
+    };
+    static const vector<FrameInfo> pigeon =
+    {
+        { PigeonIMU_StatusFrame::PigeonIMU_CondStatus_1_General,        false, 10, {  10,  10,  10 },  10 },
+        { PigeonIMU_StatusFrame::PigeonIMU_CondStatus_9_SixDeg_YPR,     false, 10, {  10,  10,  10 },  10 },
+        { PigeonIMU_StatusFrame::PigeonIMU_BiasedStatus_4_Mag,          true,  20, { 120, 200, 255 }, 255 },
+        { PigeonIMU_StatusFrame::PigeonIMU_CondStatus_11_GyroAccum,     true,  20, { 120, 200, 255 }, 255 },
+        { PigeonIMU_StatusFrame::PigeonIMU_BiasedStatus_6_Accel,        true,  20, { 120, 200, 255 }, 255 }     // using fused heading not yaw
+    };
+
+    switch ( type )
+    {
+        case DEVICE_TYPE::TALON_FX:
+            return talonFX;
+
+        case DEVICE_TYPE::TALON_SRX:
+            return talonSRX;
+
+        case DEVICE_TYPE::CANCODER:
+            return cancoder;
+
+        default:
+            return pigeon;
+    }
+}
+
+const char* CanFramePlanner::GetPriorityName
+(
+    FRAME_PRIORITY  priority
+)
+{
+    switch ( priority )
+    {
+        case FRAME_PRIORITY::HIGH:
+            return "HIGH";
+
+        case FRAME_PRIORITY::MEDIUM:
+            return "MEDIUM";
+
+        default:
+            return "LOW";
+    }
+}
+
+/// @brief Add a device (counted at its factory periods until it has a priority)
+/// @param [in] const std::string&: name (e.g. "DragonFalcon 5")
+/// @param [in] DEVICE_TYPE: selects the frame table
+/// @param [in] std::function<void(int, int)>: sets a frame's period (CTRE frame enum value, milliseconds)
+/// @returns int: handle to pass to SetPriority
+int CanFramePlanner::Register
+(
+    const string&                   name,
+    DEVICE_TYPE                     type,
+    function<void(int, int)>        setPeriod
+)
+{
+    Device device;
+    device.name = name;
+    device.frames = &GetFrames(type);
+    device.setPeriod = setPeriod;
+    device.hasPriority = false;
+    device.priority = FRAME_PRIORITY::LOW;
+    device.planned.assign(device.frames->size(), 0);
+    device.sent.assign(device.frames->size(), 0);
+
+    auto table = nt::NetworkTableInstance::GetDefault().GetTable(TABLE_NAME)->GetSubTable(name);
+    device.framesEntry = table->GetEntry("frames per second");
+    device.priorityEntry = table->GetEntry("priority");
+
+    lock_guard<mutex> lock(m_mutex);
+    m_devices.emplace_back(std::move(device));
+    Plan();
+    return static_cast<int>(m_devices.size()) - 1;
+}
+
+/// @brief Change a device's priority and plan again
+/// @param [in] int: handle from Register
+/// @param [in] FRAME_PRIORITY: priority
+void CanFramePlanner::SetPriority
+(
+    int                             handle,
+    FRAME_PRIORITY                  priority
+)
+{
+    lock_guard<mutex> lock(m_mutex);
+    if ( handle < 0 || handle >= static_cast<int>(m_devices.size()) )
+    {
+        return;
+    }
+
+    auto& device = m_devices[handle];
+    if ( device.hasPriority && device.priority == priority )
+    {
+        return;
+    }
+    device.hasPriority = true;
+    device.priority = priority;
+    Plan();
+    if ( m_started )
+    {
+        Send();
+    }
+}
+
+/// @brief Plan and send every device's periods; afterwards priority changes are sent right away
+void CanFramePlanner::Start()
+{
+    lock_guard<mutex> lock(m_mutex);
+    m_started = true;
+    Plan();
+    Send();
+
+    auto msg = to_string(m_devices.size());
+    msg += " devices, estimated utilization ";
+    msg += to_string(static_cast<int>(lround(m_estimate * 100.0)));
+    msg += "%";
+    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("CanFramePlanner"), string("Start"), msg);
+}
+
+/// @returns double: estimated bus utilization of the current plan (0.0 to 1.0)
+double CanFramePlanner::GetEstimatedUtilization()
+{
+    lock_guard<mutex> lock(m_mutex);
+    return m_estimate;
+}
+
+/// @brief Start every device at its priority's periods, then slow down the LOW and then the MEDIUM
+///        devices until the estimate is within the budget.  Holding m_mutex.
+void CanFramePlanner::Plan()
+{
+    for ( auto& device : m_devices )
+    {
+        for ( size_t inx=0; inx<device.frames->size(); ++inx )
+        {
+            auto& frame = (*device.frames)[inx];
+            device.planned[inx] = ( device.hasPriority && frame.configurable ) ? frame.periods[device.priority] : frame.factory;
+        }
+    }
+    m_estimate = Estimate();
+
+    for ( auto level : { FRAME_PRIORITY::LOW, FRAME_PRIORITY::MEDIUM } )
+    {
+        auto stretched = true;
+        while ( m_estimate > m_budget && stretched )
+        {
+            stretched = false;
+            for ( auto& device : m_devices )
+            {
+                if ( !device.hasPriority || device.priority != level )
+                {
+                    continue;
+                }
+                for ( size_t inx=0; inx<device.frames->size(); ++inx )
+                {
+                    auto& frame = (*device.frames)[inx];
+                    if ( frame.configurable && device.planned[inx] < frame.maximum )
+                    {
+                        device.planned[inx] = min( frame.maximum, static_cast<int>(ceil(device.planned[inx] * STRETCH)) );
+                        stretched = true;
+                    }
+                }
+            }
+            m_estimate = Estimate();
+        }
+    }
+
+    if ( m_started && m_estimate > m_budget )
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("CanFramePlanner"), string("Plan"), string("over budget with only the HIGH devices at full rate"));
+    }
+}
+
+/// @brief Send the periods that changed.  Holding m_mutex.
+void CanFramePlanner::Send()
+{
+    for ( auto& device : m_devices )
+    {
+        if ( !device.hasPriority || !device.setPeriod )
+        {
+            continue;
+        }
+        for ( size_t inx=0; inx<device.frames->size(); ++inx )
+        {
+            auto& frame = (*device.frames)[inx];
+            if ( frame.configurable && device.planned[inx] != device.sent[inx] )
+            {
+                device.setPeriod( frame.id, device.planned[inx] );
+                device.sent[inx] = device.planned[inx];
+            }
+        }
+    }
+}
+
+/// @returns double: estimated utilization of the planned periods.  Holding m_mutex.
+double CanFramePlanner::Estimate() const
+{
+    auto framesPerSecond = 0.0;
+    for ( auto& device : m_devices )
+    {
+        framesPerSecond += GetFramesPerSecond( device );
+    }
+    return framesPerSecond * FRAME_BITS / BUS_BITS_PER_SECOND;
+}
+
+double CanFramePlanner::GetFramesPerSecond
+(
+    const Device&   device
+)
+{
+    auto framesPerSecond = 0.0;
+    for ( auto period : device.planned )
+    {
+        framesPerSecond += period > 0 ? 1000.0 / period : 0.0;
+    }
+    return framesPerSecond;
+}
+
+/// @brief Publish the estimate every PUBLISH_PERIOD and check for a new budget (call once per loop)
+void CanFramePlanner::PeriodicPublish()
+{
+    auto now = frc::RobotController::GetFPGATime();
+    if ( now - m_lastPublish < PUBLISH_PERIOD )
+    {
+        return;
+    }
+    m_lastPublish = now;
+
+    lock_guard<mutex> lock(m_mutex);
+    auto budget = clamp( m_budgetEntry.GetDouble(DEFAULT_BUDGET * 100.0), 10.0, 100.0 ) / 100.0;
+    if ( abs(budget - m_budget) > 0.001 )
+    {
+        m_budget = budget;
+        Plan();
+        if ( m_started )
+        {
+            Send();
+        }
+    }
+
+    m_estimateEntry.SetDouble( m_estimate * 100.0 );
+    m_measuredEntry.SetDouble( frc::RobotController::GetCANStatus().percentBusUtilization * 100.0 );
+    m_overBudgetEntry.SetBoolean( m_estimate > m_budget );
+    for ( auto& device : m_devices )
+    {
+        device.framesEntry.SetDouble( GetFramesPerSecond( device ) );
+        device.priorityEntry.SetString( device.hasPriority ? GetPriorityName( device.priority ) : "factory" );
+    }
+}
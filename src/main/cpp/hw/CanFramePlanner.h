@@ -0,0 +1,177 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// CanFramePlanner.h
+//========================================================================================================
+///
+/// File Description:
+///     Picks the status frame periods for every CTRE device on the CAN bus so that the estimated bus
+///     utilization stays within a budget.
+///
+///     Each device registers the frames it sends (a table for its type) and a function that sets a
+///     frame's period.  A device with a priority gets that priority's periods (the tables that were in
+///     DragonFalcon / DragonTalonSRX::SetFramePeriodPriority); a device without one is counted at the
+///     factory periods and left alone.  When the estimate is over the budget, the LOW and then the
+///     MEDIUM devices' frames are slowed down (up to each frame's maximum).  HIGH devices are never
+///     slowed down.
+///
+///         // constructor
+///         m_framePlan = CanFramePlanner::GetInstance()->Register(name, CanFramePlanner::DEVICE_TYPE::TALON_FX,
+///                           [this](int frame, int periodMs) { ... SetStatusFramePeriod ... });
+///         // mechanism construction or a state change (e.g. intake extending / idle)
+///         CanFramePlanner::GetInstance()->SetPriority(m_framePlan, CanFramePlanner::FRAME_PRIORITY::LOW);
+///
+///     Nothing is sent until Start is called (RobotInit, once every device is built); after that a
+///     priority change plans again and only the periods that changed are sent.
+///
+///     The estimate counts every frame (status frames and the control frames the robot sends) as
+///     FRAME_BITS bits.  The estimate, the measured utilization and each device's frames per second
+///     are published to the "CAN Frame Planner" network table once a second; "budget (%)" can be
+///     changed there.
+///
+///     Register / SetPriority may be called from the state manager threads.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <networktables/NetworkTableEntry.h>
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+class CanFramePlanner
+{
+    public:
+        enum DEVICE_TYPE
+        {
+            TALON_FX,
+            TALON_SRX,
+            CANCODER,
+            PIGEON,
+            MAX_DEVICE_TYPES
+        };
+
+        enum FRAME_PRIORITY
+        {
+            HIGH,
+            MEDIUM,
+            LOW,
+            MAX_PRIORITIES
+        };
+
+        /// @brief Find or create the planner
+        /// @returns CanFramePlanner* pointer to the planner
+        static CanFramePlanner* GetInstance();
+
+        /// @brief Add a device (counted at its factory periods until it has a priority)
+        /// @param [in] const std::string&: name (e.g. "DragonFalcon 5")
+        /// @param [in] DEVICE_TYPE: selects the frame table
+        /// @param [in] std::function<void(int, int)>: sets a frame's period (CTRE frame enum value, milliseconds)
+        /// @returns int: handle to pass to SetPriority
+        int Register
+        (
+            const std::string&                  name,
+            DEVICE_TYPE                         type,
+            std::function<void(int, int)>       setPeriod
+        );
+
+        /// @brief Change a device's priority and plan again
+        /// @param [in] int: handle from Register
+        /// @param [in] FRAME_PRIORITY: priority
+        void SetPriority
+        (
+            int                                 handle,
+            FRAME_PRIORITY                      priority
+        );
+
+        /// @brief Plan and send every device's periods; afterwards priority changes are sent right away
+        void Start();
+
+        /// @returns double: estimated bus utilization of the current plan (0.0 to 1.0)
+        double GetEstimatedUtilization();
+
+        /// @brief Publish the estimate every PUBLISH_PERIOD and check for a new budget (call once per loop)
+        void PeriodicPublish();
+
+    private:
+        CanFramePlanner();
+        ~CanFramePlanner() = default;
+
+        static constexpr double   FRAME_BITS = 150.0;         // 8 byte extended frame with typical bit stuffing
+        static constexpr double   BUS_BITS_PER_SECOND = 1000000.0;
+        static constexpr double   DEFAULT_BUDGET = 0.70;
+        static constexpr double   STRETCH = 1.5;              // slow a frame down by this much per step
+        static constexpr uint64_t PUBLISH_PERIOD = 1000000;   // microseconds
+
+        /// @struct FrameInfo
+        /// @brief  one frame a device type sends and its periods (milliseconds)
+        struct FrameInfo
+        {
+            int         id;                 // CTRE frame enum value
+            bool        configurable;       // false - counted but never sent (e.g. control frames)
+            int         factory;
+            int         periods[MAX_PRIORITIES];
+            int         maximum;
+        };
+
+        /// @struct Device
+        struct Device
+        {
+            std::string                         name;
+            const std::vector<FrameInfo>*       frames;
+            std::function<void(int, int)>       setPeriod;
+            bool                                hasPriority;
+            FRAME_PRIORITY                      priority;
+            std::vector<int>                    planned;    // milliseconds
+            std::vector<int>                    sent;       // milliseconds (0 - not sent yet)
+            nt::NetworkTableEntry               framesEntry;
+            nt::NetworkTableEntry               priorityEntry;
+        };
+
+        static const std::vector<FrameInfo>& GetFrames( DEVICE_TYPE type );
+        static const char* GetPriorityName( FRAME_PRIORITY priority );
+
+        void Plan();
+        void Send();
+        double Estimate() const;
+        static double GetFramesPerSecond( const Device& device );
+
+        static CanFramePlanner*         m_instance;
+
+        std::mutex                      m_mutex;
+        std::vector<Device>             m_devices;
+        double                          m_budget;
+        double                          m_estimate;
+        bool                            m_started;
+        nt::NetworkTableEntry           m_budgetEntry;
+        nt::NetworkTableEntry           m_estimateEntry;
+        nt::NetworkTableEntry           m_measuredEntry;
+        nt::NetworkTableEntry           m_overBudgetEntry;
+        uint64_t                        m_lastPublish;  // FPGA time (microseconds)
+};
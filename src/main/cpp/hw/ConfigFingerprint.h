@@ -0,0 +1,137 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// ConfigFingerprint.h
+//========================================================================================================
+///
+/// File Description:
+///     Lets a CTRE device skip its full configuration after a code restart when nothing changed.
+///     The hash of the device's settings (the configuration's toString) is kept in the device's two
+///     custom parameters, which are persistent and are cleared by a factory default:
+///
+///         auto fingerprint = ConfigFingerprint::Compute(config.toString());
+///         if (!ConfigFingerprint::Matches(*device, fingerprint, timeout))
+///         {
+///             // ConfigFactoryDefault + ConfigAllSettings (customParam0/1 left at 0)
+///             ConfigFingerprint::Store(*device, fingerprint, timeout);   // only when every call worked
+///         }
+///
+///     Checking costs two parameter reads instead of the factory default and every setting.  Store
+///     is only called once the whole configuration was sent, so a restart part way through
+///     configures the device again.  A setting sent after the configuration was applied has to
+///     Clear the fingerprint, since the device no longer has the settings it describes.
+///
+///     toString prints doubles with 6 decimals, so smaller changes (a tiny kF) don't change the
+///     fingerprint; bump VERSION or factory default the device when that matters.
+///
+///     Works with anything that has ConfigGetCustomParam / ConfigSetCustomParam (motor controllers,
+///     CANCoder, Pigeon).
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+#include <string_view>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/HashUtils.h>
+
+// Third Party Includes
+#include <ctre/phoenix/ErrorCode.h>
+
+
+class ConfigFingerprint
+{
+    public:
+        ConfigFingerprint() = delete;
+        ~ConfigFingerprint() = delete;
+
+        /// @brief Hash a device's settings
+        /// @param [in] std::string_view: every setting (the configuration's toString)
+        /// @returns uint64_t: fingerprint (never 0, which means "not configured")
+        static uint64_t Compute
+        (
+            std::string_view                settings
+        )
+        {
+            auto fingerprint = HashUtils::Hash(settings, HashUtils::HashValue(VERSION));
+            return fingerprint == 0 ? 1 : fingerprint;
+        }
+
+        /// @brief Determine if a device already has the settings
+        /// @param [in] DEVICE&: CTRE device
+        /// @param [in] uint64_t: fingerprint from Compute
+        /// @param [in] int: timeout for each read (milliseconds)
+        /// @returns bool: true - the stored fingerprint matches, false - configure the device
+        template <typename DEVICE>
+        static bool Matches
+        (
+            DEVICE&                         device,
+            uint64_t                        fingerprint,
+            int                             timeoutMs
+        )
+        {
+            auto low = device.ConfigGetCustomParam(0, timeoutMs);
+            if (low != static_cast<int>(static_cast<uint32_t>(fingerprint)) || device.GetLastError() != ctre::phoenix::ErrorCode::OKAY)
+            {
+                return false;
+            }
+            auto high = device.ConfigGetCustomParam(1, timeoutMs);
+            return high == static_cast<int>(static_cast<uint32_t>(fingerprint >> 32)) && device.GetLastError() == ctre::phoenix::ErrorCode::OKAY;
+        }
+
+        /// @brief Save the fingerprint on the device (after the whole configuration was sent)
+        /// @param [in] DEVICE&: CTRE device
+        /// @param [in] uint64_t: fingerprint from Compute
+        /// @param [in] int: timeout for each write (milliseconds)
+        /// @returns bool: true - saved
+        template <typename DEVICE>
+        static bool Store
+        (
+            DEVICE&                         device,
+            uint64_t                        fingerprint,
+            int                             timeoutMs
+        )
+        {
+            auto error = device.ConfigSetCustomParam(static_cast<int>(static_cast<uint32_t>(fingerprint >> 32)), 1, timeoutMs);
+            if (error == ctre::phoenix::ErrorCode::OKAY)
+            {
+                error = device.ConfigSetCustomParam(static_cast<int>(static_cast<uint32_t>(fingerprint)), 0, timeoutMs);
+            }
+            return error == ctre::phoenix::ErrorCode::OKAY;
+        }
+
+        /// @brief Forget the fingerprint, so the next restart configures the device
+        /// @param [in] DEVICE&: CTRE device
+        template <typename DEVICE>
+        static void Clear
+        (
+            DEVICE&                         device
+        )
+        {
+            device.ConfigSetCustomParam(0, 0, 0);
+        }
+
+    private:
+        /// @brief change when something that isn't in toString changes what the devices are sent
+        static constexpr uint32_t VERSION = 1;
+};
@@ -0,0 +1,114 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// ControlSlots.h
+//========================================================================================================
+///
+/// File Description:
+///     Keeps track of which PID gains are in each of a Talon's four hardware slots.  The mechanism
+///     states preload their control data when they are created, so entering a state only selects
+///     the slot its gains are in instead of sending the gains again.  When a motor has more than
+///     four sets of gains, the extra sets replace the gains in the slot the caller asked for.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+
+// FRC includes
+
+// Team 302 includes
+#include <mechanisms/controllers/ControlData.h>
+
+// Third Party Includes
+
+
+class ControlSlots
+{
+    public:
+        static constexpr int NUMBER_OF_SLOTS = 4;
+
+        ControlSlots() : m_gains(), m_selected(-1)
+        {
+        }
+
+        /// @brief  Find the slot that holds the control data's gains
+        /// @param [in] const ControlData*  control:  control constants
+        /// @return int slot (-1 - the gains aren't in a slot)
+        int Find
+        (
+            const ControlData*  control
+        ) const
+        {
+            for ( auto slot=0; slot<NUMBER_OF_SLOTS; ++slot )
+            {
+                auto& gains = m_gains[slot];
+                if ( gains.used && gains.p == control->GetP() && gains.i == control->GetI() && 
+                     gains.d == control->GetD() && gains.f == control->GetF() )
+                {
+                    return slot;
+                }
+            }
+            return -1;
+        }
+
+        /// @brief  Pick a slot for the control data's gains (the caller sends them to the controller)
+        /// @param [in] const ControlData*  control:        control constants
+        /// @param [in] int                 fallbackSlot:   slot to reuse when all of them are in use (-1 - don't reuse one)
+        /// @return int slot (-1 - all of the slots are in use and there isn't a fallback)
+        int Assign
+        (
+            const ControlData*  control,
+            int                 fallbackSlot
+        )
+        {
+            auto slot = 0;
+            while ( slot < NUMBER_OF_SLOTS && m_gains[slot].used )
+            {
+                ++slot;
+            }
+            if ( slot == NUMBER_OF_SLOTS )
+            {
+                if ( fallbackSlot < 0 || fallbackSlot >= NUMBER_OF_SLOTS )
+                {
+                    return -1;
+                }
+                slot = fallbackSlot;
+            }
+            m_gains[slot] = Gains{ true, control->GetP(), control->GetI(), control->GetD(), control->GetF() };
+            return slot;
+        }
+
+        /// @return int slot the closed loop is using (-1 - none selected yet)
+        int GetSelected() const { return m_selected; }
+        void SetSelected( int slot ) { m_selected = slot; }
+
+    private:
+        struct Gains
+        {
+            bool    used;
+            double  p;
+            double  i;
+            double  d;
+            double  f;
+        };
+        std::array<Gains, NUMBER_OF_SLOTS>  m_gains;
+        int                                 m_selected;
+};
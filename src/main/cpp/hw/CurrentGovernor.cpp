@@ -0,0 +1,225 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// CurrentGovernor.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Scales back the lower priority mechanisms when the battery is about to brown out
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cmath>
+#include <string>
+
+// FRC includes
+
+// Team 302 includes
+#include <hw/CurrentGovernor.h>
+#include <hw/PowerMonitor.h>
+#include <utils/TelemetryRecorder.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    const char* const PRIORITY_NAMES[CurrentGovernor::PRIORITY::MAX_PRIORITIES] = { "drive", "shooter", "indexer", "intake", "climber" };
+}
+
+/// @brief Find or create the current governor
+/// @returns CurrentGovernor* pointer to the governor
+CurrentGovernor* CurrentGovernor::m_instance = nullptr;
+CurrentGovernor* CurrentGovernor::GetInstance()
+{
+    if ( CurrentGovernor::m_instance == nullptr )
+    {
+        CurrentGovernor::m_instance = new CurrentGovernor();
+    }
+    return CurrentGovernor::m_instance;
+}
+
+CurrentGovernor::CurrentGovernor() : m_channels(),
+                                     m_scales(),
+                                     m_resistance( DEFAULT_RESISTANCE ),
+                                     m_lastVoltage( 0.0 ),
+                                     m_lastCurrent( 0.0 ),
+                                     m_haveLast( false ),
+                                     m_resistanceSignal( -1 ),
+                                     m_budgetSignal( -1 ),
+                                     m_scaleSignals()
+{
+    auto recorder = TelemetryRecorder::GetInstance();
+    m_resistanceSignal = recorder->RegisterSignal("Current Governor/resistance");
+    m_budgetSignal = recorder->RegisterSignal("Current Governor/budget");
+    for ( auto priority=0; priority<MAX_PRIORITIES; ++priority )
+    {
+        m_scales[priority].store( 1.0, memory_order_relaxed );
+        m_scaleSignals[priority] = recorder->RegisterSignal(string("Current Governor/") + PRIORITY_NAMES[priority]);
+    }
+}
+
+/// @brief Add a motor controller's power distribution channel to its mechanism's priority
+/// @param [in] MotorControllerUsage::MOTOR_CONTROLLER_USAGE: what the motor is used for
+/// @param [in] int: power distribution channel
+/// @returns PRIORITY: priority to pass to GetScale
+CurrentGovernor::PRIORITY CurrentGovernor::Register
+(
+    MotorControllerUsage::MOTOR_CONTROLLER_USAGE    usage,
+    int                                             pdpChannel
+)
+{
+    auto priority = UNGOVERNED;
+    switch ( usage )
+    {
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_DRIVE:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_TURN:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::DIFFERENTIAL_LEFT_MAIN:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::DIFFERENTIAL_LEFT_FOLLOWER:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::DIFFERENTIAL_RIGHT_MAIN:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::DIFFERENTIAL_RIGHT_FOLLOWER:
+            priority = DRIVE;
+            break;
+
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SHOOTER:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SHOOTER2:
+            priority = SHOOTER;
+            break;
+
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::LEFT_INDEXER:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::RIGHT_INDEXER:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::BALL_TRANSFER_SPIN:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::BALL_TRANSFER_LIFT:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::LIFT:
+            priority = INDEXER;
+            break;
+
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::INTAKE_SPIN:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::INTAKE_EXTEND:
+            priority = INTAKE;
+            break;
+
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::CLIMBER_LIFT:
+        case MotorControllerUsage::MOTOR_CONTROLLER_USAGE::CLIMBER_ROTATE:
+            priority = CLIMBER;
+            break;
+
+        default:
+            break;
+    }
+
+    if ( priority != UNGOVERNED && pdpChannel >= 0 && pdpChannel < PowerSnapshot::MAX_CHANNELS )
+    {
+        auto& channels = m_channels[priority];
+        if ( find( channels.begin(), channels.end(), pdpChannel ) == channels.end() )
+        {
+            channels.push_back( pdpChannel );
+        }
+        PowerMonitor::GetInstance()->RegisterChannel( pdpChannel );
+    }
+    return priority;
+}
+
+/// @brief Update the battery model from the latest PowerSnapshot and work out the scales (call once per loop)
+void CurrentGovernor::Update()
+{
+    PowerSnapshot snapshot;
+    if ( PowerMonitor::GetInstance()->GetSnapshot( snapshot ) )
+    {
+        Update( snapshot );
+    }
+}
+
+/// @brief Update the battery model from a snapshot and work out the scales
+/// @param [in] const PowerSnapshot&: power distribution readings
+void CurrentGovernor::Update
+(
+    const PowerSnapshot&    snapshot
+)
+{
+    if ( snapshot.voltage <= 0.0 )
+    {
+        return;
+    }
+
+    // learn the resistance from the voltage drop when the current steps (small steps are mostly noise)
+    auto voltage = snapshot.voltage;
+    auto current = snapshot.totalCurrent;
+    if ( m_haveLast && fabs( current - m_lastCurrent ) >= MIN_CURRENT_STEP )
+    {
+        auto measured = -( voltage - m_lastVoltage ) / ( current - m_lastCurrent );
+        if ( measured >= MIN_RESISTANCE && measured <= MAX_RESISTANCE )
+        {
+            m_resistance += RESISTANCE_FILTER * ( measured - m_resistance );
+        }
+    }
+    if ( !m_haveLast || fabs( current - m_lastCurrent ) >= MIN_CURRENT_STEP )
+    {
+        m_lastVoltage = voltage;
+        m_lastCurrent = current;
+        m_haveLast = true;
+    }
+
+    // current the battery can supply before it sags to the target voltage, less what isn't governed
+    // (roboRIO, radio, compressor, ...)
+    auto openCircuit = voltage + current * m_resistance;
+    auto budget = ( openCircuit - TARGET_VOLTAGE ) / m_resistance;
+
+    array<double, MAX_PRIORITIES> demand {};
+    auto governed = 0.0;
+    for ( auto priority=0; priority<MAX_PRIORITIES; ++priority )
+    {
+        for ( auto channel : m_channels[priority] )
+        {
+            demand[priority] += channel < snapshot.channels ? max( snapshot.currents[channel], 0.0 ) : 0.0;
+        }
+        governed += demand[priority];
+    }
+    auto remaining = budget - max( current - governed, 0.0 );
+
+    // what the motors would draw if they weren't scaled back; every priority gets MIN_SCALE of that and
+    // the rest of the budget is handed out in priority order
+    array<double, MAX_PRIORITIES> fullDemand {};
+    for ( auto priority=0; priority<MAX_PRIORITIES; ++priority )
+    {
+        fullDemand[priority] = demand[priority] / m_scales[priority].load( memory_order_relaxed );
+        remaining -= fullDemand[priority] * MIN_SCALE;
+    }
+
+    auto recorder = TelemetryRecorder::GetInstance();
+    for ( auto priority=0; priority<MAX_PRIORITIES; ++priority )
+    {
+        auto extra = fullDemand[priority] * ( 1.0 - MIN_SCALE );
+        auto target = 1.0;
+        if ( fullDemand[priority] > 0.0 && extra > remaining )     // nothing to scale back when it draws nothing
+        {
+            target = MIN_SCALE + max( remaining, 0.0 ) / fullDemand[priority];
+        }
+        remaining = max( remaining - extra, 0.0 );
+
+        auto scale = m_scales[priority].load( memory_order_relaxed );
+        scale = target < scale ? target : min( target, scale + ( 1.0 - MIN_SCALE ) * LOOP_TIME / RECOVERY_TIME );
+        m_scales[priority].store( scale, memory_order_relaxed );
+        recorder->Record( m_scaleSignals[priority], scale );
+    }
+    recorder->Record( m_resistanceSignal, m_resistance );
+    recorder->Record( m_budgetSignal, budget );
+}
@@ -0,0 +1,160 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// CurrentGovernor.h
+//========================================================================================================
+///
+/// File Description:
+///     Keeps the battery voltage above the roboRIO's brownout voltage by scaling back the outputs of
+///     the lower priority mechanisms when everything draws current at once.
+///
+///     The battery is modeled as an open circuit voltage behind a resistance (V = Voc - I * R).  R is
+///     learned from the voltage drop each time the total current steps, so every loop the governor
+///     can work out how much current the battery can supply before the voltage sags to
+///     TARGET_VOLTAGE.  That budget is handed out in priority order (drive, shooter, indexer, intake,
+///     climber) against what each priority's motors would draw at full output.  A priority that
+///     doesn't fit gets a scale below 1.0.  DragonFalcon / DragonTalonSRX multiply their percent output
+///     and voltage commands by it.  Scaling a velocity setpoint wouldn't limit anything (the closed loop
+///     still saturates while it is stalled or spinning up), so velocity commands scale the controller's
+///     peak output instead (GetPeakScale).  Position commands aren't scaled.  Scales drop right away and
+///     recover over RECOVERY_TIME.
+///
+///         // controller constructor
+///         m_governorPriority = CurrentGovernor::GetInstance()->Register(usage, pdpChannel);
+///
+///         // Set
+///         output *= CurrentGovernor::GetInstance()->GetScale(m_governorPriority);           // open loop
+///         peak = configuredPeak * CurrentGovernor::GetInstance()->GetPeakScale(m_governorPriority);  // closed loop
+///
+///         // RobotPeriodic (after PowerMonitor::Update)
+///         CurrentGovernor::GetInstance()->Update();
+///
+///     Register is only called while the robot is being built (RobotInit); Update is only called by
+///     the robot loop; GetScale can be called from any thread.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <hw/PowerMonitor.h>
+#include <hw/usages/MotorControllerUsage.h>
+
+// Third Party Includes
+
+
+class CurrentGovernor
+{
+    public:
+        /// @enum PRIORITY
+        /// @brief mechanisms in the order they get current (UNGOVERNED is never scaled)
+        enum PRIORITY
+        {
+            UNGOVERNED = -1,
+            DRIVE,
+            SHOOTER,
+            INDEXER,
+            INTAKE,
+            CLIMBER,
+            MAX_PRIORITIES
+        };
+
+        /// @brief Find or create the current governor
+        /// @returns CurrentGovernor* pointer to the governor
+        static CurrentGovernor* GetInstance();
+
+        /// @brief Add a motor controller's power distribution channel to its mechanism's priority
+        /// @param [in] MotorControllerUsage::MOTOR_CONTROLLER_USAGE: what the motor is used for
+        /// @param [in] int: power distribution channel
+        /// @returns PRIORITY: priority to pass to GetScale
+        PRIORITY Register
+        (
+            MotorControllerUsage::MOTOR_CONTROLLER_USAGE    usage,
+            int                                             pdpChannel
+        );
+
+        /// @param [in] PRIORITY: priority from Register
+        /// @returns double: factor (MIN_SCALE to 1.0) to apply to the priority's outputs
+        double GetScale
+        (
+            PRIORITY                                        priority
+        ) const
+        {
+            return priority > UNGOVERNED && priority < MAX_PRIORITIES ? m_scales[priority].load(std::memory_order_relaxed) : 1.0;
+        }
+
+        /// @param [in] PRIORITY: priority from Register
+        /// @returns double: GetScale rounded down to a PEAK_SCALE_STEP, for closed loop peak outputs (the
+        ///          peak output is a configuration setting, so it shouldn't be sent every loop while recovering)
+        double GetPeakScale
+        (
+            PRIORITY                                        priority
+        ) const
+        {
+            return std::floor( GetScale( priority ) / PEAK_SCALE_STEP + 0.001 ) * PEAK_SCALE_STEP;
+        }
+
+        static constexpr double PEAK_SCALE_STEP = 0.1;
+
+        /// @brief Update the battery model from the latest PowerSnapshot and work out the scales (call once per loop)
+        void Update();
+
+        /// @brief Update the battery model from a snapshot and work out the scales
+        /// @param [in] const PowerSnapshot&: power distribution readings
+        void Update
+        (
+            const PowerSnapshot&                            snapshot
+        );
+
+    private:
+        friend class CurrentGovernorTest;
+
+        CurrentGovernor();
+        ~CurrentGovernor() = default;
+
+        static constexpr double TARGET_VOLTAGE = 7.5;           // volts (the roboRIO disables outputs at 6.8 V)
+        static constexpr double DEFAULT_RESISTANCE = 0.025;     // ohms (battery, breaker and wiring)
+        static constexpr double MIN_RESISTANCE = 0.010;         // ohms
+        static constexpr double MAX_RESISTANCE = 0.080;         // ohms
+        static constexpr double MIN_CURRENT_STEP = 20.0;        // amps change needed to measure the resistance
+        static constexpr double RESISTANCE_FILTER = 0.1;        // weight of a new resistance measurement
+        static constexpr double MIN_SCALE = 0.2;                // mechanisms keep moving, just slower
+        static constexpr double RECOVERY_TIME = 0.5;            // seconds from MIN_SCALE to 1.0
+        static constexpr double LOOP_TIME = 0.02;               // seconds
+
+        static CurrentGovernor*                             m_instance;
+
+        std::array<std::vector<int>, MAX_PRIORITIES>        m_channels;     // power distribution channels in each priority
+        std::array<std::atomic<double>, MAX_PRIORITIES>     m_scales;
+        double                                              m_resistance;   // ohms
+        double                                              m_lastVoltage;
+        double                                              m_lastCurrent;
+        bool                                                m_haveLast;
+
+        int                                                 m_resistanceSignal;
+        int                                                 m_budgetSignal;
+        std::array<int, MAX_PRIORITIES>                     m_scaleSignals;
+};
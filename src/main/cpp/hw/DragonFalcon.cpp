@@ -22,17 +22,21 @@
 #include <networktables/NetworkTableInstance.h>
 #include <networktables/NetworkTable.h>
 #include <networktables/NetworkTableEntry.h>
-#include <frc/PowerDistribution.h>
 #include <frc/motorcontrol/MotorController.h>
 
 // Team 302 includes
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/DragonFalcon.h>
-#include <hw/factories/PDPFactory.h>
 //#include <hw/DragonPDP.h>
+#include <hw/CanFramePlanner.h>
+#include <hw/ConfigFingerprint.h>
+#include <hw/CurrentGovernor.h>
+#include <hw/MotorOutputCache.h>
+#include <hw/PowerMonitor.h>
 #include <hw/usages/MotorControllerUsage.h>
 #include <utils/Logger.h>
 #include <utils/ConversionUtils.h>
+#include <utils/TelemetryRecorder.h>
 
 // Third Party Includes
 #include <ctre/phoenix/motorcontrol/can/WPI_TalonFX.h>
@@ -45,6 +49,47 @@ using namespace ctre::phoenix;
 using namespace ctre::phoenix::motorcontrol;
 using namespace ctre::phoenix::motorcontrol::can;
 
+namespace
+{
+	/// @brief the settings for a closed loop slot (0 - 3)
+	SlotConfiguration& GetSlotConfiguration
+	(
+		BaseMotorControllerConfiguration&	config,
+		int									slot
+	)
+	{
+		switch ( slot )
+		{
+			case 1:
+				return config.slot1;
+			case 2:
+				return config.slot2;
+			case 3:
+				return config.slot3;
+			default:
+				return config.slot0;
+		}
+	}
+
+	/// @brief modes that use the gains in a slot
+	bool IsClosedLoop
+	(
+		ControlModes::CONTROL_TYPE	mode
+	)
+	{
+		return mode == ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE ||
+			   mode == ControlModes::CONTROL_TYPE::POSITION_DEGREES ||
+			   mode == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
+			   mode == ControlModes::CONTROL_TYPE::POSITION_INCH ||
+			   mode == ControlModes::CONTROL_TYPE::VELOCITY_DEGREES ||
+			   mode == ControlModes::CONTROL_TYPE::VELOCITY_INCH ||
+			   mode == ControlModes::CONTROL_TYPE::VELOCITY_RPS  ||
+			   mode == ControlModes::CONTROL_TYPE::VOLTAGE ||
+			   mode == ControlModes::CONTROL_TYPE::CURRENT ||
+			   mode == ControlModes::CONTROL_TYPE::TRAPEZOID;
+	}
+}
+
 DragonFalcon::DragonFalcon
 (
 	MotorControllerUsage::MOTOR_CONTROLLER_USAGE deviceType, 
@@ -66,228 +111,165 @@ DragonFalcon::DragonFalcon
 	m_diameter( 1.0 ),
 	m_countsPerInch(countsPerInch),
 	m_countsPerDegree(countsPerDegree),
-	m_motorType(motorType)
+	m_motorType(motorType),
+	m_telemetrySignal(-1),
+	m_rpsAggregate(-1),
+	m_voltageAggregate(-1),
+	m_outputCache(-1),
+	m_framePlan(-1),
+	m_governorPriority(CurrentGovernor::PRIORITY::UNGOVERNED),
+	m_commands(),
+	m_config(),
+	m_configApplied(false),
+	m_fingerprintStored(false)
 {
-	// for all calls if we get an error log it; for key items try again
 	auto prompt = string("Dragon Falcon");
 	prompt += to_string(deviceID);
-	auto error = m_talon.get()->ConfigFactoryDefault();
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigFactoryDefault();
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigFactoryDefault"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-
-	m_talon.get()->SetNeutralMode(NeutralMode::Brake);
-
-	error = m_talon.get()->ConfigNeutralDeadband(0.01, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigNeutralDeadband"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigNominalOutputForward(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigNominalOutputForward(0.0, 0);
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigNominalOutputForward"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigNominalOutputReverse(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigNominalOutputReverse(0.0, 0);
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigNominalOutputReverse"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigOpenloopRamp(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigOpenloopRamp"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigPeakOutputForward(1.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigPeakOutputForward(1.0, 0);
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigPeakOutputForward"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigPeakOutputReverse(-1.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigPeakOutputReverse(-1.0, 0);
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigPeakOutputReverse"), string("error"));
-		error = ErrorCode::OKAY;
-	}
+	m_telemetrySignal = TelemetryRecorder::GetInstance()->RegisterSignal(prompt + "/output");
+	m_rpsAggregate = Logger::GetLogger()->RegisterAggregate(prompt, "motor current RPS");
+	m_voltageAggregate = Logger::GetLogger()->RegisterAggregate(prompt, "voltage");
+	m_outputCache = MotorOutputCache::GetInstance()->Register("DragonFalcon", deviceID);
+	m_framePlan = CanFramePlanner::GetInstance()->Register( string("DragonFalcon ") + to_string(deviceID),
+	                                                        CanFramePlanner::DEVICE_TYPE::TALON_FX,
+	                                                        [this]( int frame, int periodMs ) { UpdateFramePeriods( static_cast<StatusFrameEnhanced>(frame), static_cast<uint8_t>(periodMs) ); } );
+	m_governorPriority = CurrentGovernor::GetInstance()->Register( deviceType, pdpID );
+	PowerMonitor::GetInstance()->RegisterChannel( pdpID );
+	EnableBrakeMode(true);
+	UpdateCommandConversions();
+
+	// the settings are collected in m_config and sent with one ConfigAllSettings call when
+	// DragonMotorControllerFactory::ApplyConfigurations runs (see ApplyConfiguration)
+	m_config.neutralDeadband = 0.01;
+	m_config.nominalOutputForward = 0.0;
+	m_config.nominalOutputReverse = 0.0;
+	m_config.openloopRamp = 0.0;
+	m_config.peakOutputForward = 1.0;
+	m_config.peakOutputReverse = -1.0;
+
+	m_config.supplyCurrLimit.enable = false;
+	m_config.supplyCurrLimit.currentLimit = 1.0;
+	m_config.supplyCurrLimit.triggerThresholdCurrent = 1.0;
+	m_config.supplyCurrLimit.triggerThresholdTime = 0.001;
+	m_config.statorCurrLimit.enable = false;
+	m_config.statorCurrLimit.currentLimit = 1.0;
+	m_config.statorCurrLimit.triggerThresholdCurrent = 1.0;
+	m_config.statorCurrLimit.triggerThresholdTime = 0.001;
+
+	m_config.voltageCompSaturation = 12.0;
+
+	m_config.forwardLimitSwitchSource = LimitSwitchSource::LimitSwitchSource_Deactivated;
+	m_config.forwardLimitSwitchNormal = LimitSwitchNormal::LimitSwitchNormal_Disabled;
+	m_config.reverseLimitSwitchSource = LimitSwitchSource::LimitSwitchSource_Deactivated;
+	m_config.reverseLimitSwitchNormal = LimitSwitchNormal::LimitSwitchNormal_Disabled;
+
+	m_config.forwardSoftLimitEnable = false;
+	m_config.forwardSoftLimitThreshold = 0.0;
+	m_config.reverseSoftLimitEnable = false;
+	m_config.reverseSoftLimitThreshold = 0.0;
+
+	m_config.motionAcceleration = 1500.0;
+	m_config.motionCruiseVelocity = 1500.0;
+	m_config.motionCurveStrength = 0;
+	m_config.motionProfileTrajectoryPeriod = 0;
+	m_config.trajectoryInterpolationEnable = true;
 
-	SupplyCurrentLimitConfiguration climit;
-	climit.enable = false;
-	climit.currentLimit = 1.0;
-	climit.triggerThresholdCurrent = 1.0;
-	climit.triggerThresholdTime = 0.001;
-	error = m_talon.get()->ConfigSupplyCurrentLimit(climit, 50);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigSupplyCurrentLimit"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	StatorCurrentLimitConfiguration climit2;
-	climit2.enable = false;
-	climit2.currentLimit = 1.0;
-	climit2.triggerThresholdCurrent = 1.0;
-	climit2.triggerThresholdTime = 0.001;
-	error = m_talon.get()->ConfigStatorCurrentLimit( climit2, 50);
-	if ( error != ErrorCode::OKAY )
+	for ( auto inx=0; inx<4; ++inx )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigStatorCurrentLimit"), string("error"));
-		error = ErrorCode::OKAY;
+		auto& slot = GetSlotConfiguration(m_config, inx);
+		slot.allowableClosedloopError = 0.0;
+		slot.closedLoopPeakOutput = 1.0;
+		slot.closedLoopPeriod = 10;
+		slot.kP = 0.01;
+		slot.kI = 0.0;
+		slot.kD = 0.0;
+		slot.kF = 1.0;
+		slot.integralZone = 0.0;
 	}
 
-	error = m_talon.get()->ConfigVoltageCompSaturation(12.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigVoltageCompSaturation"), string("error"));
-		error = ErrorCode::OKAY;
-	}
+	m_config.remoteFilter0.remoteSensorDeviceID = 60;
+	m_config.remoteFilter0.remoteSensorSource = RemoteSensorSource::RemoteSensorSource_Off;
+	m_config.remoteFilter1.remoteSensorDeviceID = 60;
+	m_config.remoteFilter1.remoteSensorSource = RemoteSensorSource::RemoteSensorSource_Off;
+}
 
-	error = m_talon.get()->ConfigForwardLimitSwitchSource(LimitSwitchSource::LimitSwitchSource_Deactivated, LimitSwitchNormal::LimitSwitchNormal_Disabled, 0);
-	if ( error != ErrorCode::OKAY )
+/// @brief  Send the settings collected in m_config to the motor controller:  factory defaults and then one
+///         ConfigAllSettings call.  Until this is called the Config methods only update m_config; afterwards
+///         they update m_config and send the individual setting.
+///
+///         The fingerprint of m_config is kept in the controller's custom parameters (see ConfigFingerprint).
+///         When it matches, the controller already has these settings from an earlier run, so nothing is sent.
+/// @return bool true - the settings were sent, false - the controller already had them
+bool DragonFalcon::ApplyConfiguration()
+{
+	if ( m_configApplied )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigForwardLimitSwitchSource"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigReverseLimitSwitchSource(LimitSwitchSource::LimitSwitchSource_Deactivated, LimitSwitchNormal::LimitSwitchNormal_Disabled, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigReverseLimitSwitchSource"), string("error"));
-		error = ErrorCode::OKAY;
+		return false;
 	}
 
-	error = m_talon.get()->ConfigForwardSoftLimitEnable(false, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigForwardSoftLimitEnable"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigForwardSoftLimitThreshold(0.0, 0);
-	if ( error != ErrorCode::OKAY )
+	auto fingerprint = ConfigFingerprint::Compute( m_config.toString() );
+	if ( ConfigFingerprint::Matches( *m_talon.get(), fingerprint, CONFIG_TIMEOUT ) )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigForwardSoftLimitThreshold"), string("error"));
-		error = ErrorCode::OKAY;
+		m_configApplied = true;
+		m_fingerprintStored = true;
+		return false;
 	}
 
-	error = m_talon.get()->ConfigReverseSoftLimitEnable(false, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigReverseSoftLimitEnable"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigReverseSoftLimitThreshold(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigReverseSoftLimitThreshold"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	
-	
-	error = m_talon.get()->ConfigMotionAcceleration(1500.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigMotionAcceleration"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigMotionCruiseVelocity(1500.0, 0);
+	auto prompt = string("Dragon Falcon");
+	prompt += to_string(m_id);
+	auto error = m_talon.get()->ConfigFactoryDefault(CONFIG_TIMEOUT);
 	if ( error != ErrorCode::OKAY )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigMotionCruiseVelocity"), string("error"));
-		error = ErrorCode::OKAY;
+		m_talon.get()->ConfigFactoryDefault(CONFIG_TIMEOUT);
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigFactoryDefault"), string("error"));
 	}
-	error = m_talon.get()->ConfigMotionSCurveStrength(0, 0);
+	error = m_talon.get()->ConfigAllSettings(m_config, CONFIG_TIMEOUT);
 	if ( error != ErrorCode::OKAY )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigMotionSCurveStrength"), string("error"));
-		error = ErrorCode::OKAY;
+		error = m_talon.get()->ConfigAllSettings(m_config, CONFIG_TIMEOUT);
+		if ( error != ErrorCode::OKAY )
+		{
+			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigAllSettings"), string("error"));
+		}
 	}
 
-	error = m_talon.get()->ConfigMotionProfileTrajectoryPeriod(0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigMotionProfileTrajectoryPeriod"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigMotionProfileTrajectoryInterpolationEnable(true, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigMotionProfileTrajectoryInterpolationEnable"), string("error"));
-		error = ErrorCode::OKAY;
-	}
+	// only a complete configuration gets a fingerprint, so a failed one is sent again on the next run
+	m_fingerprintStored = ( error == ErrorCode::OKAY ) && ConfigFingerprint::Store( *m_talon.get(), fingerprint, CONFIG_TIMEOUT );
+	m_configApplied = true;
+	return true;
+}
 
-	m_talon.get()->ConfigAllowableClosedloopError(0.0, 0);
-	if ( error != ErrorCode::OKAY )
+/// @brief  A setting changed after the configuration was applied.  The controller no longer has the settings
+///         its fingerprint describes, so the fingerprint is cleared (once) and the next run configures it again.
+/// @return bool true - send the setting now, false - only m_config needs to be updated
+bool DragonFalcon::SendSetting()
+{
+	if ( !m_configApplied )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigAllowableClosedloopError"), string("error"));
-		error = ErrorCode::OKAY;
+		return false;
 	}
-
-	for ( auto inx=0; inx<4; ++inx )
+	if ( m_fingerprintStored )
 	{
-		error = m_talon.get()->ConfigClosedLoopPeakOutput(inx, 1.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigClosedLoopPeakOutput"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->ConfigClosedLoopPeriod(inx, 10, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigClosedLoopPeriod"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kP(inx, 0.01, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("Config_kP"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kI(inx, 0.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("Config_kI"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kD(inx, 0.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("Config_kD"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kF(inx, 1.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("Config_kF"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_IntegralZone(inx, 0.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("Config_IntegralZone"), string("error"));
-			error = ErrorCode::OKAY;
-		}
+		ConfigFingerprint::Clear( *m_talon.get() );
+		m_fingerprintStored = false;
 	}
+	return true;
+}
 
-	error = m_talon.get()->ConfigRemoteFeedbackFilter(60, RemoteSensorSource::RemoteSensorSource_Off, 0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigRemoteFeedbackFilter"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigRemoteFeedbackFilter(60, RemoteSensorSource::RemoteSensorSource_Off, 1, 0);
-	if ( error != ErrorCode::OKAY )
+/// @brief  Scale the peak output by the CurrentGovernor's scale.  A closed loop keeps pushing until it reaches
+///         its setpoint, so a stalled or spinning up motor draws the same current whatever the setpoint is; the
+///         peak output is what limits it.  The scaled peak isn't kept in m_config (it isn't part of the
+///         fingerprint) and is sent without waiting, only when the scale changes.  The first call after start up
+///         always sends it:  the controller keeps a scaled peak output across a code restart (e.g. during a brownout).
+/// @param [in] double  scale - factor for the configured peak output (1.0 - the configured peak output)
+/// @return void
+void DragonFalcon::SetPeakScale(double scale)
+{
+	if ( !m_configApplied || !m_settings.ShouldWrite(SettingCache::SETTING::PEAK_SCALE, scale) )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigRemoteFeedbackFilter"), string("error"));
+		return;
 	}
+	m_talon.get()->ConfigPeakOutputForward(m_config.peakOutputForward * scale, 0);
+	m_talon.get()->ConfigPeakOutputReverse(m_config.peakOutputReverse * scale, 0);
 }
 
 double DragonFalcon::GetRotations() const
@@ -320,12 +302,7 @@ shared_ptr<MotorController> DragonFalcon::GetSpeedController() const
 
 double DragonFalcon::GetCurrent() const
 {
-	auto pdp = PDPFactory::GetFactory()->GetPDP();
-	if (pdp != nullptr)
-	{
-		return pdp->GetCurrent(m_pdp);
-	}
-	return 0.0;
+	return PowerMonitor::GetInstance()->GetCurrent(m_pdp);
 }
 
 void DragonFalcon::UpdateFramePeriods
@@ -337,56 +314,26 @@ void DragonFalcon::UpdateFramePeriods
 	m_talon.get()->SetStatusFramePeriod( frame, milliseconds, 0 );
 }
 
+/// @brief  Set the status frame periods through the CanFramePlanner (it may slow MEDIUM / LOW controllers
+///         down further to keep the bus within its budget).  Can be called again when a mechanism's state changes.
 void DragonFalcon::SetFramePeriodPriority
 (
 	MOTOR_PRIORITY              priority
 )
 {
+	auto planner = CanFramePlanner::GetInstance();
 	switch ( priority )
 	{
 		case HIGH:
-			UpdateFramePeriods( StatusFrameEnhanced::Status_1_General, 10 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_2_Feedback0, 20 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_3_Quadrature, 100 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_4_AinTempVbat, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_8_PulseWidth, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_10_Targets, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_11_UartGadgeteer, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_12_Feedback1, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_13_Base_PIDF0, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_14_Turn_PIDF1, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_15_FirmareApiStatus, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_Brushless_Current, 200 );
+			planner->SetPriority( m_framePlan, CanFramePlanner::FRAME_PRIORITY::HIGH );
 			break;
 
 		case MEDIUM:
-			UpdateFramePeriods( StatusFrameEnhanced::Status_1_General, 60 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_2_Feedback0, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_3_Quadrature, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_4_AinTempVbat, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_8_PulseWidth, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_10_Targets, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_11_UartGadgeteer, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_12_Feedback1, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_13_Base_PIDF0, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_14_Turn_PIDF1, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_15_FirmareApiStatus, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_Brushless_Current, 200 );
+			planner->SetPriority( m_framePlan, CanFramePlanner::FRAME_PRIORITY::MEDIUM );
 			break;
 
 		case LOW:
-			UpdateFramePeriods( StatusFrameEnhanced::Status_1_General, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_2_Feedback0, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_3_Quadrature, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_4_AinTempVbat, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_8_PulseWidth, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_10_Targets, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_11_UartGadgeteer, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_12_Feedback1, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_13_Base_PIDF0, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_14_Turn_PIDF1, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_15_FirmareApiStatus, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_Brushless_Current, 200 );
+			planner->SetPriority( m_framePlan, CanFramePlanner::FRAME_PRIORITY::LOW );
 			break;
 
 		default:
@@ -395,144 +342,120 @@ void DragonFalcon::SetFramePeriodPriority
 	}
 }
 
-void DragonFalcon::Set(std::string nt, double value)
+/// @brief  Set the control mode and target.  The CTRE mode and the factor to native units come from
+///         m_commands (see UpdateCommandConversions), so there is nothing to work out per call.
+/// @param [in] const MotorCommand& command - control mode and target
+void DragonFalcon::Set(const MotorCommand& command)
 {
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("motor id"), m_talon.get()->GetDeviceID());
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("control mode"), m_controlMode);
+	m_controlMode = command.GetMode();
+	auto logger = Logger::GetLogger();
+	if ( logger->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT) )
+	{
+		logger->LogAggregate(Logger::LOGGER_LEVEL::PRINT, m_rpsAggregate, GetRPS());
+		logger->LogAggregate(Logger::LOGGER_LEVEL::PRINT, m_voltageAggregate, m_talon.get()->GetMotorOutputVoltage());
+	}
+	auto& conversion = m_commands[m_controlMode < ControlModes::CONTROL_TYPE::MAX_CONTROL_TYPES ? m_controlMode : ControlModes::CONTROL_TYPE::PERCENT_OUTPUT];
+	auto value = command.GetValue();
+	if ( conversion.governed )
+	{
+		value *= CurrentGovernor::GetInstance()->GetScale(m_governorPriority);
+	}
+	SetPeakScale(conversion.governedPeak ? CurrentGovernor::GetInstance()->GetPeakScale(m_governorPriority) : 1.0);
 
-	if ( m_controlMode == ControlModes::CONTROL_TYPE::VOLTAGE)
+	if ( m_controlMode == ControlModes::CONTROL_TYPE::VOLTAGE )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("motor target output voltage"), value);
 		m_talon.get()->SetVoltage(units::voltage::volt_t(value));
+		MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
+		TelemetryRecorder::GetInstance()->Record(m_telemetrySignal, value);
+		return;
 	}
-	else
+
+	auto output = value * conversion.scale;
+	if (MotorOutputCache::GetInstance()->ShouldSend(m_outputCache, m_controlMode, static_cast<int>(conversion.ctreMode), output))
+	{
+		m_talon.get()->Set( conversion.ctreMode, output );
+	}
+	TelemetryRecorder::GetInstance()->Record(m_telemetrySignal, output);
+}
+
+void DragonFalcon::Set(double value)
+{
+	Set(MotorCommand(m_controlMode, value));
+}
+
+/// @brief  Work out the CTRE control mode and the factor from the command units to native units for
+///         every control mode.  Called when the controller is created and when the diameter changes.
+void DragonFalcon::UpdateCommandConversions()
+{
+	for ( auto mode=0; mode<ControlModes::CONTROL_TYPE::MAX_CONTROL_TYPES; ++mode )
 	{
-		auto output = value;
-		ctre::phoenix::motorcontrol::TalonFXControlMode ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::PercentOutput;
-		switch (m_controlMode)
+		auto& conversion = m_commands[mode];
+		conversion.scale = 1.0;
+		switch (mode)
 		{
 			case ControlModes::CONTROL_TYPE::PERCENT_OUTPUT:
-				ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::PercentOutput;
+			case ControlModes::CONTROL_TYPE::VOLTAGE:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::PercentOutput;
 				break;
 				
 			case ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE:
-			case ControlModes::CONTROL_TYPE::POSITION_DEGREES:
-			case ControlModes::CONTROL_TYPE::POSITION_INCH:
-				ctreMode =:: ctre::phoenix::motorcontrol::TalonFXControlMode::Position;
-				break;
-
-			case ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE:
-			case ControlModes::CONTROL_TYPE::TRAPEZOID:
-				ctreMode =:: ctre::phoenix::motorcontrol::TalonFXControlMode::MotionMagic;
-				break;
-			
-			case ControlModes::CONTROL_TYPE::VELOCITY_DEGREES:
-			case ControlModes::CONTROL_TYPE::VELOCITY_INCH:
-			case ControlModes::CONTROL_TYPE::VELOCITY_RPS:
-				ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::Velocity;
-				break;
-
-			case ControlModes::CONTROL_TYPE::CURRENT:
-				ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::Current;
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::Position;
 				break;
 
-			case ControlModes::CONTROL_TYPE::MOTION_PROFILE:
-				ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::MotionProfile;
-				break;
-
-			case ControlModes::CONTROL_TYPE::MOTION_PROFILE_ARC:
-				ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::MotionProfileArc;
+			case ControlModes::CONTROL_TYPE::POSITION_DEGREES:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::Position;
+				conversion.scale = m_countsPerDegree > 0.01 ? m_countsPerDegree : ConversionUtils::DegreesToCounts(1.0, m_countsPerRev) * m_gearRatio;
 				break;
 
-			default:
-				string msg;
-				msg = string("Invalid control mode ");
-				msg += to_string(m_controlMode);
-				msg += " ";
-				msg += to_string(m_talon.get()->GetDeviceID());
-				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("DragonFalcon"), string("SetControlMode"), msg);
-				ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::PercentOutput;
+			case ControlModes::CONTROL_TYPE::POSITION_INCH:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::Position;
+				conversion.scale = m_countsPerInch > 0.01 ? m_countsPerInch : ConversionUtils::InchesToCounts(1.0, m_countsPerRev, m_diameter) * m_gearRatio;
 				break;
-		}	
 
-		switch (m_controlMode)
-		{
-			case ControlModes::CONTROL_TYPE::POSITION_DEGREES:
-				if (m_countsPerDegree > 0.01)
-				{
-					output = m_countsPerDegree*value;
-				}
-				else
-				{
-					output = (ConversionUtils::DegreesToCounts(value,m_countsPerRev) * m_gearRatio);
-				}
+			case ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::MotionMagic;
 				break;
 
-			case ControlModes::CONTROL_TYPE::POSITION_INCH:
 			case ControlModes::CONTROL_TYPE::TRAPEZOID:
-				if (m_countsPerInch > 0.01)
-				{
-					output = m_countsPerInch*value;
-				}
-				else
-				{
-					output = (ConversionUtils::InchesToCounts(value, m_countsPerRev, m_diameter) * m_gearRatio);
-				}
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::MotionMagic;
+				conversion.scale = m_countsPerInch > 0.01 ? m_countsPerInch : ConversionUtils::InchesToCounts(1.0, m_countsPerRev, m_diameter) * m_gearRatio;
 				break;
 			
 			case ControlModes::CONTROL_TYPE::VELOCITY_DEGREES:
-				if (m_countsPerDegree > 0.01)
-				{
-					output = m_countsPerDegree*value * 0.1;
-				}
-				else
-				{
-					output = (ConversionUtils::DegreesPerSecondToCounts100ms( value, m_countsPerRev ) * m_gearRatio);
-				}
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::Velocity;
+				conversion.scale = m_countsPerDegree > 0.01 ? m_countsPerDegree * 0.1 : ConversionUtils::DegreesPerSecondToCounts100ms(1.0, m_countsPerRev) * m_gearRatio;
 				break;
 
 			case ControlModes::CONTROL_TYPE::VELOCITY_INCH:
-				if (m_countsPerInch > 0.01)
-				{
-					output = m_countsPerInch*value *0.1;
-				}
-				else
-				{
-					output = (ConversionUtils::InchesPerSecondToCounts100ms( value, m_countsPerRev, m_diameter ) * m_gearRatio);
-				}
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::Velocity;
+				conversion.scale = m_countsPerInch > 0.01 ? m_countsPerInch * 0.1 : ConversionUtils::InchesPerSecondToCounts100ms(1.0, m_countsPerRev, m_diameter) * m_gearRatio;
 				break;
 
 			case ControlModes::CONTROL_TYPE::VELOCITY_RPS:
-				if (m_countsPerDegree > 0.01)
-				{
-					output = value * 360.0 * m_countsPerDegree * 0.1;
-				}
-				else
-				{
-					output = (ConversionUtils::RPSToCounts100ms( value, m_countsPerRev ) * m_gearRatio);
-				}
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::Velocity;
+				conversion.scale = m_countsPerDegree > 0.01 ? 360.0 * m_countsPerDegree * 0.1 : ConversionUtils::RPSToCounts100ms(1.0, m_countsPerRev) * m_gearRatio;
 				break;
 
-			default:
+			case ControlModes::CONTROL_TYPE::CURRENT:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::Current;
 				break;
-		}	
 
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("motor target output"), output);
+			case ControlModes::CONTROL_TYPE::MOTION_PROFILE:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::MotionProfile;
+				break;
 
-		m_talon.get()->Set( ctreMode, output );
+			case ControlModes::CONTROL_TYPE::MOTION_PROFILE_ARC:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::MotionProfileArc;
+				break;
 
+			default:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::TalonFXControlMode::PercentOutput;
+				break;
+		}
+		conversion.governed = mode == ControlModes::CONTROL_TYPE::PERCENT_OUTPUT ||
+							  mode == ControlModes::CONTROL_TYPE::VOLTAGE;
+		conversion.governedPeak = conversion.ctreMode == ctre::phoenix::motorcontrol::TalonFXControlMode::Velocity;
 	}
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("motor current percent output"), m_talon.get()->Get() );
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("motor current RPS"), GetRPS() );
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("voltage"), m_talon.get()->GetMotorOutputVoltage());
-}
-
-void DragonFalcon::Set(double value)
-{
-	auto id = m_talon.get()->GetDeviceID();
-	auto ntName = std::string("MotorOutput");
-	ntName += to_string(id);
-	Set(ntName, value);
 }
 
 void DragonFalcon::SetRotationOffset(double rotations)
@@ -543,6 +466,21 @@ void DragonFalcon::SetRotationOffset(double rotations)
 
 void DragonFalcon::SetVoltageRamping(double ramping, double rampingClosedLoop)
 {
+	if ( !m_settings.ConfigChanged(m_config.openloopRamp != ramping ||
+								   (rampingClosedLoop >= 0 && m_config.closedloopRamp != rampingClosedLoop)) )
+	{
+		return;
+	}
+	m_config.openloopRamp = ramping;
+	if (rampingClosedLoop >= 0)
+	{
+		m_config.closedloopRamp = rampingClosedLoop;
+	}
+	if ( !SendSetting() )
+	{
+		return;
+	}
+
 	auto prompt = string("Dragon Falcon");
 	prompt += to_string(m_talon.get()->GetDeviceID());
     auto error = m_talon.get()->ConfigOpenloopRamp(ramping);
@@ -563,17 +501,19 @@ void DragonFalcon::SetVoltageRamping(double ramping, double rampingClosedLoop)
 
 void DragonFalcon::EnableCurrentLimiting(bool enabled)
 {
-	SupplyCurrentLimitConfiguration limit;
-	auto prompt = string("Dragon Falcon");
-	prompt += to_string(m_talon.get()->GetDeviceID());
-	int timeout = 50.0;
-	auto error = m_talon.get()->ConfigGetSupplyCurrentLimit( limit, timeout );
-	if ( error != ErrorCode::OKAY )
+	if ( !m_settings.ConfigChanged(m_config.supplyCurrLimit.enable != enabled) )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigGetSupplyCurrentLimit"), string("error"));
+		return;
 	}
-	limit.enable = enabled;
-	error = m_talon.get()->ConfigSupplyCurrentLimit( limit, timeout );
+	m_config.supplyCurrLimit.enable = enabled;
+	if ( !SendSetting() )
+	{
+		return;
+	}
+
+	auto prompt = string("Dragon Falcon");
+	prompt += to_string(m_talon.get()->GetDeviceID());
+	auto error = m_talon.get()->ConfigSupplyCurrentLimit( m_config.supplyCurrLimit, CONFIG_TIMEOUT );
 	if ( error != ErrorCode::OKAY )
 	{
 		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigSupplyCurrentLimit"), string("error"));
@@ -582,17 +522,26 @@ void DragonFalcon::EnableCurrentLimiting(bool enabled)
 
 void DragonFalcon::EnableBrakeMode(bool enabled)
 {
-    m_talon.get()->SetNeutralMode(enabled ? ctre::phoenix::motorcontrol::NeutralMode::Brake : ctre::phoenix::motorcontrol::NeutralMode::Coast);
+    if ( m_settings.ShouldWrite(SettingCache::SETTING::NEUTRAL_MODE, enabled) )
+    {
+        m_talon.get()->SetNeutralMode(enabled ? ctre::phoenix::motorcontrol::NeutralMode::Brake : ctre::phoenix::motorcontrol::NeutralMode::Coast);
+    }
 }
 
 void DragonFalcon::Invert(bool inverted)
 {
-    m_talon.get()->SetInverted(inverted);
+    if ( m_settings.ShouldWrite(SettingCache::SETTING::INVERTED, inverted) )
+    {
+        m_talon.get()->SetInverted(inverted);
+    }
 }
 
 void DragonFalcon::SetSensorInverted(bool inverted)
 {
-    m_talon.get()->SetSensorPhase(inverted);
+    if ( m_settings.ShouldWrite(SettingCache::SETTING::SENSOR_PHASE, inverted) )
+    {
+        m_talon.get()->SetSensorPhase(inverted);
+    }
 }
 
 MotorControllerUsage::MOTOR_CONTROLLER_USAGE DragonFalcon::GetType() const
@@ -617,6 +566,11 @@ void DragonFalcon::SelectClosedLoopProfile
 )
 {
 	auto error = m_talon.get()->SelectProfileSlot( slot, pidIndex );
+	MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
+	if ( pidIndex == 0 )
+	{
+		m_slots.SetSelected(slot);
+	}
 	if ( error != ErrorCode::OKAY )
 	{
 		auto prompt = string("Dragon Falcon");
@@ -632,6 +586,13 @@ int DragonFalcon::ConfigSelectedFeedbackSensor
 	int timeoutMs
 )
 {
+	auto& pid = ( pidIdx == 0 ) ? m_config.primaryPID : m_config.auxiliaryPID;
+	pid.selectedFeedbackSensor = static_cast<TalonFXFeedbackDevice>(feedbackDevice);
+	if ( !SendSetting() )
+	{
+		return 0;
+	}
+
 	int error = 0;
 	if ( m_talon.get() != nullptr )
 	{
@@ -653,6 +614,13 @@ int DragonFalcon::ConfigSelectedFeedbackSensor
 	int timeoutMs
 )
 {
+	auto& pid = ( pidIdx == 0 ) ? m_config.primaryPID : m_config.auxiliaryPID;
+	pid.selectedFeedbackSensor = static_cast<TalonFXFeedbackDevice>(feedbackDevice);
+	if ( !SendSetting() )
+	{
+		return 0;
+	}
+
 	int error = 0;
 	if ( m_talon.get() != nullptr )
 	{
@@ -667,36 +635,32 @@ int DragonFalcon::ConfigSelectedFeedbackSensor
 	return error;
 }
 
-int DragonFalcon::ConfigPeakCurrentLimit
+void DragonFalcon::ConfigIntegratedSensorInitializationStrategy
 (
-	int amps,
-	int timeoutMs
+	ctre::phoenix::sensors::SensorInitializationStrategy strategy
 )
 {
-	int ierror = 0;
-	if ( m_talon.get() != nullptr )
+	m_config.initializationStrategy = strategy;
+	if ( SendSetting() )
 	{
-		auto prompt = string("Dragon Falcon");
-		prompt += to_string(m_talon.get()->GetDeviceID());
-		SupplyCurrentLimitConfiguration limit;
-		auto error = m_talon.get()->ConfigGetSupplyCurrentLimit( limit, timeoutMs );
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigGetSupplyCurrentLimit"), string("error"));
-		}
-		limit.triggerThresholdCurrent = amps;
-		error = m_talon.get()->ConfigSupplyCurrentLimit( limit, timeoutMs );
+		auto error = m_talon.get()->ConfigIntegratedSensorInitializationStrategy( strategy );
 		if ( error != ErrorCode::OKAY )
 		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigSupplyCurrentLimit"), string("error"));
+			auto prompt = string("Dragon Falcon");
+			prompt += to_string(m_talon.get()->GetDeviceID());
+			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigIntegratedSensorInitializationStrategy"), string("error"));
 		}
-		ierror = error;
 	}
-	else
-	{
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("DragonFalcon"), string("DragonFalcon::ConfigPeakCurrentLimit"), string("m_talon is a nullptr"));
-	}
-	return ierror;
+}
+
+int DragonFalcon::ConfigPeakCurrentLimit
+(
+	int amps,
+	int timeoutMs
+)
+{
+	m_config.supplyCurrLimit.triggerThresholdCurrent = amps;
+	return ConfigSupplyCurrentLimit( timeoutMs );
 }
 
 int DragonFalcon::ConfigPeakCurrentDuration
@@ -705,29 +669,8 @@ int DragonFalcon::ConfigPeakCurrentDuration
 	int timeoutMs
 )
 {
-	int error = 0;
-	if ( m_talon.get() != nullptr )
-	{
-		auto prompt = string("Dragon Falcon");
-		prompt += to_string(m_talon.get()->GetDeviceID());
-		SupplyCurrentLimitConfiguration limit;
-		auto error = m_talon.get()->ConfigGetSupplyCurrentLimit( limit, timeoutMs );
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigGetSupplyCurrentLimit"), string("error"));
-		}
-		limit.triggerThresholdTime = milliseconds;
-		error = m_talon.get()->ConfigSupplyCurrentLimit( limit, timeoutMs );
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigSupplyCurrentLimit"), string("error"));
-		}
-	}
-	else
-	{
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("DragonFalcon"), string("ConfigPeakCurrentDuration"), string("m_talon is a nullptr"));
-	}
-	return error;
+	m_config.supplyCurrLimit.triggerThresholdTime = milliseconds;
+	return ConfigSupplyCurrentLimit( timeoutMs );
 }
 
 int DragonFalcon::ConfigContinuousCurrentLimit
@@ -736,27 +679,27 @@ int DragonFalcon::ConfigContinuousCurrentLimit
 	int timeoutMs
 )
 {
-	int error = 0;
-	if ( m_talon.get() != nullptr )
+	m_config.supplyCurrLimit.currentLimit = amps;
+	return ConfigSupplyCurrentLimit( timeoutMs );
+}
+
+/// @brief send the supply current limit from m_config (once the configuration has been applied)
+int DragonFalcon::ConfigSupplyCurrentLimit
+(
+	int timeoutMs
+)
+{
+	if ( !SendSetting() )
 	{
-		auto prompt = string("Dragon Falcon");
-		prompt += to_string(m_talon.get()->GetDeviceID());
-		SupplyCurrentLimitConfiguration limit;
-		auto error = m_talon.get()->ConfigGetSupplyCurrentLimit( limit, timeoutMs );
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigGetSupplyCurrentLimit"), string("error"));
-		}
-		limit.currentLimit = amps;
-		error = m_talon.get()->ConfigSupplyCurrentLimit( limit, timeoutMs );
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigSupplyCurrentLimit"), string("error"));
-		}
+		return 0;
 	}
-	else
+
+	auto error = m_talon.get()->ConfigSupplyCurrentLimit( m_config.supplyCurrLimit, timeoutMs );
+	if ( error != ErrorCode::OKAY )
 	{
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("DragonFalcon"), string("ConfigContinuousCurrentLimit"), string("m_talon is a nullptr"));
+		auto prompt = string("Dragon Falcon");
+		prompt += to_string(m_talon.get()->GetDeviceID());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigSupplyCurrentLimit"), string("error"));
 	}
 	return error;
 }
@@ -767,16 +710,41 @@ void DragonFalcon::SetAsFollowerMotor
 )
 {
     m_talon.get()->Set( ControlMode::Follower, masterCANID );
+    MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
 }
 
 
-/// @brief  Set the control constants (e.g. PIDF values).
-/// @param [in] int             slot - hardware slot to use
+/// @brief  Load a set of control constants into a free slot without selecting it.  The states call this when
+///         they are created, so SetControlConstants only has to select the slot when they are entered.
+/// @param [in] ControlData*    controlInfo - the control constants
+/// @return int slot the constants are in (-1 - open loop or all of the slots are in use)
+int DragonFalcon::PreloadControlConstants(ControlData* controlInfo)
+{
+	if ( !IsClosedLoop(controlInfo->GetMode()) )
+	{
+		return -1;
+	}
+	auto slot = m_slots.Find(controlInfo);
+	if ( slot < 0 )
+	{
+		slot = m_slots.Assign(controlInfo, -1);
+		if ( slot >= 0 )
+		{
+			WriteGains(slot, controlInfo);
+		}
+	}
+	return slot;
+}
+
+/// @brief  Set the control constants (e.g. PIDF values).  Gains that are already in a slot (preloaded or
+///         used before) are only selected; nothing is sent when the slot is already selected.
+/// @param [in] int             slot - hardware slot to use when all of the slots are in use
 /// @param [in] ControlData*    pid - the control constants
 /// @return void
 void DragonFalcon::SetControlConstants(int slot, ControlData* controlInfo)
 {
 	SetControlMode(controlInfo->GetMode());
+	MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
 
 	auto prompt = string("Dragon Falcon");
 	prompt += to_string(m_talon.get()->GetDeviceID());
@@ -784,93 +752,143 @@ void DragonFalcon::SetControlConstants(int slot, ControlData* controlInfo)
 	auto id = m_talon.get()->GetDeviceID();
 	auto ntName = std::string("MotorOutput");
 	ntName += to_string(id);
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("P"), controlInfo->GetP());
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("I"), controlInfo->GetI());
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("D"), controlInfo->GetD());
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("F"), controlInfo->GetF());
-
-	auto peak = controlInfo->GetPeakValue();
-	auto error = m_talon.get()->ConfigPeakOutputForward(peak);
-	if ( error != ErrorCode::OKAY )
+	if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigPeakOutputForward error"));
-	}
-	error = m_talon.get()->ConfigPeakOutputReverse(-1.0*peak);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigPeakOutputReverse error"));
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "P", controlInfo->GetP());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "I", controlInfo->GetI());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "D", controlInfo->GetD());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "F", controlInfo->GetF());
 	}
 
+	auto error = ErrorCode::OKAY;
+	auto peak = controlInfo->GetPeakValue();
 	auto nom = controlInfo->GetNominalValue();
-	error = m_talon.get()->ConfigNominalOutputForward(nom);
-	if ( error != ErrorCode::OKAY )
+	if ( m_config.peakOutputForward != peak || m_config.peakOutputReverse != -1.0*peak ||
+		 m_config.nominalOutputForward != nom || m_config.nominalOutputReverse != -1.0*nom )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigNominalOutputForward error"));
-	}
-	error = m_talon.get()->ConfigNominalOutputReverse(-1.0*nom);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigNominalOutputReverse error"));
-	}
+		m_config.peakOutputForward = peak;
+		m_config.peakOutputReverse = -1.0*peak;
+		m_config.nominalOutputForward = nom;
+		m_config.nominalOutputReverse = -1.0*nom;
 
-	if ( controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_DEGREES ||
-	     controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_INCH ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_DEGREES ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_INCH ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_RPS  ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VOLTAGE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::CURRENT ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::TRAPEZOID )
-	{
-		error = m_talon.get()->Config_kP(slot, controlInfo->GetP());
-		if ( error != ErrorCode::OKAY )
+		if ( SendSetting() )
 		{
-			m_talon.get()->Config_kP(slot, controlInfo->GetP());
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kP error"));
+			error = m_talon.get()->ConfigPeakOutputForward(peak);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigPeakOutputForward error"));
+			}
+			error = m_talon.get()->ConfigPeakOutputReverse(-1.0*peak);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigPeakOutputReverse error"));
+			}
+			m_settings.Remember(SettingCache::SETTING::PEAK_SCALE, 1.0);
+
+			error = m_talon.get()->ConfigNominalOutputForward(nom);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigNominalOutputForward error"));
+			}
+			error = m_talon.get()->ConfigNominalOutputReverse(-1.0*nom);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigNominalOutputReverse error"));
+			}
 		}
-		error = m_talon.get()->Config_kI(slot, controlInfo->GetI());
-		if ( error != ErrorCode::OKAY )
-		{
-			m_talon.get()->Config_kI(slot, controlInfo->GetI());
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kI error"));
-		}
-		error = m_talon.get()->Config_kD(slot, controlInfo->GetD());
-		if ( error != ErrorCode::OKAY )
-		{
-			m_talon.get()->Config_kD(slot, controlInfo->GetD());
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kD error"));
-		}
-		error = m_talon.get()->Config_kF(slot, controlInfo->GetF());
-		if ( error != ErrorCode::OKAY )
+	}
+
+	if ( IsClosedLoop(controlInfo->GetMode()) )
+	{
+		auto loaded = m_slots.Find(controlInfo);
+		if ( loaded < 0 )
 		{
-			m_talon.get()->Config_kF(slot, controlInfo->GetF());
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kF error"));
+			loaded = m_slots.Assign(controlInfo, slot);
+			if ( loaded < 0 )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("invalid slot"));
+				return;
+			}
+			WriteGains(loaded, controlInfo);
 		}
-		error = m_talon.get()->SelectProfileSlot(slot, 0);
-		if ( error != ErrorCode::OKAY )
+		if ( loaded != m_slots.GetSelected() )
 		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("SelectProfileSlot error"));
+			error = m_talon.get()->SelectProfileSlot(loaded, 0);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("SelectProfileSlot error"));
+			}
+			m_slots.SetSelected(loaded);
 		}
 	}
 
 	
 	if ( //controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
-	     controlInfo->GetMode() == ControlModes::CONTROL_TYPE::TRAPEZOID  )
+		 ( controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
+	       controlInfo->GetMode() == ControlModes::CONTROL_TYPE::TRAPEZOID ) &&
+		 ( m_config.motionAcceleration != controlInfo->GetMaxAcceleration() ||
+		   m_config.motionCruiseVelocity != controlInfo->GetCruiseVelocity() ) )
 	{
-		error = m_talon.get()->ConfigMotionAcceleration( controlInfo->GetMaxAcceleration() );
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigMotionAcceleration error"));
-		}
-		error = m_talon.get()->ConfigMotionCruiseVelocity( controlInfo->GetCruiseVelocity(), 0);
-		if ( error != ErrorCode::OKAY )
+		m_config.motionAcceleration = controlInfo->GetMaxAcceleration();
+		m_config.motionCruiseVelocity = controlInfo->GetCruiseVelocity();
+		if ( SendSetting() )
 		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigMotionCruiseVelocity error"));
+			error = m_talon.get()->ConfigMotionAcceleration( controlInfo->GetMaxAcceleration() );
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigMotionAcceleration error"));
+			}
+			error = m_talon.get()->ConfigMotionCruiseVelocity( controlInfo->GetCruiseVelocity(), 0);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigMotionCruiseVelocity error"));
+			}
 		}
+	}
+}
+
+/// @brief  Put the gains in a slot (they go out with ConfigAllSettings if the configuration
+///         hasn't been applied yet).
+void DragonFalcon::WriteGains(int slot, ControlData* controlInfo)
+{
+	auto& slotConfig = GetSlotConfiguration(m_config, slot);
+	slotConfig.kP = controlInfo->GetP();
+	slotConfig.kI = controlInfo->GetI();
+	slotConfig.kD = controlInfo->GetD();
+	slotConfig.kF = controlInfo->GetF();
+	if ( !SendSetting() )
+	{
+		return;
+	}
+
+	auto prompt = string("Dragon Falcon");
+	prompt += to_string(m_talon.get()->GetDeviceID());
+	auto ntName = std::string("MotorOutput");
+	ntName += to_string(m_talon.get()->GetDeviceID());
 
+	auto error = m_talon.get()->Config_kP(slot, controlInfo->GetP());
+	if ( error != ErrorCode::OKAY )
+	{
+		m_talon.get()->Config_kP(slot, controlInfo->GetP());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kP error"));
+	}
+	error = m_talon.get()->Config_kI(slot, controlInfo->GetI());
+	if ( error != ErrorCode::OKAY )
+	{
+		m_talon.get()->Config_kI(slot, controlInfo->GetI());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kI error"));
+	}
+	error = m_talon.get()->Config_kD(slot, controlInfo->GetD());
+	if ( error != ErrorCode::OKAY )
+	{
+		m_talon.get()->Config_kD(slot, controlInfo->GetD());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kD error"));
+	}
+	error = m_talon.get()->Config_kF(slot, controlInfo->GetF());
+	if ( error != ErrorCode::OKAY )
+	{
+		m_talon.get()->Config_kF(slot, controlInfo->GetF());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kF error"));
 	}
 }
 
@@ -881,6 +899,18 @@ void DragonFalcon::SetForwardLimitSwitch
 )
 {
 	LimitSwitchNormal type = normallyOpen ? LimitSwitchNormal::LimitSwitchNormal_NormallyOpen : LimitSwitchNormal::LimitSwitchNormal_NormallyClosed;
+	if ( !m_settings.ConfigChanged(m_config.forwardLimitSwitchSource != LimitSwitchSource::LimitSwitchSource_FeedbackConnector ||
+								   m_config.forwardLimitSwitchNormal != type) )
+	{
+		return;
+	}
+	m_config.forwardLimitSwitchSource = LimitSwitchSource::LimitSwitchSource_FeedbackConnector;
+	m_config.forwardLimitSwitchNormal = type;
+	if ( !SendSetting() )
+	{
+		return;
+	}
+
 	auto error = m_talon.get()->ConfigForwardLimitSwitchSource( LimitSwitchSource::LimitSwitchSource_FeedbackConnector, type, 0  );
 	if ( error != ErrorCode::OKAY )
 	{
@@ -898,6 +928,18 @@ void DragonFalcon::SetReverseLimitSwitch
 )
 {
 	LimitSwitchNormal type = normallyOpen ? LimitSwitchNormal::LimitSwitchNormal_NormallyOpen : LimitSwitchNormal::LimitSwitchNormal_NormallyClosed;
+	if ( !m_settings.ConfigChanged(m_config.reverseLimitSwitchSource != LimitSwitchSource::LimitSwitchSource_FeedbackConnector ||
+								   m_config.reverseLimitSwitchNormal != type) )
+	{
+		return;
+	}
+	m_config.reverseLimitSwitchSource = LimitSwitchSource::LimitSwitchSource_FeedbackConnector;
+	m_config.reverseLimitSwitchNormal = type;
+	if ( !SendSetting() )
+	{
+		return;
+	}
+
 	auto error = m_talon.get()->ConfigReverseLimitSwitchSource( LimitSwitchSource::LimitSwitchSource_FeedbackConnector, type, 0  );
 	if ( error != ErrorCode::OKAY )
 	{
@@ -915,6 +957,20 @@ void DragonFalcon::SetRemoteSensor
     ctre::phoenix::motorcontrol::RemoteSensorSource deviceType
 )
 {
+	if ( !m_settings.ConfigChanged(m_config.remoteFilter0.remoteSensorDeviceID != canID ||
+								   m_config.remoteFilter0.remoteSensorSource != deviceType ||
+								   m_config.primaryPID.selectedFeedbackSensor != TalonFXFeedbackDevice::RemoteSensor0) )
+	{
+		return;
+	}
+	m_config.remoteFilter0.remoteSensorDeviceID = canID;
+	m_config.remoteFilter0.remoteSensorSource = deviceType;
+	m_config.primaryPID.selectedFeedbackSensor = TalonFXFeedbackDevice::RemoteSensor0;
+	if ( !SendSetting() )
+	{
+		return;
+	}
+
 	auto prompt = string("Dragon Falcon");
 	prompt += to_string(m_talon.get()->GetDeviceID());
 	auto error = m_talon.get()->ConfigRemoteFeedbackFilter( canID, deviceType, 0, 0.0 );
@@ -935,6 +991,7 @@ void DragonFalcon::SetDiameter
 )
 {
 	m_diameter = diameter;
+	UpdateCommandConversions();
 }
 
 void DragonFalcon::SetVoltage
@@ -943,6 +1000,38 @@ void DragonFalcon::SetVoltage
 )
 {
 	m_talon.get()->SetVoltage(output);
+	MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
+}
+
+void DragonFalcon::StopMotor()
+{
+	m_talon.get()->StopMotor();
+	MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
+}
+
+bool DragonFalcon::StartMotionProfile
+(
+	motion::BufferedTrajectoryPointStream&	stream,
+	uint32_t								minBufferedPoints
+)
+{
+	m_controlMode = ControlModes::CONTROL_TYPE::MOTION_PROFILE;
+	MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
+
+	auto error = m_talon.get()->StartMotionProfile(stream, minBufferedPoints, ControlMode::MotionProfile);
+	if ( error != ErrorCode::OKAY )
+	{
+		auto prompt = string("Dragon Falcon");
+		prompt += to_string(m_talon.get()->GetDeviceID());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("StartMotionProfile"), string("error"));
+		return false;
+	}
+	return true;
+}
+
+bool DragonFalcon::IsMotionProfileFinished()
+{
+	return m_controlMode != ControlModes::CONTROL_TYPE::MOTION_PROFILE || m_talon.get()->IsMotionProfileFinished();
 }
 
 bool DragonFalcon::IsForwardLimitSwitchClosed() const
@@ -964,13 +1053,26 @@ void DragonFalcon::EnableDisableLimitSwitches
 	bool enable
 )
 {
-	m_talon.get()->OverrideLimitSwitchesEnable(enable);
+	if ( m_settings.ShouldWrite(SettingCache::SETTING::LIMIT_SWITCH_OVERRIDE, enable) )
+	{
+		m_talon.get()->OverrideLimitSwitchesEnable(enable);
+	}
 }
 
 void DragonFalcon::EnableVoltageCompensation( double fullvoltage) 
 {
-	m_talon.get()->ConfigVoltageCompSaturation(fullvoltage);
-	m_talon.get()->EnableVoltageCompensation(true);
+	if ( m_settings.ConfigChanged(m_config.voltageCompSaturation != fullvoltage) )
+	{
+		m_config.voltageCompSaturation = fullvoltage;
+		if ( SendSetting() )
+		{
+			m_talon.get()->ConfigVoltageCompSaturation(fullvoltage);
+		}
+	}
+	if ( m_settings.ShouldWrite(SettingCache::SETTING::VOLTAGE_COMPENSATION, true) )
+	{
+		m_talon.get()->EnableVoltageCompensation(true);
+	}
 }
 
 
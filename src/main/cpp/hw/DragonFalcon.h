@@ -19,6 +19,7 @@
 #pragma once
 
 // C++ Includes
+#include <array>
 #include <memory>
 #include <vector>
 #include <string>
@@ -31,12 +32,16 @@
 #include <hw/DragonFalcon.h>
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/interfaces/IDragonMotorController.h>
+#include <hw/ControlSlots.h>
+#include <hw/CurrentGovernor.h>
+#include <hw/SettingCache.h>
 #include <hw/usages/MotorControllerUsage.h>
 
 
 // Third Party Includes
 #include <ctre/phoenix/motorcontrol/RemoteSensorSource.h>
 #include <ctre/phoenix/ErrorCode.h>
+#include <ctre/phoenix/motion/BufferedTrajectoryPointStream.h>
 #include <ctre/phoenix/motorcontrol/can/WPI_TalonFX.h>
 
 
@@ -71,7 +76,7 @@ class DragonFalcon : public IDragonMotorController
         // Setters (override)
         void SetControlMode(ControlModes::CONTROL_TYPE mode) override; //:D
         void Set(double value) override;
-        void Set(std::string nt, double value) override;
+        void Set(const MotorCommand& command) override;
         void SetRotationOffset(double rotations) override;
         void SetVoltageRamping(double ramping, double rampingClosedLoop = -1) override; // seconds 0 to full, set to 0 to disable
         void EnableCurrentLimiting(bool enabled) override; 
@@ -79,8 +84,13 @@ class DragonFalcon : public IDragonMotorController
         void Invert(bool inverted) override; 
         void SetSensorInverted(bool inverted) override;
 
-        /// @brief  Set the control constants (e.g. PIDF values).
-        /// @param [in] int             slot - hardware slot to use
+        /// @brief  Load a set of control constants into a free slot without selecting it
+        /// @param [in] ControlData*    controlInfo - the control constants
+        /// @return int slot the constants are in (-1 - open loop or all of the slots are in use)
+        int PreloadControlConstants(ControlData* controlInfo) override;
+
+        /// @brief  Set the control constants (e.g. PIDF values).  Constants that are already in a slot are only selected.
+        /// @param [in] int             slot - hardware slot to use when all of the slots are in use
         /// @param [in] ControlData*    pid - the control constants
         /// @return void
         void SetControlConstants(int slot, ControlData* controlInfo) override;
@@ -102,6 +112,10 @@ class DragonFalcon : public IDragonMotorController
             int pidIdx, 
             int timeoutMs
         ); 
+        void ConfigIntegratedSensorInitializationStrategy
+        (
+            ctre::phoenix::sensors::SensorInitializationStrategy strategy
+        );
         int ConfigPeakCurrentLimit(int amps, int timeoutMs); 
         int ConfigPeakCurrentDuration(int milliseconds, int timeoutMs); 
         int ConfigContinuousCurrentLimit(int amps, int timeoutMs); 
@@ -126,6 +140,7 @@ class DragonFalcon : public IDragonMotorController
         void SetDiameter( double diameter ) override;
 
         void SetVoltage(units::volt_t output) override;
+        void StopMotor() override;
 
         double GetCountsPerRev() const override {return m_countsPerRev;}
         void UpdateFramePeriods
@@ -155,7 +170,39 @@ class DragonFalcon : public IDragonMotorController
         (
             bool enable
         ) override;
+        uint32_t GetSuppressedSettings() const override { return m_settings.GetSuppressed(); }
+
+        /// @brief  Send the settings collected so far to the motor controller (one ConfigAllSettings call).
+        ///         DragonMotorControllerFactory::ApplyConfigurations calls this for every controller.
+        ///         Nothing is sent when the controller's fingerprint shows it already has the settings.
+        /// @return bool true - the settings were sent, false - the controller already had them
+        bool ApplyConfiguration();
+
+        /// @brief  Run a motion profile from a buffered stream of trajectory points.  Phoenix keeps the
+        ///         Talon's buffer topped up from the stream on its own thread, so the caller only needs
+        ///         to keep the stream alive until IsMotionProfileFinished.
+        /// @param [in] ctre::phoenix::motion::BufferedTrajectoryPointStream& stream:  points to run
+        /// @param [in] uint32_t minBufferedPoints:  points buffered in the Talon before it starts
+        /// @return bool true - the profile was started
+        bool StartMotionProfile
+        (
+            ctre::phoenix::motion::BufferedTrajectoryPointStream&   stream,
+            uint32_t                                                minBufferedPoints
+        );
+
+        /// @brief  Has the Talon run the last point of the motion profile
+        /// @return bool true - finished (or no profile is running)
+        bool IsMotionProfileFinished();
+
     private:
+        void UpdateCommandConversions();
+        void WriteGains(int slot, ControlData* controlInfo);
+        bool SendSetting();
+        void SetPeakScale(double scale);
+        int ConfigSupplyCurrentLimit(int timeoutMs);
+
+        static constexpr int CONFIG_TIMEOUT = 50;   // milliseconds
+
         std::shared_ptr<ctre::phoenix::motorcontrol::can::WPI_TalonFX>  m_talon;
         ControlModes::CONTROL_TYPE m_controlMode;
         MotorControllerUsage::MOTOR_CONTROLLER_USAGE m_type;
@@ -169,5 +216,29 @@ class DragonFalcon : public IDragonMotorController
         double m_countsPerInch;
         double m_countsPerDegree;
         IDragonMotorController::MOTOR_TYPE m_motorType;
+        int m_telemetrySignal;      // output sent to the motor controller is recorded
+        int m_rpsAggregate;         // Logger aggregate handles
+        int m_voltageAggregate;
+        int m_outputCache;          // MotorOutputCache handle
+        int m_framePlan;            // CanFramePlanner handle
+        CurrentGovernor::PRIORITY m_governorPriority;   // scales the open loop outputs and the velocity peak output
+
+        /// @struct CommandConversion
+        /// @brief  CTRE control mode and factor from the command units to native units for a control mode
+        ///         (governed - the CurrentGovernor's scale is applied to the output, governedPeak - closed loop,
+        ///         so the scale is applied to the peak output instead)
+        struct CommandConversion
+        {
+            ctre::phoenix::motorcontrol::TalonFXControlMode  ctreMode;
+            double                                          scale;
+            bool                                            governed;
+            bool                                            governedPeak;
+        };
+        std::array<CommandConversion, ControlModes::CONTROL_TYPE::MAX_CONTROL_TYPES> m_commands;   // indexed by control mode
+        ctre::phoenix::motorcontrol::can::TalonFXConfiguration m_config;     // every setting sent to the controller
+        ControlSlots m_slots;       // gains in each of the hardware slots
+        SettingCache m_settings;    // last value written for the runtime settings
+        bool m_configApplied;       // false - the Config methods only update m_config
+        bool m_fingerprintStored;   // the controller's custom parameters hold the fingerprint of m_config
 };
 
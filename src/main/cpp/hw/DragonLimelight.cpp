@@ -249,12 +249,15 @@ void DragonLimelight::ToggleSnapshot(DragonLimelight::SNAPSHOT_MODE toggle)
 
 void DragonLimelight::PrintValues()
 {
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("PrintValues HasTarget"), to_string( HasTarget() ) );    
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("PrintValues XOffset"), to_string( GetTargetHorizontalOffset().to<double>() ) ); 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("PrintValues YOffset"), to_string( GetTargetVerticalOffset().to<double>() ) ); 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("PrintValues Area"), to_string( GetTargetArea() ) ); 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("PrintValues Skew"), to_string( GetTargetSkew().to<double>() ) ); 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string(":PrintValues Latency"), to_string( GetPipelineLatency().to<double>() ) ); 
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "PrintValues HasTarget", to_string( HasTarget() ) );    
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "PrintValues XOffset", to_string( GetTargetHorizontalOffset().to<double>() ) ); 
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "PrintValues YOffset", to_string( GetTargetVerticalOffset().to<double>() ) ); 
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "PrintValues Area", to_string( GetTargetArea() ) ); 
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "PrintValues Skew", to_string( GetTargetSkew().to<double>() ) ); 
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", ":PrintValues Latency", to_string( GetPipelineLatency().to<double>() ) ); 
+    }
 }
 
 units::length::inch_t DragonLimelight::EstimateTargetDistance() const
@@ -265,12 +268,15 @@ units::length::inch_t DragonLimelight::EstimateTargetDistance() const
 
     auto deltaHgt = GetTargetHeight()-GetMountingHeight();
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("mounting angle "), GetMountingAngle().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("target vertical angle "), GetTargetVerticalOffset().to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("angle radians "), angleRad.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("deltaH "), deltaHgt.to<double>());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("tan angle "), tanAngle);
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonLimelight"), string("distance "), ((GetTargetHeight()-GetMountingHeight()) / tanAngle).to<double>());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "mounting angle ", GetMountingAngle().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "target vertical angle ", GetTargetVerticalOffset().to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "angle radians ", angleRad.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "deltaH ", deltaHgt.to<double>());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "tan angle ", tanAngle);
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, "DragonLimelight", "distance ", ((GetTargetHeight()-GetMountingHeight()) / tanAngle).to<double>());
+    }
 
     return (GetTargetHeight()-GetMountingHeight()) / tanAngle;
 }
@@ -15,6 +15,8 @@
 //====================================================================================================================================================
 
 #include <ctre/phoenix/Sensors/PigeonIMU.h>
+#include <hw/CanFramePlanner.h>
+#include <hw/ConfigFingerprint.h>
 #include <hw/DragonPigeon.h>
 #include <memory>
 
@@ -22,6 +24,11 @@ using namespace std;
 
 using namespace ctre::phoenix::sensors;
 
+namespace
+{
+    constexpr int CONFIG_TIMEOUT = 50;  // milliseconds
+}
+
 DragonPigeon::DragonPigeon
 (
     int    canID,
@@ -37,24 +44,35 @@ DragonPigeon::DragonPigeon
     if (type == DragonPigeon::PIGEON_TYPE::PIGEON1)
     {
         m_pigeon = new WPI_PigeonIMU(canID);
-        m_pigeon->ConfigFactoryDefault();
+        // only the factory defaults are used, so skip them when the fingerprint shows the pigeon has them
+        auto fingerprint = ConfigFingerprint::Compute( PigeonIMUConfiguration().toString() );
+        if ( !ConfigFingerprint::Matches( *m_pigeon, fingerprint, CONFIG_TIMEOUT ) &&
+             m_pigeon->ConfigFactoryDefault( CONFIG_TIMEOUT ) == ctre::phoenix::ErrorCode::OKAY )
+        {
+            ConfigFingerprint::Store( *m_pigeon, fingerprint, CONFIG_TIMEOUT );
+        }
         m_pigeon->SetYaw(rotation, 0);
         m_pigeon->SetFusedHeading( rotation, 0);
-
-        m_pigeon->SetStatusFramePeriod( PigeonIMU_StatusFrame::PigeonIMU_BiasedStatus_4_Mag, 120, 0);
-        m_pigeon->SetStatusFramePeriod( PigeonIMU_StatusFrame::PigeonIMU_CondStatus_11_GyroAccum, 120, 0);
-        m_pigeon->SetStatusFramePeriod( PigeonIMU_StatusFrame::PigeonIMU_BiasedStatus_6_Accel, 120, 0); // using fused heading not yaw
     }
     else
     {
         m_pigeon2 = new WPI_Pigeon2(canID);
-        m_pigeon2->ConfigFactoryDefault();
+        auto fingerprint = ConfigFingerprint::Compute( Pigeon2Configuration().toString() );
+        if ( !ConfigFingerprint::Matches( *m_pigeon2, fingerprint, CONFIG_TIMEOUT ) &&
+             m_pigeon2->ConfigFactoryDefault( CONFIG_TIMEOUT ) == ctre::phoenix::ErrorCode::OKAY )
+        {
+            ConfigFingerprint::Store( *m_pigeon2, fingerprint, CONFIG_TIMEOUT );
+        }
         m_pigeon2->SetYaw(rotation);
-
-        m_pigeon->SetStatusFramePeriod( PigeonIMU_StatusFrame::PigeonIMU_BiasedStatus_4_Mag, 120, 0);
-        m_pigeon->SetStatusFramePeriod( PigeonIMU_StatusFrame::PigeonIMU_CondStatus_11_GyroAccum, 120, 0);
-        m_pigeon->SetStatusFramePeriod( PigeonIMU_StatusFrame::PigeonIMU_BiasedStatus_6_Accel, 120, 0); // using fused heading not yaw
     }
+
+    // the status frames are set by the CanFramePlanner (the same periods for both pigeon types)
+    BasePigeon* pigeon = m_pigeon != nullptr ? static_cast<BasePigeon*>(m_pigeon) : static_cast<BasePigeon*>(m_pigeon2);
+    auto planner = CanFramePlanner::GetInstance();
+    auto framePlan = planner->Register( string("DragonPigeon ") + to_string(canID),
+                                        CanFramePlanner::DEVICE_TYPE::PIGEON,
+                                        [pigeon]( int frame, int periodMs ) { pigeon->SetStatusFramePeriod( static_cast<PigeonIMU_StatusFrame>(frame), static_cast<uint8_t>(periodMs), 0 ); } );
+    planner->SetPriority( framePlan, CanFramePlanner::FRAME_PRIORITY::HIGH );
 }
 
 
@@ -22,14 +22,17 @@
 #include <networktables/NetworkTableInstance.h>
 #include <networktables/NetworkTable.h>
 #include <networktables/NetworkTableEntry.h>
-#include <frc/PowerDistribution.h>
 #include <frc/motorcontrol/MotorController.h>
 
 // Team 302 includes
 #include <hw/interfaces/IDragonMotorController.h>
 #include <hw/DragonTalonSRX.h>
-#include <hw/factories/PDPFactory.h>
 //#include <hw/DragonPDP.h>
+#include <hw/CanFramePlanner.h>
+#include <hw/ConfigFingerprint.h>
+#include <hw/CurrentGovernor.h>
+#include <hw/MotorOutputCache.h>
+#include <hw/PowerMonitor.h>
 #include <hw/usages/MotorControllerUsage.h>
 #include <utils/ConversionUtils.h>
 #include <utils/Logger.h>
@@ -46,6 +49,47 @@ using namespace ctre::phoenix;
 using namespace ctre::phoenix::motorcontrol;
 using namespace ctre::phoenix::motorcontrol::can;
 
+namespace
+{
+	/// @brief the settings for a closed loop slot (0 - 3)
+	SlotConfiguration& GetSlotConfiguration
+	(
+		BaseMotorControllerConfiguration&	config,
+		int									slot
+	)
+	{
+		switch ( slot )
+		{
+			case 1:
+				return config.slot1;
+			case 2:
+				return config.slot2;
+			case 3:
+				return config.slot3;
+			default:
+				return config.slot0;
+		}
+	}
+
+	/// @brief modes that use the gains in a slot
+	bool IsClosedLoop
+	(
+		ControlModes::CONTROL_TYPE	mode
+	)
+	{
+		return mode == ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE ||
+			   mode == ControlModes::CONTROL_TYPE::POSITION_DEGREES ||
+			   mode == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
+			   mode == ControlModes::CONTROL_TYPE::POSITION_INCH ||
+			   mode == ControlModes::CONTROL_TYPE::VELOCITY_DEGREES ||
+			   mode == ControlModes::CONTROL_TYPE::VELOCITY_INCH ||
+			   mode == ControlModes::CONTROL_TYPE::VELOCITY_RPS  ||
+			   mode == ControlModes::CONTROL_TYPE::VOLTAGE ||
+			   mode == ControlModes::CONTROL_TYPE::CURRENT ||
+			   mode == ControlModes::CONTROL_TYPE::TRAPEZOID;
+	}
+}
+
 
 DragonTalonSRX::DragonTalonSRX
 (
@@ -68,217 +112,156 @@ DragonTalonSRX::DragonTalonSRX
 	m_diameter( 1.0 ),
 	m_countsPerInch(countsPerInch),
 	m_countsPerDegree(countsPerDegree),
-	m_motorType(motorType)
+	m_motorType(motorType),
+	m_rpsAggregate(-1),
+	m_outputCache(-1),
+	m_framePlan(-1),
+	m_governorPriority(CurrentGovernor::PRIORITY::UNGOVERNED),
+	m_commands(),
+	m_config(),
+	m_configApplied(false),
+	m_fingerprintStored(false)
 {
-	// for all calls if we get an error log it; for key items try again
 	auto prompt = string("Dragon Talon");
 	prompt += to_string(deviceID);
-	auto error = m_talon.get()->ConfigFactoryDefault();
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigFactoryDefault();
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigFactoryDefault"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-
-	m_talon.get()->SetNeutralMode(NeutralMode::Brake);
-
-	error = m_talon.get()->ConfigNeutralDeadband(0.01, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigNeutralDeadband"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigNominalOutputForward(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigNominalOutputForward(0.0, 0);
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigNominalOutputForward"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigNominalOutputReverse(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigNominalOutputReverse(0.0, 0);
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigNominalOutputReverse"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigOpenloopRamp(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigOpenloopRamp"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigPeakOutputForward(1.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigPeakOutputForward(1.0, 0);
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigPeakOutputForward"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigPeakOutputReverse(-1.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		m_talon.get()->ConfigPeakOutputReverse(-1.0, 0);
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigPeakOutputReverse"), string("error"));
-		error = ErrorCode::OKAY;
-	}
+	m_rpsAggregate = Logger::GetLogger()->RegisterAggregate(prompt, "motor current RPS");
+	m_outputCache = MotorOutputCache::GetInstance()->Register("DragonTalonSRX", deviceID);
+	m_framePlan = CanFramePlanner::GetInstance()->Register( string("DragonTalonSRX ") + to_string(deviceID),
+	                                                        CanFramePlanner::DEVICE_TYPE::TALON_SRX,
+	                                                        [this]( int frame, int periodMs ) { UpdateFramePeriods( static_cast<StatusFrameEnhanced>(frame), static_cast<uint8_t>(periodMs) ); } );
+	m_governorPriority = CurrentGovernor::GetInstance()->Register( deviceType, pdpID );
+	PowerMonitor::GetInstance()->RegisterChannel( pdpID );
+	EnableBrakeMode(true);
+	UpdateCommandConversions();
+
+	// the settings are collected in m_config and sent with one ConfigAllSettings call when
+	// DragonMotorControllerFactory::ApplyConfigurations runs (see ApplyConfiguration)
+	m_config.neutralDeadband = 0.01;
+	m_config.nominalOutputForward = 0.0;
+	m_config.nominalOutputReverse = 0.0;
+	m_config.openloopRamp = 0.0;
+	m_config.peakOutputForward = 1.0;
+	m_config.peakOutputReverse = -1.0;
+
+	m_config.continuousCurrentLimit = 1;
+	m_config.peakCurrentLimit = 1;
+	m_config.peakCurrentDuration = 1;
+
+	m_config.voltageCompSaturation = 12.0;
+
+	m_config.forwardLimitSwitchSource = LimitSwitchSource::LimitSwitchSource_Deactivated;
+	m_config.forwardLimitSwitchNormal = LimitSwitchNormal::LimitSwitchNormal_Disabled;
+	m_config.reverseLimitSwitchSource = LimitSwitchSource::LimitSwitchSource_Deactivated;
+	m_config.reverseLimitSwitchNormal = LimitSwitchNormal::LimitSwitchNormal_Disabled;
+
+	m_config.forwardSoftLimitEnable = false;
+	m_config.forwardSoftLimitThreshold = 0.0;
+	m_config.reverseSoftLimitEnable = false;
+	m_config.reverseSoftLimitThreshold = 0.0;
+
+	m_config.motionAcceleration = 1500.0;
+	m_config.motionCruiseVelocity = 1500.0;
+	m_config.motionCurveStrength = 0;
+	m_config.motionProfileTrajectoryPeriod = 0;
+	m_config.trajectoryInterpolationEnable = true;
 
-	SupplyCurrentLimitConfiguration climit;
-	climit.enable = false;
-	climit.currentLimit = 1.0;
-	climit.triggerThresholdCurrent = 1.0;
-	climit.triggerThresholdTime = 0.001;
-	error = m_talon.get()->ConfigSupplyCurrentLimit(climit, 50);
-	if ( error != ErrorCode::OKAY )
+	for ( auto inx=0; inx<4; ++inx )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigSupplyCurrentLimit"), string("error"));
-		error = ErrorCode::OKAY;
+		auto& slot = GetSlotConfiguration(m_config, inx);
+		slot.allowableClosedloopError = 0.0;
+		slot.closedLoopPeakOutput = 1.0;
+		slot.closedLoopPeriod = 10;
+		slot.kP = 0.01;
+		slot.kI = 0.0;
+		slot.kD = 0.0;
+		slot.kF = 1.0;
+		slot.integralZone = 0.0;
 	}
 
-	error = m_talon.get()->ConfigVoltageCompSaturation(12.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigVoltageCompSaturation"), string("error"));
-		error = ErrorCode::OKAY;
-	}
+	m_config.remoteFilter0.remoteSensorDeviceID = 60;
+	m_config.remoteFilter0.remoteSensorSource = RemoteSensorSource::RemoteSensorSource_Off;
+	m_config.remoteFilter1.remoteSensorDeviceID = 60;
+	m_config.remoteFilter1.remoteSensorSource = RemoteSensorSource::RemoteSensorSource_Off;
+}
 
-	error = m_talon.get()->ConfigForwardLimitSwitchSource(LimitSwitchSource::LimitSwitchSource_Deactivated, LimitSwitchNormal::LimitSwitchNormal_Disabled, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigForwardLimitSwitchSource"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigReverseLimitSwitchSource(LimitSwitchSource::LimitSwitchSource_Deactivated, LimitSwitchNormal::LimitSwitchNormal_Disabled, 0);
-	if ( error != ErrorCode::OKAY )
+/// @brief  Send the settings collected in m_config to the motor controller:  factory defaults and then one
+///         ConfigAllSettings call.  Until this is called the Config methods only update m_config; afterwards
+///         they update m_config and send the individual setting.
+///
+///         The fingerprint of m_config is kept in the controller's custom parameters (see ConfigFingerprint).
+///         When it matches, the controller already has these settings from an earlier run, so nothing is sent.
+/// @return bool true - the settings were sent, false - the controller already had them
+bool DragonTalonSRX::ApplyConfiguration()
+{
+	if ( m_configApplied )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigReverseLimitSwitchSource"), string("error"));
-		error = ErrorCode::OKAY;
+		return false;
 	}
 
-	error = m_talon.get()->ConfigForwardSoftLimitEnable(false, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigForwardSoftLimitEnable"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigForwardSoftLimitThreshold(0.0, 0);
-	if ( error != ErrorCode::OKAY )
+	auto fingerprint = ConfigFingerprint::Compute( m_config.toString() );
+	if ( ConfigFingerprint::Matches( *m_talon.get(), fingerprint, CONFIG_TIMEOUT ) )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigForwardSoftLimitThreshold"), string("error"));
-		error = ErrorCode::OKAY;
+		m_configApplied = true;
+		m_fingerprintStored = true;
+		return false;
 	}
 
-	error = m_talon.get()->ConfigReverseSoftLimitEnable(false, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigReverseSoftLimitEnable"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigReverseSoftLimitThreshold(0.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigReverseSoftLimitThreshold"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	
-	
-	error = m_talon.get()->ConfigMotionAcceleration(1500.0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigMotionAcceleration"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigMotionCruiseVelocity(1500.0, 0);
+	auto prompt = string("Dragon Talon");
+	prompt += to_string(m_id);
+	auto error = m_talon.get()->ConfigFactoryDefault(CONFIG_TIMEOUT);
 	if ( error != ErrorCode::OKAY )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigMotionCruiseVelocity"), string("error"));
-		error = ErrorCode::OKAY;
+		m_talon.get()->ConfigFactoryDefault(CONFIG_TIMEOUT);
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigFactoryDefault"), string("error"));
 	}
-	error = m_talon.get()->ConfigMotionSCurveStrength(0, 0);
+	error = m_talon.get()->ConfigAllSettings(m_config, CONFIG_TIMEOUT);
 	if ( error != ErrorCode::OKAY )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigMotionSCurveStrength"), string("error"));
-		error = ErrorCode::OKAY;
+		error = m_talon.get()->ConfigAllSettings(m_config, CONFIG_TIMEOUT);
+		if ( error != ErrorCode::OKAY )
+		{
+			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigAllSettings"), string("error"));
+		}
 	}
 
-	error = m_talon.get()->ConfigMotionProfileTrajectoryPeriod(0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigMotionProfileTrajectoryPeriod"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigMotionProfileTrajectoryInterpolationEnable(true, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigMotionProfileTrajectoryInterpolationEnable"), string("error"));
-		error = ErrorCode::OKAY;
-	}
+	// only a complete configuration gets a fingerprint, so a failed one is sent again on the next run
+	m_fingerprintStored = ( error == ErrorCode::OKAY ) && ConfigFingerprint::Store( *m_talon.get(), fingerprint, CONFIG_TIMEOUT );
+	m_configApplied = true;
+	return true;
+}
 
-	m_talon.get()->ConfigAllowableClosedloopError(0.0, 0);
-	if ( error != ErrorCode::OKAY )
+/// @brief  A setting changed after the configuration was applied.  The controller no longer has the settings
+///         its fingerprint describes, so the fingerprint is cleared (once) and the next run configures it again.
+/// @return bool true - send the setting now, false - only m_config needs to be updated
+bool DragonTalonSRX::SendSetting()
+{
+	if ( !m_configApplied )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigAllowableClosedloopError"), string("error"));
-		error = ErrorCode::OKAY;
+		return false;
 	}
-
-	for ( auto inx=0; inx<4; ++inx )
+	if ( m_fingerprintStored )
 	{
-		error = m_talon.get()->ConfigClosedLoopPeakOutput(inx, 1.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigClosedLoopPeakOutput"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->ConfigClosedLoopPeriod(inx, 10, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigClosedLoopPeriod"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kP(inx, 0.01, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("Config_kP"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kI(inx, 0.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("Config_kI"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kD(inx, 0.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("Config_kD"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_kF(inx, 1.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("Config_kF"), string("error"));
-			error = ErrorCode::OKAY;
-		}
-		error = m_talon.get()->Config_IntegralZone(inx, 0.0, 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("Config_IntegralZone"), string("error"));
-			error = ErrorCode::OKAY;
-		}
+		ConfigFingerprint::Clear( *m_talon.get() );
+		m_fingerprintStored = false;
 	}
+	return true;
+}
 
-	error = m_talon.get()->ConfigRemoteFeedbackFilter(60, RemoteSensorSource::RemoteSensorSource_Off, 0, 0);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigRemoteFeedbackFilter"), string("error"));
-		error = ErrorCode::OKAY;
-	}
-	error = m_talon.get()->ConfigRemoteFeedbackFilter(60, RemoteSensorSource::RemoteSensorSource_Off, 1, 0);
-	if ( error != ErrorCode::OKAY )
+/// @brief  Scale the peak output by the CurrentGovernor's scale.  A closed loop keeps pushing until it reaches
+///         its setpoint, so a stalled or spinning up motor draws the same current whatever the setpoint is; the
+///         peak output is what limits it.  The scaled peak isn't kept in m_config (it isn't part of the
+///         fingerprint) and is sent without waiting, only when the scale changes.  The first call after start up
+///         always sends it:  the controller keeps a scaled peak output across a code restart (e.g. during a brownout).
+/// @param [in] double  scale - factor for the configured peak output (1.0 - the configured peak output)
+/// @return void
+void DragonTalonSRX::SetPeakScale(double scale)
+{
+	if ( !m_configApplied || !m_settings.ShouldWrite(SettingCache::SETTING::PEAK_SCALE, scale) )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, prompt, string("ConfigRemoteFeedbackFilter"), string("error"));
+		return;
 	}
+	m_talon.get()->ConfigPeakOutputForward(m_config.peakOutputForward * scale, 0);
+	m_talon.get()->ConfigPeakOutputReverse(m_config.peakOutputReverse * scale, 0);
 }
 
 double DragonTalonSRX::GetRotations() const
@@ -311,12 +294,7 @@ shared_ptr<MotorController> DragonTalonSRX::GetSpeedController() const
 
 double DragonTalonSRX::GetCurrent() const
 {
-	auto pdp = PDPFactory::GetFactory()->GetPDP();
-	if (pdp != nullptr)
-	{
-		return pdp->GetCurrent(m_pdp);
-	}
-	return 0.0;
+	return PowerMonitor::GetInstance()->GetCurrent(m_pdp);
 }
 
 void DragonTalonSRX::UpdateFramePeriods
@@ -327,56 +305,26 @@ void DragonTalonSRX::UpdateFramePeriods
 {
 	m_talon.get()->SetStatusFramePeriod( frame, milliseconds, 0 );
 }
+/// @brief  Set the status frame periods through the CanFramePlanner (it may slow MEDIUM / LOW controllers
+///         down further to keep the bus within its budget).  Can be called again when a mechanism's state changes.
 void DragonTalonSRX::SetFramePeriodPriority
 (
 	MOTOR_PRIORITY              priority
 )
 {
+	auto planner = CanFramePlanner::GetInstance();
 	switch ( priority )
 	{
 		case HIGH:
-			UpdateFramePeriods( StatusFrameEnhanced::Status_1_General, 10 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_2_Feedback0, 20 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_3_Quadrature, 100 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_4_AinTempVbat, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_8_PulseWidth, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_10_Targets, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_11_UartGadgeteer, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_12_Feedback1, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_13_Base_PIDF0, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_14_Turn_PIDF1, 120 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_15_FirmareApiStatus, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_Brushless_Current, 200 );
+			planner->SetPriority( m_framePlan, CanFramePlanner::FRAME_PRIORITY::HIGH );
 			break;
 
 		case MEDIUM:
-			UpdateFramePeriods( StatusFrameEnhanced::Status_1_General, 20 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_2_Feedback0, 30 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_3_Quadrature, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_4_AinTempVbat, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_8_PulseWidth, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_10_Targets, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_11_UartGadgeteer, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_12_Feedback1, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_13_Base_PIDF0, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_14_Turn_PIDF1, 150 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_15_FirmareApiStatus, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_Brushless_Current, 200 );
+			planner->SetPriority( m_framePlan, CanFramePlanner::FRAME_PRIORITY::MEDIUM );
 			break;
 
 		case LOW:
-			UpdateFramePeriods( StatusFrameEnhanced::Status_1_General, 30 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_2_Feedback0, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_3_Quadrature, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_4_AinTempVbat, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_8_PulseWidth, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_10_Targets, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_11_UartGadgeteer, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_12_Feedback1, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_13_Base_PIDF0, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_14_Turn_PIDF1, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_15_FirmareApiStatus, 200 );
-			UpdateFramePeriods( StatusFrameEnhanced::Status_Brushless_Current, 200 );
+			planner->SetPriority( m_framePlan, CanFramePlanner::FRAME_PRIORITY::LOW );
 			break;
 
 		default:
@@ -385,138 +333,119 @@ void DragonTalonSRX::SetFramePeriodPriority
 	}
 }
 
-void DragonTalonSRX::Set(std::string nt, double value)
+/// @brief  Set the control mode and target.  The CTRE mode and the factor to native units come from
+///         m_commands (see UpdateCommandConversions), so there is nothing to work out per call.
+/// @param [in] const MotorCommand& command - control mode and target
+void DragonTalonSRX::Set(const MotorCommand& command)
 {
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("motor id"), m_talon.get()->GetDeviceID());
+	m_controlMode = command.GetMode();
+	auto logger = Logger::GetLogger();
+	if ( logger->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT) )
+	{
+		logger->LogAggregate(Logger::LOGGER_LEVEL::PRINT, m_rpsAggregate, GetRPS());
+	}
+	auto& conversion = m_commands[m_controlMode < ControlModes::CONTROL_TYPE::MAX_CONTROL_TYPES ? m_controlMode : ControlModes::CONTROL_TYPE::PERCENT_OUTPUT];
+	auto value = command.GetValue();
+	if ( conversion.governed )
+	{
+		value *= CurrentGovernor::GetInstance()->GetScale(m_governorPriority);
+	}
+	SetPeakScale(conversion.governedPeak ? CurrentGovernor::GetInstance()->GetPeakScale(m_governorPriority) : 1.0);
 
-	if ( m_controlMode == ControlModes::CONTROL_TYPE::VOLTAGE)
+	if ( m_controlMode == ControlModes::CONTROL_TYPE::VOLTAGE )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("motor target output voltage"), value);
 		m_talon.get()->SetVoltage(units::voltage::volt_t(value));
+		MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
+		return;
 	}
-	else
+
+	auto output = value * conversion.scale;
+	if (MotorOutputCache::GetInstance()->ShouldSend(m_outputCache, m_controlMode, static_cast<int>(conversion.ctreMode), output))
 	{
-		auto output = value;
-		ctre::phoenix::motorcontrol::ControlMode ctreMode = ctre::phoenix::motorcontrol::ControlMode::PercentOutput;
-		switch (m_controlMode)
+		m_talon.get()->Set( conversion.ctreMode, output );
+	}
+}
+
+void DragonTalonSRX::Set(double value)
+{
+	Set(MotorCommand(m_controlMode, value));
+}
+
+/// @brief  Work out the CTRE control mode and the factor from the command units to native units for
+///         every control mode.  Called when the controller is created and when the diameter changes.
+void DragonTalonSRX::UpdateCommandConversions()
+{
+	for ( auto mode=0; mode<ControlModes::CONTROL_TYPE::MAX_CONTROL_TYPES; ++mode )
+	{
+		auto& conversion = m_commands[mode];
+		conversion.scale = 1.0;
+		switch (mode)
 		{
 			case ControlModes::CONTROL_TYPE::PERCENT_OUTPUT:
-				ctreMode = ctre::phoenix::motorcontrol::ControlMode::PercentOutput;
+			case ControlModes::CONTROL_TYPE::VOLTAGE:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::PercentOutput;
 				break;
 				
 			case ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE:
-			case ControlModes::CONTROL_TYPE::POSITION_DEGREES:
-			case ControlModes::CONTROL_TYPE::POSITION_INCH:
-				ctreMode =:: ctre::phoenix::motorcontrol::ControlMode::Position;
-				break;
-
-			case ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE:
-			case ControlModes::CONTROL_TYPE::TRAPEZOID:
-				ctreMode =:: ctre::phoenix::motorcontrol::ControlMode::MotionMagic;
-				break;
-			
-			case ControlModes::CONTROL_TYPE::VELOCITY_DEGREES:
-			case ControlModes::CONTROL_TYPE::VELOCITY_INCH:
-			case ControlModes::CONTROL_TYPE::VELOCITY_RPS:
-				ctreMode = ctre::phoenix::motorcontrol::ControlMode::Velocity;
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::Position;
 				break;
 
-			case ControlModes::CONTROL_TYPE::CURRENT:
-				ctreMode = ctre::phoenix::motorcontrol::ControlMode::Current;
-				break;
-
-			case ControlModes::CONTROL_TYPE::MOTION_PROFILE:
-				ctreMode = ctre::phoenix::motorcontrol::ControlMode::MotionProfile;
-				break;
-
-			case ControlModes::CONTROL_TYPE::MOTION_PROFILE_ARC:
-				ctreMode = ctre::phoenix::motorcontrol::ControlMode::MotionProfileArc;
+			case ControlModes::CONTROL_TYPE::POSITION_DEGREES:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::Position;
+				conversion.scale = m_countsPerDegree > 0.01 ? m_countsPerDegree : ConversionUtils::DegreesToCounts(1.0, m_countsPerRev) * m_gearRatio;
 				break;
 
-			default:
-				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("DragonTalonSRX"), string("SetControlMode"), string("Invalid Control Mode"));
-				ctreMode = ctre::phoenix::motorcontrol::ControlMode::PercentOutput;
+			case ControlModes::CONTROL_TYPE::POSITION_INCH:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::Position;
+				conversion.scale = m_countsPerInch > 0.01 ? m_countsPerInch : ConversionUtils::InchesToCounts(1.0, m_countsPerRev, m_diameter) * m_gearRatio;
 				break;
-		}	
 
-		switch (m_controlMode)
-		{
-			case ControlModes::CONTROL_TYPE::POSITION_DEGREES:
-				if (m_countsPerDegree > 0.01)
-				{
-					output = m_countsPerDegree*value;
-				}
-				else
-				{
-					output = (ConversionUtils::DegreesToCounts(value,m_countsPerRev) * m_gearRatio);
-				}
+			case ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::MotionMagic;
 				break;
 
-			case ControlModes::CONTROL_TYPE::POSITION_INCH:
 			case ControlModes::CONTROL_TYPE::TRAPEZOID:
-				if (m_countsPerInch > 0.01)
-				{
-					output = m_countsPerInch*value;
-				}
-				else
-				{
-					output = (ConversionUtils::InchesToCounts(value, m_countsPerRev, m_diameter) * m_gearRatio);
-				}
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::MotionMagic;
+				conversion.scale = m_countsPerInch > 0.01 ? m_countsPerInch : ConversionUtils::InchesToCounts(1.0, m_countsPerRev, m_diameter) * m_gearRatio;
 				break;
 			
 			case ControlModes::CONTROL_TYPE::VELOCITY_DEGREES:
-				if (m_countsPerDegree > 0.01)
-				{
-					output = m_countsPerDegree*value * 0.1;
-				}
-				else
-				{
-					output = (ConversionUtils::DegreesPerSecondToCounts100ms( value, m_countsPerRev ) * m_gearRatio);
-				}
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::Velocity;
+				conversion.scale = m_countsPerDegree > 0.01 ? m_countsPerDegree * 0.1 : ConversionUtils::DegreesPerSecondToCounts100ms(1.0, m_countsPerRev) * m_gearRatio;
 				break;
 
 			case ControlModes::CONTROL_TYPE::VELOCITY_INCH:
-				if (m_countsPerInch > 0.01)
-				{
-					output = m_countsPerInch*value *0.1;
-				}
-				else
-				{
-					output = (ConversionUtils::InchesPerSecondToCounts100ms( value, m_countsPerRev, m_diameter ) * m_gearRatio);
-				}
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::Velocity;
+				conversion.scale = m_countsPerInch > 0.01 ? m_countsPerInch * 0.1 : ConversionUtils::InchesPerSecondToCounts100ms(1.0, m_countsPerRev, m_diameter) * m_gearRatio;
 				break;
 
 			case ControlModes::CONTROL_TYPE::VELOCITY_RPS:
-				if (m_countsPerDegree > 0.01)
-				{
-					output = value * 360.0 * m_countsPerDegree * 0.1;
-				}
-				else
-				{
-					output = (ConversionUtils::RPSToCounts100ms( value, m_countsPerRev ) * m_gearRatio);
-				}
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::Velocity;
+				conversion.scale = m_countsPerDegree > 0.01 ? 360.0 * m_countsPerDegree * 0.1 : ConversionUtils::RPSToCounts100ms(1.0, m_countsPerRev) * m_gearRatio;
 				break;
 
-			default:
+			case ControlModes::CONTROL_TYPE::CURRENT:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::Current;
 				break;
-		}	
 
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("motor target output"), output);
+			case ControlModes::CONTROL_TYPE::MOTION_PROFILE:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::MotionProfile;
+				break;
 
-		m_talon.get()->Set( ctreMode, output );
+			case ControlModes::CONTROL_TYPE::MOTION_PROFILE_ARC:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::MotionProfileArc;
+				break;
 
+			default:
+				conversion.ctreMode = ctre::phoenix::motorcontrol::ControlMode::PercentOutput;
+				break;
+		}
+		conversion.governed = mode == ControlModes::CONTROL_TYPE::PERCENT_OUTPUT ||
+							  mode == ControlModes::CONTROL_TYPE::VOLTAGE;
+		conversion.governedPeak = conversion.ctreMode == ctre::phoenix::motorcontrol::ControlMode::Velocity;
 	}
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("motor current percent output"), m_talon.get()->Get() );
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, nt, string("motor current RPS"), GetRPS() );
 }
 
-void DragonTalonSRX::Set(double value)
-{
-	auto id = m_talon.get()->GetDeviceID();
-	auto ntName = std::string("MotorOutput");
-	ntName += to_string(id);
-	Set(ntName, value);
-}
 void DragonTalonSRX::SetRotationOffset(double rotations)
 {
 //	double newRotations = -rotations + DragonTalonSRX::GetRotations();
@@ -525,33 +454,56 @@ void DragonTalonSRX::SetRotationOffset(double rotations)
 
 void DragonTalonSRX::SetVoltageRamping(double ramping, double rampingClosedLoop)
 {
-    m_talon.get()->ConfigOpenloopRamp(ramping);
+    if ( m_settings.ConfigChanged(m_config.openloopRamp != ramping) )
+    {
+        m_config.openloopRamp = ramping;
+        if ( SendSetting() )
+        {
+            m_talon.get()->ConfigOpenloopRamp(ramping);
+        }
+    }
 
-    if (rampingClosedLoop >= 0)
+    if (rampingClosedLoop >= 0 && m_settings.ConfigChanged(m_config.closedloopRamp != rampingClosedLoop))
     {
-  	m_talon.get()->ConfigClosedloopRamp(rampingClosedLoop);
+        m_config.closedloopRamp = rampingClosedLoop;
+        if ( SendSetting() )
+        {
+            m_talon.get()->ConfigClosedloopRamp(rampingClosedLoop);
+        }
     }
 }
 
 
 void DragonTalonSRX::EnableCurrentLimiting(bool enabled)
 {
-    m_talon.get()->EnableCurrentLimit(enabled);
+    if ( m_settings.ShouldWrite(SettingCache::SETTING::CURRENT_LIMIT, enabled) )
+    {
+        m_talon.get()->EnableCurrentLimit(enabled);
+    }
 }
 
 void DragonTalonSRX::EnableBrakeMode(bool enabled)
 {
-    m_talon.get()->SetNeutralMode(enabled ? ctre::phoenix::motorcontrol::NeutralMode::Brake : ctre::phoenix::motorcontrol::NeutralMode::Coast);
+    if ( m_settings.ShouldWrite(SettingCache::SETTING::NEUTRAL_MODE, enabled) )
+    {
+        m_talon.get()->SetNeutralMode(enabled ? ctre::phoenix::motorcontrol::NeutralMode::Brake : ctre::phoenix::motorcontrol::NeutralMode::Coast);
+    }
 }
 
 void DragonTalonSRX::Invert(bool inverted)
 {
-    m_talon.get()->SetInverted(inverted);
+    if ( m_settings.ShouldWrite(SettingCache::SETTING::INVERTED, inverted) )
+    {
+        m_talon.get()->SetInverted(inverted);
+    }
 }
 
 void DragonTalonSRX::SetSensorInverted(bool inverted)
 {
-    m_talon.get()->SetSensorPhase(inverted);
+    if ( m_settings.ShouldWrite(SettingCache::SETTING::SENSOR_PHASE, inverted) )
+    {
+        m_talon.get()->SetSensorPhase(inverted);
+    }
 }
 
 MotorControllerUsage::MOTOR_CONTROLLER_USAGE DragonTalonSRX::GetType() const
@@ -576,6 +528,11 @@ void DragonTalonSRX::SelectClosedLoopProfile
 )
 {
 	auto error = m_talon.get()->SelectProfileSlot( slot, pidIndex );
+	MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
+	if ( pidIndex == 0 )
+	{
+		m_slots.SetSelected(slot);
+	}
 	if ( error != ErrorCode::OKAY )
 	{
 		auto prompt = string("Dragon Talon");
@@ -592,8 +549,11 @@ int DragonTalonSRX::ConfigSelectedFeedbackSensor
 	int timeoutMs
 )
 {
+	auto& pid = ( pidIdx == 0 ) ? m_config.primaryPID : m_config.auxiliaryPID;
+	pid.selectedFeedbackSensor = feedbackDevice;
+
 	int error = 0;
-	if ( m_talon.get() != nullptr )
+	if ( m_talon.get() != nullptr && SendSetting() )
 	{
 		error = m_talon.get()->ConfigSelectedFeedbackSensor( feedbackDevice, pidIdx, timeoutMs );
 	}
@@ -607,8 +567,11 @@ int DragonTalonSRX::ConfigSelectedFeedbackSensor
 	int timeoutMs
 )
 {
+	auto& pid = ( pidIdx == 0 ) ? m_config.primaryPID : m_config.auxiliaryPID;
+	pid.selectedFeedbackSensor = static_cast<FeedbackDevice>(feedbackDevice);
+
 	int error = 0;
-	if ( m_talon.get() != nullptr )
+	if ( m_talon.get() != nullptr && SendSetting() )
 	{
 		error = m_talon.get()->ConfigSelectedFeedbackSensor( feedbackDevice, pidIdx, timeoutMs );
 	}
@@ -621,8 +584,10 @@ int DragonTalonSRX::ConfigPeakCurrentLimit
 	int timeoutMs
 )
 {
+	m_config.peakCurrentLimit = amps;
+
 	int error = 0;
-	if ( m_talon.get() != nullptr )
+	if ( m_talon.get() != nullptr && SendSetting() )
 	{
 		error = m_talon.get()->ConfigPeakCurrentLimit( amps, timeoutMs );
 	}
@@ -635,8 +600,10 @@ int DragonTalonSRX::ConfigPeakCurrentDuration
 	int timeoutMs
 )
 {
+	m_config.peakCurrentDuration = milliseconds;
+
 	int error = 0;
-	if ( m_talon.get() != nullptr )
+	if ( m_talon.get() != nullptr && SendSetting() )
 	{
 		error = m_talon.get()->ConfigPeakCurrentDuration( milliseconds, timeoutMs );
 	}
@@ -649,8 +616,10 @@ int DragonTalonSRX::ConfigContinuousCurrentLimit
 	int timeoutMs
 )
 {
+	m_config.continuousCurrentLimit = amps;
+
 	int error = 0;
-	if ( m_talon.get() != nullptr )
+	if ( m_talon.get() != nullptr && SendSetting() )
 	{
 		error = m_talon.get()->ConfigContinuousCurrentLimit( amps, timeoutMs );
 	}
@@ -663,16 +632,41 @@ void DragonTalonSRX::SetAsFollowerMotor
 )
 {
     m_talon.get()->Set( ControlMode::Follower, masterCANID );
+    MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
 }
 
 
-/// @brief  Set the control constants (e.g. PIDF values).
-/// @param [in] int             slot - hardware slot to use
+/// @brief  Load a set of control constants into a free slot without selecting it.  The states call this when
+///         they are created, so SetControlConstants only has to select the slot when they are entered.
+/// @param [in] ControlData*    controlInfo - the control constants
+/// @return int slot the constants are in (-1 - open loop or all of the slots are in use)
+int DragonTalonSRX::PreloadControlConstants(ControlData* controlInfo)
+{
+	if ( !IsClosedLoop(controlInfo->GetMode()) )
+	{
+		return -1;
+	}
+	auto slot = m_slots.Find(controlInfo);
+	if ( slot < 0 )
+	{
+		slot = m_slots.Assign(controlInfo, -1);
+		if ( slot >= 0 )
+		{
+			WriteGains(slot, controlInfo);
+		}
+	}
+	return slot;
+}
+
+/// @brief  Set the control constants (e.g. PIDF values).  Gains that are already in a slot (preloaded or
+///         used before) are only selected; nothing is sent when the slot is already selected.
+/// @param [in] int             slot - hardware slot to use when all of the slots are in use
 /// @param [in] ControlData*    pid - the control constants
 /// @return void
 void DragonTalonSRX::SetControlConstants(int slot, ControlData* controlInfo)
 {
 	SetControlMode(controlInfo->GetMode());
+	MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
 
 	auto prompt = string("Dragon Talon");
 	prompt += to_string(m_talon.get()->GetDeviceID());
@@ -680,104 +674,164 @@ void DragonTalonSRX::SetControlConstants(int slot, ControlData* controlInfo)
 	auto id = m_talon.get()->GetDeviceID();
 	auto ntName = std::string("MotorOutput");
 	ntName += to_string(id);
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("P"), controlInfo->GetP());
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("I"), controlInfo->GetI());
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("D"), controlInfo->GetD());
-	Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("F"), controlInfo->GetF());
-
-	auto peak = controlInfo->GetPeakValue();
-	auto error = m_talon.get()->ConfigPeakOutputForward(peak);
-	if ( error != ErrorCode::OKAY )
+	if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigPeakOutputForward error"));
-	}
-	error = m_talon.get()->ConfigPeakOutputReverse(-1.0*peak);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigPeakOutputReverse error"));
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "P", controlInfo->GetP());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "I", controlInfo->GetI());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "D", controlInfo->GetD());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "F", controlInfo->GetF());
 	}
 
+	auto error = ErrorCode::OKAY;
+	auto peak = controlInfo->GetPeakValue();
 	auto nom = controlInfo->GetNominalValue();
-	error = m_talon.get()->ConfigNominalOutputForward(nom);
-	if ( error != ErrorCode::OKAY )
-	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigNominalOutputForward error"));
-	}
-	error = m_talon.get()->ConfigNominalOutputReverse(-1.0*nom);
-	if ( error != ErrorCode::OKAY )
+	if ( m_config.peakOutputForward != peak || m_config.peakOutputReverse != -1.0*peak ||
+		 m_config.nominalOutputForward != nom || m_config.nominalOutputReverse != -1.0*nom )
 	{
-		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigNominalOutputReverse error"));
-	}
+		m_config.peakOutputForward = peak;
+		m_config.peakOutputReverse = -1.0*peak;
+		m_config.nominalOutputForward = nom;
+		m_config.nominalOutputReverse = -1.0*nom;
 
-	if ( controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_DEGREES ||
-	     controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_INCH ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_DEGREES ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_INCH ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VELOCITY_RPS  ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::VOLTAGE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::CURRENT ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::TRAPEZOID )
-	{
-		error = m_talon.get()->Config_kP(slot, controlInfo->GetP());
-		if ( error != ErrorCode::OKAY )
-		{
-			m_talon.get()->Config_kP(slot, controlInfo->GetP());
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kP error"));
-		}
-		error = m_talon.get()->Config_kI(slot, controlInfo->GetI());
-		if ( error != ErrorCode::OKAY )
-		{
-			m_talon.get()->Config_kI(slot, controlInfo->GetI());
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kI error"));
-		}
-		error = m_talon.get()->Config_kD(slot, controlInfo->GetD());
-		if ( error != ErrorCode::OKAY )
+		if ( SendSetting() )
 		{
-			m_talon.get()->Config_kD(slot, controlInfo->GetD());
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kD error"));
+			error = m_talon.get()->ConfigPeakOutputForward(peak);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigPeakOutputForward error"));
+			}
+			error = m_talon.get()->ConfigPeakOutputReverse(-1.0*peak);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigPeakOutputReverse error"));
+			}
+			m_settings.Remember(SettingCache::SETTING::PEAK_SCALE, 1.0);
+
+			error = m_talon.get()->ConfigNominalOutputForward(nom);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigNominalOutputForward error"));
+			}
+			error = m_talon.get()->ConfigNominalOutputReverse(-1.0*nom);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigNominalOutputReverse error"));
+			}
 		}
-		error = m_talon.get()->Config_kF(slot, controlInfo->GetF());
-		if ( error != ErrorCode::OKAY )
+	}
+
+	if ( IsClosedLoop(controlInfo->GetMode()) )
+	{
+		auto loaded = m_slots.Find(controlInfo);
+		if ( loaded < 0 )
 		{
-			m_talon.get()->Config_kF(slot, controlInfo->GetF());
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kF error"));
+			loaded = m_slots.Assign(controlInfo, slot);
+			if ( loaded < 0 )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("invalid slot"));
+				return;
+			}
+			WriteGains(loaded, controlInfo);
 		}
-		error = m_talon.get()->SelectProfileSlot(slot, 0);
-		if ( error != ErrorCode::OKAY )
+		if ( loaded != m_slots.GetSelected() )
 		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("SelectProfileSlot error"));
+			error = m_talon.get()->SelectProfileSlot(loaded, 0);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("SelectProfileSlot error"));
+			}
+			m_slots.SetSelected(loaded);
 		}
 	}
 
 	
 	if ( //controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE ||
-		 controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
-	     controlInfo->GetMode() == ControlModes::CONTROL_TYPE::TRAPEZOID  )
-	{
-		error = m_talon.get()->ConfigMotionAcceleration( controlInfo->GetMaxAcceleration() );
-		if ( error != ErrorCode::OKAY )
+		 ( controlInfo->GetMode() == ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE ||
+	       controlInfo->GetMode() == ControlModes::CONTROL_TYPE::TRAPEZOID ) &&
+		 ( m_config.motionAcceleration != controlInfo->GetMaxAcceleration() ||
+		   m_config.motionCruiseVelocity != controlInfo->GetCruiseVelocity() ) )
+	{
+		m_config.motionAcceleration = controlInfo->GetMaxAcceleration();
+		m_config.motionCruiseVelocity = controlInfo->GetCruiseVelocity();
+		if ( SendSetting() )
 		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigMotionAcceleration error"));
-		}
-		error = m_talon.get()->ConfigMotionCruiseVelocity( controlInfo->GetCruiseVelocity(), 0);
-		if ( error != ErrorCode::OKAY )
-		{
-			Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigMotionCruiseVelocity error"));
+			error = m_talon.get()->ConfigMotionAcceleration( controlInfo->GetMaxAcceleration() );
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigMotionAcceleration error"));
+			}
+			error = m_talon.get()->ConfigMotionCruiseVelocity( controlInfo->GetCruiseVelocity(), 0);
+			if ( error != ErrorCode::OKAY )
+			{
+				Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("ConfigMotionCruiseVelocity error"));
+			}
 		}
+	}
+}
+
+/// @brief  Put the gains in a slot (they go out with ConfigAllSettings if the configuration
+///         hasn't been applied yet).
+void DragonTalonSRX::WriteGains(int slot, ControlData* controlInfo)
+{
+	auto& slotConfig = GetSlotConfiguration(m_config, slot);
+	slotConfig.kP = controlInfo->GetP();
+	slotConfig.kI = controlInfo->GetI();
+	slotConfig.kD = controlInfo->GetD();
+	slotConfig.kF = controlInfo->GetF();
+	if ( !SendSetting() )
+	{
+		return;
+	}
 
+	auto prompt = string("Dragon Talon");
+	prompt += to_string(m_talon.get()->GetDeviceID());
+	auto ntName = std::string("MotorOutput");
+	ntName += to_string(m_talon.get()->GetDeviceID());
+
+	auto error = m_talon.get()->Config_kP(slot, controlInfo->GetP());
+	if ( error != ErrorCode::OKAY )
+	{
+		m_talon.get()->Config_kP(slot, controlInfo->GetP());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kP error"));
+	}
+	error = m_talon.get()->Config_kI(slot, controlInfo->GetI());
+	if ( error != ErrorCode::OKAY )
+	{
+		m_talon.get()->Config_kI(slot, controlInfo->GetI());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kI error"));
+	}
+	error = m_talon.get()->Config_kD(slot, controlInfo->GetD());
+	if ( error != ErrorCode::OKAY )
+	{
+		m_talon.get()->Config_kD(slot, controlInfo->GetD());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kD error"));
+	}
+	error = m_talon.get()->Config_kF(slot, controlInfo->GetF());
+	if ( error != ErrorCode::OKAY )
+	{
+		m_talon.get()->Config_kF(slot, controlInfo->GetF());
+		Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, ntName, prompt, string("Config_kF error"));
 	}
 }
 
+
 void DragonTalonSRX::SetForwardLimitSwitch
 ( 
 	bool normallyOpen
 )
 {
 	LimitSwitchNormal type = normallyOpen ? LimitSwitchNormal::LimitSwitchNormal_NormallyOpen : LimitSwitchNormal::LimitSwitchNormal_NormallyClosed;
-	m_talon.get()->ConfigForwardLimitSwitchSource( LimitSwitchSource::LimitSwitchSource_FeedbackConnector, type, 0  );
-	m_talon.get()->OverrideLimitSwitchesEnable(true);
+	if ( m_settings.ConfigChanged(m_config.forwardLimitSwitchSource != LimitSwitchSource::LimitSwitchSource_FeedbackConnector ||
+								  m_config.forwardLimitSwitchNormal != type) )
+	{
+		m_config.forwardLimitSwitchSource = LimitSwitchSource::LimitSwitchSource_FeedbackConnector;
+		m_config.forwardLimitSwitchNormal = type;
+		if ( SendSetting() )
+		{
+			m_talon.get()->ConfigForwardLimitSwitchSource( LimitSwitchSource::LimitSwitchSource_FeedbackConnector, type, 0  );
+		}
+	}
+	EnableDisableLimitSwitches(true);
 }
 
 void DragonTalonSRX::SetReverseLimitSwitch
@@ -786,8 +840,17 @@ void DragonTalonSRX::SetReverseLimitSwitch
 )
 {
 	LimitSwitchNormal type = normallyOpen ? LimitSwitchNormal::LimitSwitchNormal_NormallyOpen : LimitSwitchNormal::LimitSwitchNormal_NormallyClosed;
-	m_talon.get()->ConfigReverseLimitSwitchSource( LimitSwitchSource::LimitSwitchSource_FeedbackConnector, type, 0  );
-	m_talon.get()->OverrideLimitSwitchesEnable(true);
+	if ( m_settings.ConfigChanged(m_config.reverseLimitSwitchSource != LimitSwitchSource::LimitSwitchSource_FeedbackConnector ||
+								  m_config.reverseLimitSwitchNormal != type) )
+	{
+		m_config.reverseLimitSwitchSource = LimitSwitchSource::LimitSwitchSource_FeedbackConnector;
+		m_config.reverseLimitSwitchNormal = type;
+		if ( SendSetting() )
+		{
+			m_talon.get()->ConfigReverseLimitSwitchSource( LimitSwitchSource::LimitSwitchSource_FeedbackConnector, type, 0  );
+		}
+	}
+	EnableDisableLimitSwitches(true);
 }
 
 
@@ -797,8 +860,20 @@ void DragonTalonSRX::SetRemoteSensor
     ctre::phoenix::motorcontrol::RemoteSensorSource deviceType
 )
 {
-	m_talon.get()->ConfigRemoteFeedbackFilter( canID, deviceType, 0, 0.0 );
-	m_talon.get()->ConfigSelectedFeedbackSensor( RemoteFeedbackDevice::RemoteFeedbackDevice_RemoteSensor0, 0, 0 );
+	if ( !m_settings.ConfigChanged(m_config.remoteFilter0.remoteSensorDeviceID != canID ||
+								   m_config.remoteFilter0.remoteSensorSource != deviceType ||
+								   m_config.primaryPID.selectedFeedbackSensor != FeedbackDevice::RemoteSensor0) )
+	{
+		return;
+	}
+	m_config.remoteFilter0.remoteSensorDeviceID = canID;
+	m_config.remoteFilter0.remoteSensorSource = deviceType;
+	m_config.primaryPID.selectedFeedbackSensor = FeedbackDevice::RemoteSensor0;
+	if ( SendSetting() )
+	{
+		m_talon.get()->ConfigRemoteFeedbackFilter( canID, deviceType, 0, 0.0 );
+		m_talon.get()->ConfigSelectedFeedbackSensor( RemoteFeedbackDevice::RemoteFeedbackDevice_RemoteSensor0, 0, 0 );
+	}
 }
 
 void DragonTalonSRX::SetDiameter
@@ -807,6 +882,7 @@ void DragonTalonSRX::SetDiameter
 )
 {
 	m_diameter = diameter;
+	UpdateCommandConversions();
 }
 
 void DragonTalonSRX::SetVoltage
@@ -815,6 +891,13 @@ void DragonTalonSRX::SetVoltage
 )
 {
 	m_talon.get()->SetVoltage(output);
+	MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
+}
+
+void DragonTalonSRX::StopMotor()
+{
+	m_talon.get()->StopMotor();
+	MotorOutputCache::GetInstance()->Invalidate(m_outputCache);
 }
 
 
@@ -834,8 +917,18 @@ bool DragonTalonSRX::IsReverseLimitSwitchClosed() const
 
 void DragonTalonSRX::EnableVoltageCompensation( double fullvoltage) 
 {
-	m_talon.get()->ConfigVoltageCompSaturation(fullvoltage);
-	m_talon.get()->EnableVoltageCompensation(true);
+	if ( m_settings.ConfigChanged(m_config.voltageCompSaturation != fullvoltage) )
+	{
+		m_config.voltageCompSaturation = fullvoltage;
+		if ( SendSetting() )
+		{
+			m_talon.get()->ConfigVoltageCompSaturation(fullvoltage);
+		}
+	}
+	if ( m_settings.ShouldWrite(SettingCache::SETTING::VOLTAGE_COMPENSATION, true) )
+	{
+		m_talon.get()->EnableVoltageCompensation(true);
+	}
 }
 
 void DragonTalonSRX::SetSelectedSensorPosition
@@ -875,5 +968,8 @@ void DragonTalonSRX::EnableDisableLimitSwitches
 	bool enable
 )
 {
-	m_talon.get()->OverrideLimitSwitchesEnable(enable);
-}
\ No newline at end of file
+	if ( m_settings.ShouldWrite(SettingCache::SETTING::LIMIT_SWITCH_OVERRIDE, enable) )
+	{
+		m_talon.get()->OverrideLimitSwitchesEnable(enable);
+	}
+}
@@ -17,6 +17,7 @@
 
 #pragma once
 
+#include <array>
 #include <memory>
 #include <vector>
 #include <string>
@@ -25,6 +26,9 @@
 
 #include <mechanisms/controllers/ControlModes.h>
 #include <hw/interfaces/IDragonMotorController.h>
+#include <hw/ControlSlots.h>
+#include <hw/CurrentGovernor.h>
+#include <hw/SettingCache.h>
 #include <hw/usages/MotorControllerUsage.h>
 
 // Third Party Includes
@@ -66,7 +70,7 @@ class DragonTalonSRX : public IDragonMotorController
         // Setters (override)
         void SetControlMode(ControlModes::CONTROL_TYPE mode) override; //:D
         void Set(double value) override;
-        void Set(std::string nt, double value) override;
+        void Set(const MotorCommand& command) override;
         void SetRotationOffset(double rotations) override;
         void SetVoltageRamping(double ramping, double rampingClosedLoop = -1) override; // seconds 0 to full, set to 0 to disable
         void EnableCurrentLimiting(bool enabled) override; 
@@ -74,8 +78,13 @@ class DragonTalonSRX : public IDragonMotorController
         void Invert(bool inverted) override; 
         void SetSensorInverted(bool inverted) override;
 
-        /// @brief  Set the control constants (e.g. PIDF values).
-        /// @param [in] int             slot - hardware slot to use
+        /// @brief  Load a set of control constants into a free slot without selecting it
+        /// @param [in] ControlData*    controlInfo - the control constants
+        /// @return int slot the constants are in (-1 - open loop or all of the slots are in use)
+        int PreloadControlConstants(ControlData* controlInfo) override;
+
+        /// @brief  Set the control constants (e.g. PIDF values).  Constants that are already in a slot are only selected.
+        /// @param [in] int             slot - hardware slot to use when all of the slots are in use
         /// @param [in] ControlData*    pid - the control constants
         /// @return void
         void SetControlConstants(int slot, ControlData* controlInfo) override;
@@ -136,6 +145,7 @@ class DragonTalonSRX : public IDragonMotorController
         (
             units::volt_t output
         ) override;
+        void StopMotor() override;
 
         double GetGearRatio() const override { return m_gearRatio;}
         bool IsForwardLimitSwitchClosed() const override;
@@ -154,9 +164,22 @@ class DragonTalonSRX : public IDragonMotorController
         (
             bool enable
         ) override;
+        uint32_t GetSuppressedSettings() const override { return m_settings.GetSuppressed(); }
 
+        /// @brief  Send the settings collected so far to the motor controller (one ConfigAllSettings call).
+        ///         DragonMotorControllerFactory::ApplyConfigurations calls this for every controller.
+        ///         Nothing is sent when the controller's fingerprint shows it already has the settings.
+        /// @return bool true - the settings were sent, false - the controller already had them
+        bool ApplyConfiguration();
 
     private:
+        void UpdateCommandConversions();
+        void WriteGains(int slot, ControlData* controlInfo);
+        bool SendSetting();
+        void SetPeakScale(double scale);
+
+        static constexpr int CONFIG_TIMEOUT = 50;   // milliseconds
+
         std::shared_ptr<ctre::phoenix::motorcontrol::can::WPI_TalonSRX>  m_talon;
         ControlModes::CONTROL_TYPE m_controlMode;
         MotorControllerUsage::MOTOR_CONTROLLER_USAGE m_type;
@@ -170,6 +193,28 @@ class DragonTalonSRX : public IDragonMotorController
         double m_countsPerInch;
         double m_countsPerDegree;
         IDragonMotorController::MOTOR_TYPE m_motorType;
+        int m_rpsAggregate;         // Logger aggregate handle
+        int m_outputCache;          // MotorOutputCache handle
+        int m_framePlan;            // CanFramePlanner handle
+        CurrentGovernor::PRIORITY m_governorPriority;   // scales the open loop outputs and the velocity peak output
+
+        /// @struct CommandConversion
+        /// @brief  CTRE control mode and factor from the command units to native units for a control mode
+        ///         (governed - the CurrentGovernor's scale is applied to the output, governedPeak - closed loop,
+        ///         so the scale is applied to the peak output instead)
+        struct CommandConversion
+        {
+            ctre::phoenix::motorcontrol::ControlMode  ctreMode;
+            double                                    scale;
+            bool                                      governed;
+            bool                                      governedPeak;
+        };
+        std::array<CommandConversion, ControlModes::CONTROL_TYPE::MAX_CONTROL_TYPES> m_commands;   // indexed by control mode
+        ctre::phoenix::motorcontrol::can::TalonSRXConfiguration m_config;    // every setting sent to the controller
+        ControlSlots m_slots;       // gains in each of the hardware slots
+        SettingCache m_settings;    // last value written for the runtime settings
+        bool m_configApplied;       // false - the Config methods only update m_config
+        bool m_fingerprintStored;   // the controller's custom parameters hold the fingerprint of m_config
 };
 
-typedef std::vector<DragonTalonSRX*> DragonTalonSRXVector;
\ No newline at end of file
+typedef std::vector<DragonTalonSRX*> DragonTalonSRXVector;
@@ -0,0 +1,125 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// MotorCommand.h
+//========================================================================================================
+///
+/// File Description:
+///     Targets for IDragonMotorController::Set.  Each typed command carries its unit, so a caller can't
+///     send degrees to a motor that is in a velocity mode.  The motor controller turns the value into
+///     native units with a factor it works out when it is configured, so Set is a lookup, a multiply
+///     and the driver call.
+///
+///         m_driveMotor.get()->Set(VelocityRps(target));
+///
+///     Mechanisms whose control mode comes from the xml use MotorCommand directly.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+
+// FRC includes
+
+// Team 302 includes
+#include <mechanisms/controllers/ControlModes.h>
+
+// Third Party Includes
+
+
+/// @class MotorCommand
+/// @brief control mode and target value
+class MotorCommand
+{
+    public:
+        constexpr MotorCommand
+        (
+            ControlModes::CONTROL_TYPE  mode,
+            double                      value
+        ) : m_mode(mode), m_value(value)
+        {
+        }
+
+        constexpr ControlModes::CONTROL_TYPE GetMode() const { return m_mode; }
+        constexpr double GetValue() const { return m_value; }
+
+    private:
+        ControlModes::CONTROL_TYPE  m_mode;
+        double                      m_value;
+};
+
+/// @brief open loop output between -1.0 and 1.0
+struct PercentOut : public MotorCommand
+{
+    constexpr explicit PercentOut( double percent ) : MotorCommand(ControlModes::CONTROL_TYPE::PERCENT_OUTPUT, percent) {}
+};
+
+/// @brief closed loop position in sensor counts
+struct PositionTicks : public MotorCommand
+{
+    constexpr explicit PositionTicks( double ticks ) : MotorCommand(ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE, ticks) {}
+};
+
+/// @brief closed loop position in degrees
+struct PositionDegrees : public MotorCommand
+{
+    constexpr explicit PositionDegrees( double degrees ) : MotorCommand(ControlModes::CONTROL_TYPE::POSITION_DEGREES, degrees) {}
+};
+
+/// @brief closed loop position in inches
+struct PositionInches : public MotorCommand
+{
+    constexpr explicit PositionInches( double inches ) : MotorCommand(ControlModes::CONTROL_TYPE::POSITION_INCH, inches) {}
+};
+
+/// @brief closed loop velocity in degrees per second
+struct VelocityDegrees : public MotorCommand
+{
+    constexpr explicit VelocityDegrees( double degreesPerSecond ) : MotorCommand(ControlModes::CONTROL_TYPE::VELOCITY_DEGREES, degreesPerSecond) {}
+};
+
+/// @brief closed loop velocity in inches per second
+struct VelocityInches : public MotorCommand
+{
+    constexpr explicit VelocityInches( double inchesPerSecond ) : MotorCommand(ControlModes::CONTROL_TYPE::VELOCITY_INCH, inchesPerSecond) {}
+};
+
+/// @brief closed loop velocity in revolutions per second
+struct VelocityRps : public MotorCommand
+{
+    constexpr explicit VelocityRps( double rps ) : MotorCommand(ControlModes::CONTROL_TYPE::VELOCITY_RPS, rps) {}
+};
+
+/// @brief output voltage
+struct VoltageOut : public MotorCommand
+{
+    constexpr explicit VoltageOut( double volts ) : MotorCommand(ControlModes::CONTROL_TYPE::VOLTAGE, volts) {}
+};
+
+/// @brief closed loop current in amps
+struct CurrentAmps : public MotorCommand
+{
+    constexpr explicit CurrentAmps( double amps ) : MotorCommand(ControlModes::CONTROL_TYPE::CURRENT, amps) {}
+};
+
+/// @brief trapezoid profile (e.g. Motion Magic) to a position in inches
+struct TrapezoidInches : public MotorCommand
+{
+    constexpr explicit TrapezoidInches( double inches ) : MotorCommand(ControlModes::CONTROL_TYPE::TRAPEZOID, inches) {}
+};
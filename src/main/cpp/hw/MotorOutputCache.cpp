@@ -0,0 +1,205 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// MotorOutputCache.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Skips motor controller Set calls that wouldn't change the controller's output
+///
+//========================================================================================================
+
+// C++ Includes
+#include <cmath>
+#include <string>
+
+// FRC includes
+#include <frc/RobotController.h>
+#include <networktables/NetworkTable.h>
+#include <networktables/NetworkTableEntry.h>
+#include <networktables/NetworkTableInstance.h>
+
+// Team 302 includes
+#include <hw/MotorOutputCache.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    constexpr const char* TABLE_NAME = "Motor Output Cache";
+}
+
+/// @brief Find or create the motor output cache
+/// @returns MotorOutputCache* pointer to the cache
+MotorOutputCache* MotorOutputCache::m_instance = nullptr;
+MotorOutputCache* MotorOutputCache::GetInstance()
+{
+    if ( MotorOutputCache::m_instance == nullptr )
+    {
+        MotorOutputCache::m_instance = new MotorOutputCache();
+    }
+    return MotorOutputCache::m_instance;
+}
+
+MotorOutputCache::MotorOutputCache() : m_entries(),
+                                       m_enabled(true),
+                                       m_enabledEntry(),
+                                       m_sentEntry(),
+                                       m_suppressedEntry(),
+                                       m_lastPublish(0)
+{
+    auto table = nt::NetworkTableInstance::GetDefault().GetTable(TABLE_NAME);
+    m_enabledEntry = table->GetEntry("enabled");
+    m_enabledEntry.SetDefaultBoolean(true);
+    m_sentEntry = table->GetEntry("sent");
+    m_suppressedEntry = table->GetEntry("suppressed");
+    m_entries.reserve(32);
+}
+
+/// @brief Add a motor controller
+/// @param [in] const std::string&: controller type (e.g. "DragonFalcon")
+/// @param [in] int: CAN ID
+/// @returns int: handle to pass to ShouldSend / Invalidate
+int MotorOutputCache::Register
+(
+    const string&       type,
+    int                 canID
+)
+{
+    auto entry = make_unique<Entry>();
+    entry->ctreMode = -1;
+    entry->output = 0.0;
+    entry->lastSend = 0;
+    entry->sent = 0;
+    entry->suppressed = 0;
+
+    auto table = nt::NetworkTableInstance::GetDefault().GetTable(TABLE_NAME)->GetSubTable(type + " " + to_string(canID));
+    entry->sentEntry = table->GetEntry("sent");
+    entry->suppressedEntry = table->GetEntry("suppressed");
+
+    m_entries.emplace_back(std::move(entry));
+    return static_cast<int>(m_entries.size()) - 1;
+}
+
+/// @brief Decide whether an output needs to be sent; when it does, it becomes the cached output
+/// @param [in] int: handle from Register
+/// @param [in] ControlModes::CONTROL_TYPE: control type (selects the epsilon)
+/// @param [in] int: CTRE control mode the output is sent with
+/// @param [in] double: output in the controller's units (counts, counts per 100 ms, percent, amps)
+/// @returns bool: true - call Set, false - the controller already has this output
+bool MotorOutputCache::ShouldSend
+(
+    int                             handle,
+    ControlModes::CONTROL_TYPE      type,
+    int                             ctreMode,
+    double                          output
+)
+{
+    if (handle < 0 || handle >= static_cast<int>(m_entries.size()))
+    {
+        return true;
+    }
+
+    auto& entry = *m_entries[handle];
+    auto now = frc::RobotController::GetFPGATime();
+    if (m_enabled.load(memory_order_relaxed) &&
+        ctreMode == entry.ctreMode &&
+        abs(output - entry.output) <= GetEpsilon(type) &&
+        now - entry.lastSend < REFRESH_PERIOD)
+    {
+        entry.suppressed.fetch_add(1, memory_order_relaxed);
+        return false;
+    }
+
+    entry.ctreMode = ctreMode;
+    entry.output = output;
+    entry.lastSend = now;
+    entry.sent.fetch_add(1, memory_order_relaxed);
+    return true;
+}
+
+/// @brief Send the next output even if it is the same as the cached one
+/// @param [in] int: handle from Register
+void MotorOutputCache::Invalidate
+(
+    int                             handle
+)
+{
+    if (handle >= 0 && handle < static_cast<int>(m_entries.size()))
+    {
+        m_entries[handle]->ctreMode = -1;
+    }
+}
+
+/// @param [in] ControlModes::CONTROL_TYPE: control type
+/// @returns double: outputs closer together than this are the same
+double MotorOutputCache::GetEpsilon
+(
+    ControlModes::CONTROL_TYPE      type
+)
+{
+    switch (type)
+    {
+        case ControlModes::CONTROL_TYPE::PERCENT_OUTPUT:
+            return 0.0005;          // the controller gets percent output in 1/1023 steps
+
+        case ControlModes::CONTROL_TYPE::POSITION_ABSOLUTE:
+        case ControlModes::CONTROL_TYPE::POSITION_DEGREES:
+        case ControlModes::CONTROL_TYPE::POSITION_INCH:
+        case ControlModes::CONTROL_TYPE::POSITION_DEGREES_ABSOLUTE:
+        case ControlModes::CONTROL_TYPE::TRAPEZOID:
+        case ControlModes::CONTROL_TYPE::VELOCITY_DEGREES:
+        case ControlModes::CONTROL_TYPE::VELOCITY_INCH:
+        case ControlModes::CONTROL_TYPE::VELOCITY_RPS:
+            return 0.5;             // positions are whole counts and velocities whole counts per 100 ms
+
+        case ControlModes::CONTROL_TYPE::CURRENT:
+            return 0.0005;          // amps; the controller gets the current setpoint in whole milliamps
+
+        default:
+            return 0.0;             // motion profile outputs are SetValueMotionProfile values
+    }
+}
+
+/// @brief Publish the counts every PUBLISH_PERIOD and check whether the cache is enabled (call once per loop)
+void MotorOutputCache::PeriodicPublish()
+{
+    auto now = frc::RobotController::GetFPGATime();
+    if (now - m_lastPublish < PUBLISH_PERIOD)
+    {
+        return;
+    }
+    m_lastPublish = now;
+
+    uint32_t totalSent = 0;
+    uint32_t totalSuppressed = 0;
+    for (auto& entry : m_entries)
+    {
+        auto sent = entry->sent.exchange(0, memory_order_relaxed);
+        auto suppressed = entry->suppressed.exchange(0, memory_order_relaxed);
+        entry->sentEntry.SetDouble(static_cast<double>(sent));
+        entry->suppressedEntry.SetDouble(static_cast<double>(suppressed));
+        totalSent += sent;
+        totalSuppressed += suppressed;
+    }
+    m_sentEntry.SetDouble(static_cast<double>(totalSent));
+    m_suppressedEntry.SetDouble(static_cast<double>(totalSuppressed));
+    m_enabled.store(m_enabledEntry.GetBoolean(true), memory_order_relaxed);
+}
@@ -0,0 +1,147 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// MotorOutputCache.h
+//========================================================================================================
+///
+/// File Description:
+///     Remembers the last control mode and output sent to each CTRE motor controller so that
+///     DragonFalcon / DragonTalonSRX only call Set when the output changes.  Phoenix keeps sending
+///     the last control frame on its own, so an identical Set only costs the call into the CTRE
+///     library (and the lock / frame update inside it) every loop for every motor.
+///
+///         // constructor
+///         m_outputCache = MotorOutputCache::GetInstance()->Register("DragonFalcon", deviceID);
+///
+///         // Set
+///         if (MotorOutputCache::GetInstance()->ShouldSend(m_outputCache, m_controlMode, ctreMode, output))
+///         {
+///             m_talon.get()->Set(ctreMode, output);
+///         }
+///
+///     An output is the same when the CTRE control mode matches and it is within the control type's
+///     epsilon (GetEpsilon - about half of the resolution the controller receives it in).  The output
+///     is re-sent every REFRESH_PERIOD even when it hasn't changed, and Invalidate forces the next
+///     one to be sent (after anything else changes the controller's output, e.g. SetVoltage, follower
+///     mode, closed loop slot changes).
+///
+///     Once a second the number of outputs sent and suppressed during that second, for each controller
+///     and in total, are published to the "Motor Output Cache" network table.  Setting "Motor Output Cache/enabled" to false sends
+///     every output.
+///
+///     Register is only called while the robot is being built (RobotInit); each controller's
+///     ShouldSend / Invalidate is only called by the thread that commands it.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <networktables/NetworkTableEntry.h>
+
+// Team 302 includes
+#include <mechanisms/controllers/ControlModes.h>
+
+// Third Party Includes
+
+
+class MotorOutputCache
+{
+    public:
+
+        /// @brief Find or create the motor output cache
+        /// @returns MotorOutputCache* pointer to the cache
+        static MotorOutputCache* GetInstance();
+
+        /// @brief Add a motor controller
+        /// @param [in] const std::string&: controller type (e.g. "DragonFalcon")
+        /// @param [in] int: CAN ID
+        /// @returns int: handle to pass to ShouldSend / Invalidate
+        int Register
+        (
+            const std::string&              type,
+            int                             canID
+        );
+
+        /// @brief Decide whether an output needs to be sent; when it does, it becomes the cached output
+        /// @param [in] int: handle from Register
+        /// @param [in] ControlModes::CONTROL_TYPE: control type (selects the epsilon)
+        /// @param [in] int: CTRE control mode the output is sent with
+        /// @param [in] double: output in the controller's units (counts, counts per 100 ms, percent, amps)
+        /// @returns bool: true - call Set, false - the controller already has this output
+        bool ShouldSend
+        (
+            int                             handle,
+            ControlModes::CONTROL_TYPE      type,
+            int                             ctreMode,
+            double                          output
+        );
+
+        /// @brief Send the next output even if it is the same as the cached one
+        /// @param [in] int: handle from Register
+        void Invalidate
+        (
+            int                             handle
+        );
+
+        /// @param [in] ControlModes::CONTROL_TYPE: control type
+        /// @returns double: outputs closer together than this are the same
+        static double GetEpsilon
+        (
+            ControlModes::CONTROL_TYPE      type
+        );
+
+        /// @brief Publish the counts every PUBLISH_PERIOD and check whether the cache is enabled (call once per loop)
+        void PeriodicPublish();
+
+    private:
+        MotorOutputCache();
+        ~MotorOutputCache() = default;
+
+        static constexpr uint64_t REFRESH_PERIOD = 100000;     // microseconds
+        static constexpr uint64_t PUBLISH_PERIOD = 1000000;    // microseconds
+
+        /// @struct Entry
+        /// @brief  last output sent to one controller and the network table entries its counts are published to
+        struct Entry
+        {
+            int                     ctreMode;           // -1 - nothing cached
+            double                  output;
+            uint64_t                lastSend;           // FPGA time (microseconds)
+            std::atomic<uint32_t>   sent;
+            std::atomic<uint32_t>   suppressed;
+            nt::NetworkTableEntry   sentEntry;
+            nt::NetworkTableEntry   suppressedEntry;
+        };
+
+        static MotorOutputCache*                m_instance;
+
+        std::vector<std::unique_ptr<Entry>>     m_entries;
+        std::atomic<bool>                       m_enabled;
+        nt::NetworkTableEntry                   m_enabledEntry;
+        nt::NetworkTableEntry                   m_sentEntry;
+        nt::NetworkTableEntry                   m_suppressedEntry;
+        uint64_t                                m_lastPublish;  // FPGA time (microseconds)
+};
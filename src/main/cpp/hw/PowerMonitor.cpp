@@ -0,0 +1,132 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// PowerMonitor.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Reads the power distribution panel once per loop into a PowerSnapshot
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+
+// FRC includes
+#include <frc/PowerDistribution.h>
+#include <frc/RobotController.h>
+
+// Team 302 includes
+#include <hw/factories/PDPFactory.h>
+#include <hw/PowerMonitor.h>
+
+// Third Party Includes
+
+using namespace std;
+
+/// @brief Find or create the power monitor
+/// @returns PowerMonitor* pointer to the monitor
+PowerMonitor* PowerMonitor::m_instance = nullptr;
+PowerMonitor* PowerMonitor::GetInstance()
+{
+    if ( PowerMonitor::m_instance == nullptr )
+    {
+        PowerMonitor::m_instance = new PowerMonitor();
+    }
+    return PowerMonitor::m_instance;
+}
+
+/// @brief Read a channel's current every loop
+/// @param [in] int: PDP channel
+void PowerMonitor::RegisterChannel
+(
+    int                 channel
+)
+{
+    if ( channel >= 0 && channel < PowerSnapshot::MAX_CHANNELS &&
+         find( m_channels.begin(), m_channels.end(), channel ) == m_channels.end() )
+    {
+        m_channels.push_back( channel );
+    }
+}
+
+/// @brief Read the power distribution panel into a new snapshot (call once per loop)
+void PowerMonitor::Update()
+{
+    auto pdp = PDPFactory::GetFactory()->GetPDP();
+    if ( pdp == nullptr )
+    {
+        return;
+    }
+
+    // each reading is its own HAL call (answered from the PDP's latest status frames), so only
+    // the channels somebody uses are read
+    PowerSnapshot snapshot {};
+    snapshot.timestamp = frc::RobotController::GetFPGATime();
+    snapshot.channels = min( pdp->GetNumChannels(), PowerSnapshot::MAX_CHANNELS );
+    for ( auto channel : m_channels )
+    {
+        if ( channel < snapshot.channels )
+        {
+            snapshot.currents[channel] = pdp->GetCurrent( channel );
+        }
+    }
+    snapshot.totalCurrent = pdp->GetTotalCurrent();
+    snapshot.voltage = pdp->GetVoltage();
+    m_snapshot.Write( snapshot );
+}
+
+/// @brief Copy the latest snapshot
+/// @param [out] PowerSnapshot& snapshot: latest snapshot
+/// @returns bool true - snapshot was copied, false - there isn't a PDP or it hasn't been read yet
+bool PowerMonitor::GetSnapshot
+(
+    PowerSnapshot&      snapshot
+) const
+{
+    return m_snapshot.Read( snapshot );
+}
+
+/// @param [in] int: PDP channel
+/// @returns double: channel's current (amps) from the latest snapshot (0.0 if it isn't available)
+double PowerMonitor::GetCurrent
+(
+    int                 channel
+) const
+{
+    PowerSnapshot snapshot;
+    if ( !m_snapshot.Read( snapshot ) || channel < 0 || channel >= snapshot.channels )
+    {
+        return 0.0;
+    }
+    return snapshot.currents[channel];
+}
+
+/// @returns double: total current (amps) from the latest snapshot
+double PowerMonitor::GetTotalCurrent() const
+{
+    PowerSnapshot snapshot;
+    return m_snapshot.Read( snapshot ) ? snapshot.totalCurrent : 0.0;
+}
+
+/// @returns double: battery voltage from the latest snapshot
+double PowerMonitor::GetVoltage() const
+{
+    PowerSnapshot snapshot;
+    return m_snapshot.Read( snapshot ) ? snapshot.voltage : 0.0;
+}
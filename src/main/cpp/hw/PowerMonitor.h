@@ -0,0 +1,119 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// PowerMonitor.h
+//========================================================================================================
+///
+/// File Description:
+///     Reads the power distribution panel once per loop into a PowerSnapshot:  the current of each
+///     registered channel, the total current and the battery voltage.  Channels nobody registered
+///     aren't read (each one is a separate HAL call) and stay 0.  The motor controllers' GetCurrent
+///     and anything else that needs currents (e.g. stall detection, CurrentGovernor) read the snapshot
+///     instead of the PDP, so a channel is read once a loop however many times it is checked.
+///
+///         // constructor (RobotInit)
+///         PowerMonitor::GetInstance()->RegisterChannel(pdpChannel);
+///
+///         // RobotPeriodic
+///         PowerMonitor::GetInstance()->Update();
+///
+///         // any thread
+///         auto amps = PowerMonitor::GetInstance()->GetCurrent(pdpChannel);
+///
+///     RegisterChannel and Update are only called by the robot loop; the snapshot is handed to the other threads
+///     (e.g. the state manager workers) through a DoubleBuffer.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <cstdint>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/DoubleBuffer.h>
+
+// Third Party Includes
+
+
+/// @struct PowerSnapshot
+/// @brief  power distribution readings from one loop
+struct PowerSnapshot
+{
+    static constexpr int MAX_CHANNELS = 24;     // REV power distribution hub (the CTRE PDP has 16)
+
+    uint64_t                            timestamp;      // FPGA time (microseconds)
+    int                                 channels;       // number of channels the power distribution has
+    std::array<double, MAX_CHANNELS>    currents;       // amps (0 for the channels that aren't registered)
+    double                              totalCurrent;   // amps
+    double                              voltage;        // volts
+};
+
+
+class PowerMonitor
+{
+    public:
+        /// @brief Find or create the power monitor
+        /// @returns PowerMonitor* pointer to the monitor
+        static PowerMonitor* GetInstance();
+
+        /// @brief Read a channel's current every loop
+        /// @param [in] int: PDP channel
+        void RegisterChannel
+        (
+            int                 channel
+        );
+
+        /// @brief Read the power distribution panel into a new snapshot (call once per loop)
+        void Update();
+
+        /// @brief Copy the latest snapshot
+        /// @param [out] PowerSnapshot& snapshot: latest snapshot
+        /// @returns bool true - snapshot was copied, false - there isn't a PDP or it hasn't been read yet
+        bool GetSnapshot
+        (
+            PowerSnapshot&      snapshot
+        ) const;
+
+        /// @param [in] int: PDP channel
+        /// @returns double: channel's current (amps) from the latest snapshot (0.0 if it isn't available)
+        double GetCurrent
+        (
+            int                 channel
+        ) const;
+
+        /// @returns double: total current (amps) from the latest snapshot
+        double GetTotalCurrent() const;
+
+        /// @returns double: battery voltage from the latest snapshot
+        double GetVoltage() const;
+
+    private:
+        PowerMonitor() = default;
+        ~PowerMonitor() = default;
+
+        static PowerMonitor*            m_instance;
+
+        std::vector<int>                m_channels;     // registered channels
+
+        DoubleBuffer<PowerSnapshot>     m_snapshot;
+};
@@ -0,0 +1,133 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// SettingCache.h
+//========================================================================================================
+///
+/// File Description:
+///     Remembers the last value written for each of a Talon's runtime settings so that DragonFalcon /
+///     DragonTalonSRX drop writes that wouldn't change anything (e.g. the intake state manager
+///     overrides the limit switches every loop).  The settings that are part of the controller's
+///     configuration are compared against it with ConfigChanged; the others (neutral mode, inversion,
+///     limit switch override, the CurrentGovernor's peak output scale, ...) are remembered here.  Nothing
+///     is remembered at start up, so the first write of each setting is always sent; the controller
+///     keeps its settings across a code restart and may not have the default.  The number of dropped writes is kept for
+///     GetSuppressedSettings.
+///
+///         if ( m_settings.ShouldWrite(SettingCache::SETTING::INVERTED, inverted) )
+///         {
+///             m_talon.get()->SetInverted(inverted);
+///         }
+///
+///         if ( m_settings.ConfigChanged(m_config.openloopRamp != ramping) )
+///         {
+///             m_config.openloopRamp = ramping;
+///             ...
+///         }
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <cstdint>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+class SettingCache
+{
+    public:
+        enum SETTING
+        {
+            NEUTRAL_MODE,
+            INVERTED,
+            SENSOR_PHASE,
+            LIMIT_SWITCH_OVERRIDE,
+            CURRENT_LIMIT,
+            VOLTAGE_COMPENSATION,
+            PEAK_SCALE,
+            MAX_SETTINGS
+        };
+
+        SettingCache() : m_values(), m_written(), m_suppressed(0)
+        {
+        }
+
+        /// @brief  Decide whether a setting that isn't in the configuration needs to be written; when
+        ///         it does, the value is remembered
+        /// @param [in] SETTING setting:    setting
+        /// @param [in] double  value:      value to write
+        /// @return bool true - write it, false - the controller already has it
+        bool ShouldWrite
+        (
+            SETTING     setting,
+            double      value
+        )
+        {
+            if ( m_written[setting] && m_values[setting] == value )
+            {
+                ++m_suppressed;
+                return false;
+            }
+            m_written[setting] = true;
+            m_values[setting] = value;
+            return true;
+        }
+
+        /// @brief  Remember a value that was written some other way (e.g. as part of a configuration call)
+        /// @param [in] SETTING setting:    setting
+        /// @param [in] double  value:      value the controller has now
+        void Remember
+        (
+            SETTING     setting,
+            double      value
+        )
+        {
+            m_written[setting] = true;
+            m_values[setting] = value;
+        }
+
+        /// @brief  Count a configuration write that wouldn't change the configuration
+        /// @param [in] bool    changed:    the values to write differ from the ones in the configuration
+        /// @return bool true - update it, false - the configuration already has them
+        bool ConfigChanged
+        (
+            bool        changed
+        )
+        {
+            if ( !changed )
+            {
+                ++m_suppressed;
+            }
+            return changed;
+        }
+
+        /// @return uint32_t number of writes that were dropped
+        uint32_t GetSuppressed() const { return m_suppressed; }
+
+    private:
+        std::array<double, MAX_SETTINGS>    m_values;
+        std::array<bool, MAX_SETTINGS>      m_written;
+        uint32_t                            m_suppressed;
+};
@@ -1,12 +1,16 @@
 
+#include <atomic>
 #include <map>
 #include <string>
 
+#include <frc/RobotController.h>
+
 #include <hw/factories/DragonMotorControllerFactory.h>        
 #include <hw/usages/MotorControllerUsage.h>
 #include <hw/DragonTalonSRX.h>
 #include <hw/DragonFalcon.h>
 #include <utils/Logger.h>
+#include <utils/WorkerPool.h>
 
 #include <ctre/phoenix/motorcontrol/can/TalonSRX.h>
 #include <ctre/phoenix/motorcontrol/can/TalonFX.h>
@@ -27,7 +31,8 @@ DragonMotorControllerFactory* DragonMotorControllerFactory::GetInstance()
     return DragonMotorControllerFactory::m_instance;
 }
 
-DragonMotorControllerFactory::DragonMotorControllerFactory() 
+DragonMotorControllerFactory::DragonMotorControllerFactory() : m_pendingConfigurations(),
+                                                               m_configurationsApplied(false)
 {
 	for ( auto inx=0; inx<63; ++inx )
 	{
@@ -152,6 +157,13 @@ shared_ptr<IDragonMotorController> DragonMotorControllerFactory::CreateMotorCont
     if ( !hasError )
     {
         m_canmotorControllers[ canID ] = controller;
+
+        // the settings are sent by ApplyConfigurations, so the mechanisms can add theirs first
+        m_pendingConfigurations.emplace_back( controller );
+        if ( m_configurationsApplied )
+        {
+            ApplyConfigurations();
+        }
     }
 	return controller;
 }
@@ -183,6 +195,68 @@ shared_ptr<IDragonMotorController> DragonMotorControllerFactory::GetController
 	return controller;
 }
 
+//=======================================================================================
+// Method:          ApplyConfigurations
+// Description:     Send the settings for the motor controllers created since the last call
+//                  (one ConfigAllSettings per controller).  Most of the time is spent waiting
+//                  for the controllers to answer, so they are configured at the same time on
+//                  worker threads.
+// Returns:         void
+//=======================================================================================
+void DragonMotorControllerFactory::ApplyConfigurations()
+{
+    m_configurationsApplied = true;
+    if ( m_pendingConfigurations.empty() )
+    {
+        return;
+    }
+
+    auto start = frc::RobotController::GetFPGATime();
+    atomic<int> configured( 0 );
+    {
+        WorkerPool pool( CONFIG_THREADS, "MotorConfig" );
+        pool.ParallelFor( m_pendingConfigurations.size(), [this, &configured]( size_t inx )
+        {
+            if ( ApplyConfiguration( m_pendingConfigurations[inx].get() ) )
+            {
+                configured++;
+            }
+        } );
+    }
+    auto msg = to_string( m_pendingConfigurations.size() );
+    msg += " controllers (";
+    msg += to_string( configured.load() );
+    msg += " reconfigured, the rest matched their fingerprint) in ";
+    msg += to_string( ( frc::RobotController::GetFPGATime() - start ) / 1000 );
+    msg += " ms";
+    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, string("DragonMotorControllerFactory"), string("ApplyConfigurations"), msg );
+
+    m_pendingConfigurations.clear();
+}
+
+//=======================================================================================
+// Method:          ApplyConfiguration
+// Description:     Send the settings for one motor controller
+// Returns:         bool    true - the settings were sent, false - the controller already had them
+//=======================================================================================
+bool DragonMotorControllerFactory::ApplyConfiguration
+(
+    IDragonMotorController*     controller
+)
+{
+    auto falcon = dynamic_cast<DragonFalcon*>( controller );
+    if ( falcon != nullptr )
+    {
+        return falcon->ApplyConfiguration();
+    }
+    auto talon = dynamic_cast<DragonTalonSRX*>( controller );
+    if ( talon != nullptr )
+    {
+        return talon->ApplyConfiguration();
+    }
+    return false;
+}
+
 void DragonMotorControllerFactory::CreateTypeMap()
 {
     m_typeMap["TALONSRX"] = DragonMotorControllerFactory::MOTOR_TYPE::TALONSRX;
@@ -30,6 +30,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 // FRC includes
 
@@ -100,7 +101,25 @@ class DragonMotorControllerFactory
 			IDragonMotorController::MOTOR_TYPE                       				motorType
 		);
 
+		//=======================================================================================
+		/// Method:          ApplyConfigurations
+		/// Description:     Send the settings for the motor controllers created since the last
+		///                  call (one ConfigAllSettings per controller, on worker threads).  Until
+		///                  then the controllers' Config methods only collect the settings.  Call
+		///                  once the mechanisms are built (RobotInit); controllers created after
+		///                  the first call are configured right away.  Controllers whose stored
+		///                  fingerprint matches their settings are skipped (see ConfigFingerprint).
+		/// Returns:         void
+		//=======================================================================================
+		void ApplyConfigurations();
+
 	private:
+		static bool ApplyConfiguration
+		(
+			IDragonMotorController*								controller
+		);
+
+		static constexpr int CONFIG_THREADS = 3;		// plus the calling thread
 
 		//=======================================================================================
 		/// Method:          GetController
@@ -122,6 +141,8 @@ class DragonMotorControllerFactory
 
 		std::array<std::shared_ptr<IDragonMotorController>,63>				    m_canmotorControllers;
         std::map<std::string, DragonMotorControllerFactory::MOTOR_TYPE>         m_typeMap;
+        std::vector<std::shared_ptr<IDragonMotorController>>                   m_pendingConfigurations;
+        bool                                                                    m_configurationsApplied;
 
 
 };
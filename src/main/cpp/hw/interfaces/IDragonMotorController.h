@@ -17,6 +17,7 @@
 #pragma once
 
 // C++ Includes
+#include <cstdint>
 #include <map>
 #include <memory>
 #include <string>
@@ -25,6 +26,7 @@
 #include <frc/motorcontrol/MotorController.h>
 
 // Team 302 includes
+#include <hw/MotorCommand.h>
 #include <hw/usages/MotorControllerUsage.h>
 #include <mechanisms/controllers/ControlModes.h>
 #include <mechanisms/controllers/ControlData.h>
@@ -99,8 +101,15 @@ class IDragonMotorController
 
         // Setters
         virtual void SetControlMode(ControlModes::CONTROL_TYPE mode) = 0;
+
+        /// @brief  Set the target in the current control mode
+        /// @param [in] double  value - target in the units of the control mode
         virtual void Set(double value) = 0;
-        virtual void Set(std::string nt, double value) = 0;
+
+        /// @brief  Set the control mode and target (e.g. Set(VelocityRps(2.0)))
+        /// @param [in] const MotorCommand& command - control mode and target
+        virtual void Set(const MotorCommand& command) = 0;
+
         virtual void SetRotationOffset(double rotations) = 0;
         virtual void SetVoltageRamping(double ramping, double closedLoopRamping = -1) = 0;
         virtual void EnableCurrentLimiting(bool enabled) = 0;
@@ -109,12 +118,22 @@ class IDragonMotorController
         virtual void SetSensorInverted(bool inverted) = 0;
 		virtual void SetDiameter( double diameter ) = 0;
         virtual void SetVoltage(  units::volt_t output ) = 0;
+
+        /// @brief  Put the motor in neutral.  Use this instead of GetSpeedController()->StopMotor(), so the
+        ///         next Set isn't dropped as a duplicate of the output sent before the stop.
+        virtual void StopMotor() = 0;
         virtual ControlModes::CONTROL_TYPE GetControlMode() const = 0;
         virtual double GetCounts() const = 0;
 
 
-        /// @brief  Set the control constants (e.g. PIDF values).
-        /// @param [in] int             slot - hardware slot to use
+        /// @brief  Load a set of control constants into a free slot without selecting it, so
+        ///         SetControlConstants only selects the slot later.
+        /// @param [in] ControlData*    controlInfo - the control constants
+        /// @return int slot the constants are in (-1 - open loop or all of the slots are in use)
+        virtual int PreloadControlConstants(ControlData* controlInfo) = 0;
+
+        /// @brief  Set the control constants (e.g. PIDF values).  Constants that are already in a slot are only selected.
+        /// @param [in] int             slot - hardware slot to use when all of the slots are in use
         /// @param [in] ControlData*    pid - the control constants
         /// @return void
         virtual void SetControlConstants(int slot, ControlData* controlInfo) = 0;
@@ -157,6 +176,11 @@ class IDragonMotorController
             bool enable
         ) = 0;
 
+        /// @brief  Settings (brake mode, limit switch override, ramping, ...) that are written with the
+        ///         value the controller already has are dropped instead of being sent
+        /// @return uint32_t number of setting writes that were dropped
+        virtual uint32_t GetSuppressedSettings() const = 0;
+
     protected:
 
 };
@@ -21,6 +21,8 @@
 // wpilib includes
 
 // team 302 includes
+#include <hw/CanFramePlanner.h>
+#include <hw/ConfigFingerprint.h>
 #include <hw/xml/CancoderXmlParser.h>
 #include <utils/HardwareIDValidation.h>
 #include <utils/Logger.h>
@@ -35,6 +37,11 @@ using namespace pugi;
 using namespace ctre::phoenix;
 using namespace ctre::phoenix::sensors;
 
+namespace
+{
+    constexpr int CONFIG_TIMEOUT = 50;  // milliseconds
+}
+
 /// @brief parses the cancoder node in the robot.xml file and creates a cancoder
 /// @param [in] xml_node - the cancoder element in the xml file
 /// @return shared_ptr<CANCoder
@@ -81,42 +88,40 @@ shared_ptr<CANCoder> CancoderXmlParser::ParseXML
     if(!hasError)
     {
         cancoder = make_shared<CANCoder>(canID); //need to add usage also can't use new CANCoder... because it hasn't been wrapped
-        auto error = cancoder.get()->ConfigFactoryDefault(50);
-        if ( error != ErrorCode::OKAY )
-        {
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("CancoderXmlParser"), string("ConfigFactoryDefault"), string("error"));
-        }
-        
-        error = cancoder.get()->ConfigAbsoluteSensorRange(AbsoluteSensorRange::Signed_PlusMinus180, 0);
-        if ( error != ErrorCode::OKAY )
-        {
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("CancoderXmlParser"), string("ConfigAbsoluteSensorRange"), string("error"));
-        }
-        error = cancoder.get()->ConfigMagnetOffset(offset, 0);
-        if ( error != ErrorCode::OKAY )
-        {
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("CancoderXmlParser"), string("ConfigMagnetOffset"), string("error"));
-        }
-        error = cancoder.get()->ConfigSensorDirection(reverse, 0);
-        if ( error != ErrorCode::OKAY )
-        {
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("CancoderXmlParser"), string("ConfigSensorDirection"), string("error"));
-        }
-        error = cancoder.get()->ConfigSensorInitializationStrategy(SensorInitializationStrategy::BootToAbsolutePosition, 0);
-        if ( error != ErrorCode::OKAY )
-        {
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("CancoderXmlParser"), string("ConfigSensorInitializationStrategy"), string("error"));
-        }
-        error = cancoder.get()->ConfigVelocityMeasurementPeriod(SensorVelocityMeasPeriod::Period_1Ms, 0);
-        if ( error != ErrorCode::OKAY )
-        {
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("CancoderXmlParser"), string("ConfigVelocityMeasurementPeriod"), string("error"));
-        }
-        error = cancoder.get()->ConfigVelocityMeasurementWindow(64, 0);
-        if ( error != ErrorCode::OKAY )
+        CANCoderConfiguration config;
+        config.absoluteSensorRange = AbsoluteSensorRange::Signed_PlusMinus180;
+        config.magnetOffsetDegrees = offset;
+        config.sensorDirection = reverse;
+        config.initializationStrategy = SensorInitializationStrategy::BootToAbsolutePosition;
+        config.velocityMeasurementPeriod = SensorVelocityMeasPeriod::Period_1Ms;
+        config.velocityMeasurementWindow = 64;
+
+        // skip the configuration when the cancoder already has these settings from an earlier run
+        auto fingerprint = ConfigFingerprint::Compute(config.toString());
+        if ( !ConfigFingerprint::Matches(*cancoder.get(), fingerprint, CONFIG_TIMEOUT) )
         {
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("CancoderXmlParser"), string("ConfigVelocityMeasurementWindow"), string("error"));
+            auto error = cancoder.get()->ConfigFactoryDefault(CONFIG_TIMEOUT);
+            if ( error != ErrorCode::OKAY )
+            {
+                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("CancoderXmlParser"), string("ConfigFactoryDefault"), string("error"));
+            }
+            error = cancoder.get()->ConfigAllSettings(config, CONFIG_TIMEOUT);
+            if ( error != ErrorCode::OKAY )
+            {
+                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("CancoderXmlParser"), string("ConfigAllSettings"), string("error"));
+            }
+            else
+            {
+                ConfigFingerprint::Store(*cancoder.get(), fingerprint, CONFIG_TIMEOUT);
+            }
         }
+
+        // the swerve modules read the cancoders every loop
+        auto planner = CanFramePlanner::GetInstance();
+        auto framePlan = planner->Register(string("CANCoder ") + to_string(canID),
+                                           CanFramePlanner::DEVICE_TYPE::CANCODER,
+                                           [cancoder](int frame, int periodMs) { cancoder.get()->SetStatusFramePeriod(static_cast<CANCoderStatusFrame>(frame), periodMs, 0); });
+        planner->SetPriority(framePlan, CanFramePlanner::FRAME_PRIORITY::HIGH);
     }
     return cancoder;
 }
\ No newline at end of file
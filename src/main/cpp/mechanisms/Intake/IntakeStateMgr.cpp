@@ -61,6 +61,18 @@ void IntakeStateMgr::CheckForStateTransition()
         if (targetState != currentState)
         {
             SetCurrentState(targetState, true);
+
+            // the intake's status frames only need to be fast while it is running / moving
+            auto priority = targetState == INTAKE_STATE::OFF ? IDragonMotorController::MOTOR_PRIORITY::LOW : IDragonMotorController::MOTOR_PRIORITY::MEDIUM;
+            auto spinMotor = intake->GetPrimaryMotor();
+            if (spinMotor.get() != nullptr)
+            {
+                spinMotor.get()->SetFramePeriodPriority(priority);
+            }
+            if (extendMotor.get() != nullptr)
+            {
+                extendMotor.get()->SetFramePeriodPriority(priority);
+            }
         }
     } 
 }
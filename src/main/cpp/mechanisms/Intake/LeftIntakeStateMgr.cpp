@@ -22,6 +22,7 @@
 // Team 302 includes
 #include <TeleopControl.h>
 #include <mechanisms/intake/LeftIntakeStateMgr.h>
+#include <mechanisms/StateMgrScheduler.h>
 #include <mechanisms/StateStruc.h>
 #include <mechanisms/MechanismFactory.h>
 #include <mechanisms/MechanismTypes.h>
@@ -57,6 +58,7 @@ LeftIntakeStateMgr::LeftIntakeStateMgr() : IntakeStateMgr()
     stateMap[m_intakeRetractXmlString]  = m_retractState;
 
     Init(MechanismFactory::GetMechanismFactory()->GetLeftIntake(), stateMap);
+    StateMgrScheduler::GetInstance()->Register(this, StateMgrScheduler::RATE::RATE_25HZ, 0, INTAKE_STATE::OFF, {});
 }   
 
 Intake* LeftIntakeStateMgr::GetIntake() const 
@@ -22,6 +22,7 @@
 // Team 302 includes
 #include <TeleopControl.h>
 #include <mechanisms/intake/RightIntakeStateMgr.h>
+#include <mechanisms/StateMgrScheduler.h>
 #include <mechanisms/StateStruc.h>
 #include <mechanisms/MechanismFactory.h>
 #include <mechanisms/MechanismTypes.h>
@@ -58,6 +59,7 @@ RightIntakeStateMgr::RightIntakeStateMgr() : IntakeStateMgr()
     stateMap[m_intakeRetractXmlString]  = m_retractState;
 
     Init(MechanismFactory::GetMechanismFactory()->GetRightIntake(), stateMap);
+    StateMgrScheduler::GetInstance()->Register(this, StateMgrScheduler::RATE::RATE_25HZ, 1, INTAKE_STATE::OFF, {});
 }   
 
 
@@ -42,6 +42,9 @@
 #include <mechanisms/shooter/ShooterStateAutoHigh.h>
 #include <mechanisms/shooter/ShooterStateManual.h>
 #include <utils/Logger.h>
+#include <utils/LoopProfiler.h>
+#include <utils/LoopWatchdog.h>
+#include <utils/TelemetryRecorder.h>
 #include <mechanisms/controllers/StateDataXmlParser.h>
 
 // Third Party Includes
@@ -54,7 +57,9 @@ using namespace std;
 StateMgr::StateMgr() : m_mech(nullptr),
                        m_currentState(),
                        m_stateVector(),
-                       m_currentStateID(0)
+                       m_currentStateID(0),
+                       m_telemetrySignal(-1),
+                       m_profileZone(-1)
 {
 }
 void StateMgr::Init
@@ -68,6 +73,10 @@ void StateMgr::Init
 
     if (mech != nullptr)
     {
+        m_telemetrySignal = TelemetryRecorder::GetInstance()->RegisterSignal(mech->GetNetworkTableName() + "/state", TelemetryFormat::SIGNAL_TYPE::INT);
+        m_profileZone = LoopProfiler::GetInstance()->RegisterZone(mech->GetNetworkTableName() + "::RunCurrentState");
+        LoopWatchdog::GetInstance()->SetBudget(m_profileZone, LOOP_BUDGET_MS);
+
         // Parse the configuration file 
         auto stateXML = make_unique<StateDataXmlParser>();
         vector<MechanismTargetData*> targetData = stateXML.get()->ParseXML(mech->GetType());
@@ -221,6 +230,7 @@ void StateMgr::RunCurrentState()
 {
     if ( m_mech != nullptr )
     {
+        ProfileScope scope(m_profileZone);
         CheckForStateTransition();
 
         // run the current state
@@ -228,6 +238,7 @@ void StateMgr::RunCurrentState()
         {
             m_currentState->Run();
         }
+        TelemetryRecorder::GetInstance()->Record(m_telemetrySignal, m_currentStateID);
     }
 
 }
@@ -66,11 +66,14 @@ class StateMgr
         virtual void CheckForStateTransition();
 
     private:
+        static constexpr double LOOP_BUDGET_MS = 1.5;   // LoopWatchdog budget for RunCurrentState
 
         IMech*                  m_mech;
         IState*                 m_currentState;
         std::vector<IState*>    m_stateVector;
         int                     m_currentStateID;
+        int                     m_telemetrySignal;      // current state is recorded every time the state manager runs
+        int                     m_profileZone;          // LoopProfiler zone for RunCurrentState
 
 };
 
@@ -0,0 +1,210 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// StateMgrScheduler.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Runs the registered state managers at their rates, a dependency level at a time
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <networktables/NetworkTable.h>
+#include <networktables/NetworkTableEntry.h>
+#include <networktables/NetworkTableInstance.h>
+
+// Team 302 includes
+#include <mechanisms/StateMgr.h>
+#include <mechanisms/StateMgrScheduler.h>
+#include <utils/Logger.h>
+#include <utils/LoopProfiler.h>
+#include <utils/LoopWatchdog.h>
+#include <utils/WorkerPool.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    constexpr const char* TABLE_NAME = "State Manager Scheduler";
+}
+
+/// @brief Find or create the scheduler
+/// @returns StateMgrScheduler* pointer to the scheduler
+StateMgrScheduler* StateMgrScheduler::m_instance = nullptr;
+StateMgrScheduler* StateMgrScheduler::GetInstance()
+{
+    if ( StateMgrScheduler::m_instance == nullptr )
+    {
+        StateMgrScheduler::m_instance = new StateMgrScheduler();
+    }
+    return StateMgrScheduler::m_instance;
+}
+
+StateMgrScheduler::StateMgrScheduler() : m_entries(),
+                                         m_due(),
+                                         m_loopCount(0),
+                                         m_profileZone(LoopProfiler::GetInstance()->RegisterZone("StateMgrScheduler::Run")),
+                                         m_pool(),
+                                         m_parallel(false),
+                                         m_parallelEntry()
+{
+}
+
+/// @brief Add a state manager
+/// @param [in] StateMgr*: state manager
+/// @param [in] RATE: how often it runs
+/// @param [in] int: loop (0 to rate - 1) it runs in, so slow state managers don't all run in the same loop
+/// @param [in] int: state the rate applies to (other states run every loop); NO_IDLE_STATE - the rate always applies
+/// @param [in] const std::vector<StateMgr*>&: state managers it reads (already registered); they run before it
+void StateMgrScheduler::Register
+(
+    StateMgr*                       stateMgr,
+    RATE                            rate,
+    int                             phase,
+    int                             idleState,
+    const vector<StateMgr*>&        dependencies
+)
+{
+    if ( stateMgr == nullptr )
+    {
+        return;
+    }
+
+    auto level = 0;
+    for ( auto dependency : dependencies )
+    {
+        if ( dependency == nullptr )
+        {
+            continue;   // the mechanism isn't on this robot
+        }
+        auto itr = find_if(m_entries.begin(), m_entries.end(), [dependency](const Entry& entry) { return entry.stateMgr == dependency; });
+        if ( itr == m_entries.end() )
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("StateMgrScheduler"), string("Register"), string("dependency isn't registered"));
+            continue;
+        }
+        level = max(level, itr->level + 1);
+    }
+
+    for ( auto& entry : m_entries )
+    {
+        if ( entry.stateMgr == stateMgr )
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("StateMgrScheduler"), string("Register"), string("state manager registered twice"));
+            return;
+        }
+    }
+
+    auto divisor = static_cast<int>(rate);
+    if ( phase < 0 || phase >= divisor )
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, string("StateMgrScheduler"), string("Register"), string("invalid phase ") + to_string(phase));
+        phase = 0;
+    }
+
+    // keep the entries sorted by level, so each level is a contiguous run
+    auto position = find_if(m_entries.begin(), m_entries.end(), [level](const Entry& entry) { return entry.level > level; });
+    m_entries.insert(position, Entry{stateMgr, divisor, phase, idleState, level});
+    m_due.reserve(m_entries.size());
+}
+
+/// @brief Start the worker threads the independent state managers can run on in parallel.  They
+///        still run one at a time until "State Manager Scheduler/parallel" is switched on.
+/// @param [in] int: worker threads (in addition to the robot loop thread); 0 - always one at a time
+void StateMgrScheduler::SetWorkerThreads
+(
+    int                             threads
+)
+{
+    m_pool.reset(threads > 0 ? new WorkerPool(threads, "StateMgrWorker") : nullptr);
+    m_parallel = false;
+    m_parallelEntry = nt::NetworkTableInstance::GetDefault().GetTable(TABLE_NAME)->GetEntry("parallel");
+    m_parallelEntry.SetBoolean(false);
+}
+
+/// @brief Run the state managers that are due this loop
+void StateMgrScheduler::Run()
+{
+    ProfileScope scope(m_profileZone);
+
+    if ( m_pool.get() != nullptr && (m_loopCount % PARALLEL_CHECK_LOOPS) == 0 )
+    {
+        m_parallel = m_parallelEntry.GetBoolean(false);
+    }
+
+    auto idleShed = LoopWatchdog::GetInstance()->IsShedding(LoopWatchdog::SHED_LEVEL::IDLE_MECHANISMS);
+    size_t inx = 0;
+    while ( inx < m_entries.size() )
+    {
+        // collect the state managers in this level that are due
+        m_due.clear();
+        auto level = m_entries[inx].level;
+        for ( ; inx < m_entries.size() && m_entries[inx].level == level; ++inx )
+        {
+            auto& entry = m_entries[inx];
+            auto divisor = static_cast<uint64_t>(entry.divisor);
+            if ( entry.idleState != NO_IDLE_STATE )
+            {
+                if ( entry.stateMgr->GetCurrentState() != entry.idleState )
+                {
+                    divisor = 1;
+                }
+                else if ( idleShed )
+                {
+                    divisor *= static_cast<uint64_t>(LoopWatchdog::IDLE_DIVISOR);
+                }
+            }
+
+            if ( divisor <= 1 || (m_loopCount % divisor) == static_cast<uint64_t>(entry.phase) )
+            {
+                m_due.emplace_back(entry.stateMgr);
+            }
+        }
+
+        if ( m_parallel )
+        {
+            m_pool->ParallelFor(m_due.size(), [this](size_t task) { m_due[task]->RunCurrentState(); });
+        }
+        else
+        {
+            for ( auto stateMgr : m_due )
+            {
+                stateMgr->RunCurrentState();
+            }
+        }
+    }
+    ++m_loopCount;
+}
+
+/// @brief Run every state manager, whatever its rate
+void StateMgrScheduler::RunAll()
+{
+    for ( auto& entry : m_entries )
+    {
+        entry.stateMgr->RunCurrentState();
+    }
+}
@@ -0,0 +1,146 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// StateMgrScheduler.h
+//========================================================================================================
+///
+/// File Description:
+///     Runs the mechanism state managers.  Each state manager registers itself (in its constructor)
+///     with the rate it needs and a phase, so the slow ones are spread across loops instead of all
+///     landing in the same one:
+///
+///         loop        0    1    2    3    4    5    6  ...
+///         RATE_50HZ   x    x    x    x    x    x    x
+///         RATE_25HZ   x         x         x         x         (phase 0)
+///         RATE_10HZ                  x                        (phase 3)
+///
+///     A state manager can also give an idle state (e.g. the climber's OFF).  The rate then only
+///     applies while it is in that state; any other state runs every loop.  When the LoopWatchdog
+///     sheds IDLE_MECHANISMS, idle state managers run LoopWatchdog::IDLE_DIVISOR times less often.
+///
+///     A state manager also lists the state managers it reads (e.g. the indexer reads the shooter
+///     and intakes).  They are registered first (it gets them in its constructor) and always run
+///     before it.  State managers that don't depend on each other are grouped into levels:
+///
+///         level 0     left intake, right intake, shooter, climber
+///         level 1     indexer, lift
+///
+///     SetWorkerThreads starts a WorkerPool; when "State Manager Scheduler/parallel" is switched on
+///     (dashboard) the state managers in a level run in parallel and the next level starts when they
+///     have all finished.  It starts switched off (one at a time) until on-robot loop times show the
+///     pool helps; compare the "StateMgrScheduler::Run" LoopProfiler zone both ways.  State managers in the same level
+///     must not change anything the others use (they each have their own mechanism; the Logger,
+///     TeleopControl, LoopProfiler zones and TelemetryRecorder signals are safe).
+///
+///     Run is called once a loop in teleop and auton;  RunAll runs every state manager once, one
+///     at a time (mode init).  Robot loop thread only.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// FRC includes
+#include <networktables/NetworkTableEntry.h>
+
+// Team 302 includes
+#include <utils/WorkerPool.h>
+
+// Third Party Includes
+
+class StateMgr;
+
+class StateMgrScheduler
+{
+    public:
+
+        /// @enum RATE
+        /// @brief how often a state manager runs (the value is loops per run)
+        enum RATE
+        {
+            RATE_50HZ = 1,
+            RATE_25HZ = 2,
+            RATE_10HZ = 5
+        };
+
+        static constexpr int NO_IDLE_STATE = -1;
+
+        /// @brief Find or create the scheduler
+        /// @returns StateMgrScheduler* pointer to the scheduler
+        static StateMgrScheduler* GetInstance();
+
+        /// @brief Add a state manager
+        /// @param [in] StateMgr*: state manager
+        /// @param [in] RATE: how often it runs
+        /// @param [in] int: loop (0 to rate - 1) it runs in, so slow state managers don't all run in the same loop
+        /// @param [in] int: state the rate applies to (other states run every loop); NO_IDLE_STATE - the rate always applies
+        /// @param [in] const std::vector<StateMgr*>&: state managers it reads (already registered); they run before it
+        void Register
+        (
+            StateMgr*                       stateMgr,
+            RATE                            rate,
+            int                             phase,
+            int                             idleState,
+            const std::vector<StateMgr*>&   dependencies
+        );
+
+        /// @brief Start the worker threads the independent state managers can run on in parallel.  They
+        ///        still run one at a time until "State Manager Scheduler/parallel" is switched on.
+        /// @param [in] int: worker threads (in addition to the robot loop thread); 0 - always one at a time
+        void SetWorkerThreads
+        (
+            int                             threads
+        );
+
+        /// @brief Run the state managers that are due this loop
+        void Run();
+
+        /// @brief Run every state manager, whatever its rate
+        void RunAll();
+
+    private:
+        StateMgrScheduler();
+        ~StateMgrScheduler() = default;
+
+        static constexpr int PARALLEL_CHECK_LOOPS = 50;    // loops between reads of the dashboard switch
+
+        /// @struct Entry
+        /// @brief  one registered state manager
+        struct Entry
+        {
+            StateMgr*               stateMgr;
+            int                     divisor;        // loops per run
+            int                     phase;
+            int                     idleState;
+            int                     level;          // one more than the highest level it depends on
+        };
+
+        static StateMgrScheduler*   m_instance;
+
+        std::vector<Entry>          m_entries;      // sorted by level (registration order within a level)
+        std::vector<StateMgr*>      m_due;          // state managers running this loop
+        uint64_t                    m_loopCount;
+        int                         m_profileZone;
+        std::unique_ptr<WorkerPool> m_pool;
+        bool                        m_parallel;
+        nt::NetworkTableEntry       m_parallelEntry;
+};
@@ -59,8 +59,6 @@ Climber::Climber
 /// @return void 
 void Climber::Update()
 {
-    auto ntName = GetNetworkTableName();
-
     auto liftMotor = GetPrimaryMotor();
     if ( liftMotor.get() != nullptr )
     {
@@ -72,11 +70,11 @@ void Climber::Update()
         /** **/
         if ((atMinReach && liftTarget <= currentPos) || (atMaxReach && liftTarget >= currentPos))
         {
-            liftMotor.get()->GetSpeedController()->StopMotor();
+            liftMotor.get()->StopMotor();
         }
         else
         {
-            liftMotor.get()->Set(ntName, liftTarget);
+            liftMotor.get()->Set(liftTarget);
         }
         /** **/    
    }
@@ -90,11 +88,11 @@ void Climber::Update()
         /** **/
         if ((atMinRot && rotateTarget <= currentPos) || (atMaxRot && rotateTarget >= currentPos))
         {
-            rotateMotor.get()->GetSpeedController()->StopMotor();
+            rotateMotor.get()->StopMotor();
         }
         else
         {
-            rotateMotor.get()->Set(ntName, rotateTarget);
+            rotateMotor.get()->Set(rotateTarget);
         }
     }
 
@@ -162,24 +160,33 @@ void Climber::LogData()
 
     auto ntName = GetNetworkTableName();
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("Reach - Min"), GetMinReach());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("Reach - Max"), GetMaxReach());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("Reach - Current"), GetPositionInInches(GetPrimaryMotor()));
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("Reach - Target"), GetPrimaryTarget());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Reach - Min", GetMinReach());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Reach - Max", GetMaxReach());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Reach - Current", GetPositionInInches(GetPrimaryMotor()));
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Reach - Target", GetPrimaryTarget());
+    }
 
     auto liftMotor = GetPrimaryMotor();
     if (liftMotor.get() != nullptr)
     {
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("Reach - Min Switch"), liftMotor.get()->IsReverseLimitSwitchClosed() ? "true" : "false");
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("Reach - Max Switch"), liftMotor.get()->IsForwardLimitSwitchClosed() ? "true" : "false");
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Reach - Min Switch", liftMotor.get()->IsReverseLimitSwitchClosed() ? "true" : "false");
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Reach - Max Switch", liftMotor.get()->IsForwardLimitSwitchClosed() ? "true" : "false");
+        }
     }
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("Rotate - Min"), GetMinRotate());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("Rotate - Max"), GetMaxRotate());
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("Rotate - Current"), GetPositionInDegrees(GetSecondaryMotor()));
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("Rotate - Target"), GetSecondaryTarget());
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Rotate - Min", GetMinRotate());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Rotate - Max", GetMaxRotate());
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Rotate - Current", GetPositionInDegrees(GetSecondaryMotor()));
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Rotate - Target", GetSecondaryTarget());
 
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, string("Rotate - Arm Back Switch"), m_armBack.get()->Get() ? "true" : "false");
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, ntName, "Rotate - Arm Back Switch", m_armBack.get()->Get() ? "true" : "false");
+    }
 }
 double Climber::GetPositionInInches
 (
@@ -60,6 +60,11 @@ ClimberManualState::ClimberManualState
     {
         Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE,  m_climber->GetNetworkTableName(), string("Manual Climber State"), string("no control2 data"));
     }
+    else if (m_climber != nullptr)
+    {
+        m_climber->PreloadControlConstants(controlDataUpDown);
+        m_climber->PreloadSecondaryControlConstants(controlDataRotate);
+    }
 }
 
 void ClimberManualState::Init()
@@ -135,10 +140,13 @@ void ClimberManualState::Run()
        //auto rotateTarget = 0.0;
        //auto testingZero = 0.0;
 
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_climber->GetNetworkTableName(), string("Climber Manual State: Down Percent: "), armDownPercent);
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_climber->GetNetworkTableName(), string("Climber Manual State: Up Percent: "), armUpPercent);
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_climber->GetNetworkTableName(), string("Climber Manual State: UpDown Percent: "), upDownPercent);
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_climber->GetNetworkTableName(), string("Climber Manual State: Rotate Percent: "), upDownPercent);
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_climber->GetNetworkTableName(), "Climber Manual State: Down Percent: ", armDownPercent);
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_climber->GetNetworkTableName(), "Climber Manual State: Up Percent: ", armUpPercent);
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_climber->GetNetworkTableName(), "Climber Manual State: UpDown Percent: ", upDownPercent);
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_climber->GetNetworkTableName(), "Climber Manual State: Rotate Percent: ", upDownPercent);
+        }
         //m_climber->UpdateTargets(upDownPercent, rotateTarget);
 
         m_climber->UpdateTargets(upDownPercent, rotatePercent);
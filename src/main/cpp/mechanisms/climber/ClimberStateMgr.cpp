@@ -32,6 +32,7 @@
 #include <mechanisms/climber/Climber.h>
 #include <mechanisms/MechanismFactory.h>
 #include <mechanisms/MechanismTypes.h>
+#include <mechanisms/StateMgrScheduler.h>
 #include <utils/Logger.h>
 #include <mechanisms/controllers/StateDataXmlParser.h>
 
@@ -86,6 +87,7 @@ ClimberStateMgr::ClimberStateMgr() : m_climber(MechanismFactory::GetMechanismFac
     stateMap[m_climberBackHookRestXmlString] = m_backHookRestState;
 
     Init(m_climber, stateMap);
+    StateMgrScheduler::GetInstance()->Register(this, StateMgrScheduler::RATE::RATE_10HZ, 3, CLIMBER_STATE::OFF, {});
 }
 
 /// @brief run the current state
@@ -225,11 +227,17 @@ void ClimberStateMgr::CheckForStateTransition()
             targetState = CLIMBER_STATE::OFF;
         }
 
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("state"), targetState);
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "state", targetState);
+        }
         if (targetState != currentState)
         {
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("Changing climber State"), targetState);
+            if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+            {
+                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "Changing climber State", targetState);
+            }
             SetCurrentState(targetState, true);
         }
     }
-}
\ No newline at end of file
+}
\ No newline at end of file
@@ -27,6 +27,7 @@
 #include <mechanisms/Intake/LeftIntakeStateMgr.h>
 #include <mechanisms/Intake/RightIntakeStateMgr.h>
 #include <mechanisms/StateMgr.h>
+#include <mechanisms/StateMgrScheduler.h>
 #include <mechanisms/StateStruc.h>
 #include <mechanisms/MechanismFactory.h>
 #include <mechanisms/MechanismTypes.h>
@@ -71,6 +72,8 @@ IndexerStateMgr::IndexerStateMgr() : StateMgr(),
     stateMap[m_indexerIndexBothXmlString] = m_indexBothState;
 
     Init(MechanismFactory::GetMechanismFactory()->GetIndexer(), stateMap);
+    StateMgrScheduler::GetInstance()->Register(this, StateMgrScheduler::RATE::RATE_50HZ, 0, StateMgrScheduler::NO_IDLE_STATE,
+                                               {m_shooterStateMgr, LeftIntakeStateMgr::GetInstance(), RightIntakeStateMgr::GetInstance()});
 }   
 
 
@@ -87,7 +90,10 @@ void IndexerStateMgr::CheckForStateTransition()
 
         auto controller = TeleopControl::GetInstance();
 
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_indexer->GetNetworkTableName(), string("Ball Present"), ballPresent ? string("true") : string("false"));
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_indexer->GetNetworkTableName(), "Ball Present", ballPresent ? "true" : "false");
+        }
 
         if (controller != nullptr && controller->IsButtonPressed(TeleopControl::FUNCTION_IDENTIFIER::MANUAL_INDEX))
         {
@@ -24,6 +24,7 @@
 #include <mechanisms/lift/LiftState.h>
 #include <mechanisms/StateStruc.h>
 #include <mechanisms/StateMgr.h>
+#include <mechanisms/StateMgrScheduler.h>
 
 #include <mechanisms/MechanismFactory.h>
 #include <mechanisms/MechanismTypes.h>
@@ -62,6 +63,7 @@ LiftStateMgr::LiftStateMgr() : StateMgr(),
     stateMap["LIFT_LIFT"]  = m_liftState;
     stateMap["LIFT_LOWER"] = m_lowerState;
     Init(MechanismFactory::GetMechanismFactory()->GetLift(), stateMap);
+    StateMgrScheduler::GetInstance()->Register(this, StateMgrScheduler::RATE::RATE_25HZ, 1, LIFT_STATE::OFF, {m_shooterStateMgr});
 }   
 
 
@@ -29,6 +29,7 @@
 #include <mechanisms/MechanismFactory.h>
 #include <mechanisms/MechanismTypes.h>
 #include <mechanisms/StateMgr.h>
+#include <mechanisms/StateMgrScheduler.h>
 #include <mechanisms/StateStruc.h>
 #include <basemechanisms/interfaces/IState.h>
 #include <mechanisms/shooter/Shooter.h>
@@ -78,6 +79,7 @@ ShooterStateMgr::ShooterStateMgr() : StateMgr(),
     
 
     Init(m_shooter, stateMap);
+    StateMgrScheduler::GetInstance()->Register(this, StateMgrScheduler::RATE::RATE_50HZ, 0, StateMgrScheduler::NO_IDLE_STATE, {});
     if (m_shooter != nullptr)
     {
         auto m_nt = m_shooter->GetNetworkTableName();
@@ -87,7 +89,10 @@ ShooterStateMgr::ShooterStateMgr() : StateMgr(),
 
 bool ShooterStateMgr::AtTarget() const
 {
-    Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("At Target"), GetCurrentStatePtr()->AtTarget() ? "true" : "false");
+    if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "At Target", GetCurrentStatePtr()->AtTarget() ? "true" : "false");
+    }
     return GetCurrentStatePtr()->AtTarget();
 }
 
@@ -98,7 +103,10 @@ void ShooterStateMgr::CheckForStateTransition()
     {    
         auto currentState = static_cast<SHOOTER_STATE>(GetCurrentState());
         auto targetState = currentState;
-        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("current state "), currentState);
+        if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+        {
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "current state ", currentState);
+        }
 
         auto isShootHighSelected    = false;
         auto isShootLowSelected     = false;
@@ -160,7 +168,10 @@ void ShooterStateMgr::CheckForStateTransition()
 
         if (targetState != currentState)
         {
-            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, string("Changing Shooter State"), targetState);
+            if (Logger::GetLogger()->IsLoggingEnabled(Logger::LOGGER_LEVEL::PRINT))
+            {
+                Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::PRINT, m_nt, "Changing Shooter State", targetState);
+            }
             SetCurrentState(targetState, true);
         }
         
@@ -0,0 +1,120 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+///	 @class DoubleBuffer
+///  @brief	Lock-free hand off of the latest value from one writer (at a time) to any number of
+///         readers; reading doesn't change anything.  The writer fills the slot that isn't published and then publishes it, so it never
+///         waits.  Each slot has a sequence number that is odd while the slot is being written;
+///         the reader only has to retry if the writer wrote twice while it was copying.
+///         Older values are overwritten; this is for commands and states, not a queue.
+///  @tparam T  value type; must be trivially copyable (it is copied as 64 bit words)
+template<typename T>
+class DoubleBuffer
+{
+	static_assert( std::is_trivially_copyable<T>::value, "T must be trivially copyable" );
+
+	public:
+		DoubleBuffer() : m_slots(), m_published(-1)
+		{
+		}
+		~DoubleBuffer() = default;
+
+		DoubleBuffer( const DoubleBuffer& ) = delete;
+		DoubleBuffer& operator=( const DoubleBuffer& ) = delete;
+
+		/// @brief Publish a new value (writers must not call this at the same time)
+		/// @param [in] const T& value: value to copy into the buffer
+		void Write( const T& value )
+		{
+			auto published = m_published.load( std::memory_order_relaxed );
+			auto& slot = m_slots[published == 0 ? 1 : 0];
+
+			std::array<uint64_t, WORDS> words {};
+			std::memcpy( words.data(), &value, sizeof(T) );
+
+			auto sequence = slot.sequence.load( std::memory_order_relaxed );
+			slot.sequence.store( sequence+1, std::memory_order_relaxed );
+			std::atomic_thread_fence( std::memory_order_release );
+			for ( size_t inx=0; inx<WORDS; ++inx )
+			{
+				slot.words[inx].store( words[inx], std::memory_order_relaxed );
+			}
+			slot.sequence.store( sequence+2, std::memory_order_release );
+			m_published.store( published == 0 ? 1 : 0, std::memory_order_release );
+		}
+
+		/// @brief Copy the latest value (any thread)
+		/// @param [out] T& value: latest value
+		/// @return bool true - value was copied, false - nothing has been written yet
+		bool Read( T& value ) const
+		{
+			std::array<uint64_t, WORDS> words {};
+			while ( true )
+			{
+				auto published = m_published.load( std::memory_order_acquire );
+				if ( published < 0 )
+				{
+					return false;
+				}
+				auto& slot = m_slots[published];
+				auto before = slot.sequence.load( std::memory_order_acquire );
+				if ( (before & 1U) != 0 )
+				{
+					continue;
+				}
+				for ( size_t inx=0; inx<WORDS; ++inx )
+				{
+					words[inx] = slot.words[inx].load( std::memory_order_relaxed );
+				}
+				std::atomic_thread_fence( std::memory_order_acquire );
+				if ( slot.sequence.load( std::memory_order_relaxed ) == before )
+				{
+					break;
+				}
+			}
+			std::memcpy( &value, words.data(), sizeof(T) );
+			return true;
+		}
+
+	private:
+		static constexpr size_t WORDS = (sizeof(T) + sizeof(uint64_t) - 1) / sizeof(uint64_t);
+
+		struct Slot
+		{
+			std::atomic<uint32_t>					sequence {0};	// odd while the writer is filling the slot
+			std::array<std::atomic<uint64_t>, WORDS>	words {};
+		};
+
+		std::array<Slot, 2>			m_slots;
+		std::atomic<int>			m_published;	// slot the reader should use (-1 until the first Write)
+};
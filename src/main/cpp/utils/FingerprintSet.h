@@ -0,0 +1,130 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+///	 @class FingerprintSet
+///  @brief	Set of 64-bit hashes (see HashUtils) stored in one flat array with linear probing.
+///         Looking up a fingerprint that is already in the set never allocates; the array only
+///         grows (doubles) when it gets more than half full.
+class FingerprintSet
+{
+	public:
+		/// @param [in] size_t initialCapacity: number of slots to start with (rounded up to a power of 2)
+		explicit FingerprintSet( size_t initialCapacity = 256 ) : m_slots(), m_count(0)
+		{
+			size_t capacity = 16;
+			while ( capacity < initialCapacity )
+			{
+				capacity *= 2;
+			}
+			m_slots.resize( capacity, EMPTY );
+		}
+		~FingerprintSet() = default;
+
+		/// @brief Add a fingerprint
+		/// @param [in] uint64_t fingerprint: hash to add
+		/// @return bool true - it was added, false - it was already in the set
+		bool Insert( uint64_t fingerprint )
+		{
+			fingerprint = fingerprint == EMPTY ? 1 : fingerprint;	// 0 marks an empty slot
+			auto mask = m_slots.size() - 1;
+			for ( auto inx = Mix(fingerprint) & mask; ; inx = (inx+1) & mask )
+			{
+				if ( m_slots[inx] == fingerprint )
+				{
+					return false;
+				}
+				if ( m_slots[inx] == EMPTY )
+				{
+					m_slots[inx] = fingerprint;
+					++m_count;
+					if ( m_count * 2 > m_slots.size() )
+					{
+						Grow();
+					}
+					return true;
+				}
+			}
+		}
+
+		/// @brief Determine if a fingerprint is in the set
+		/// @param [in] uint64_t fingerprint: hash to look for
+		/// @return bool true - it is in the set
+		bool Contains( uint64_t fingerprint ) const
+		{
+			fingerprint = fingerprint == EMPTY ? 1 : fingerprint;
+			auto mask = m_slots.size() - 1;
+			for ( auto inx = Mix(fingerprint) & mask; m_slots[inx] != EMPTY; inx = (inx+1) & mask )
+			{
+				if ( m_slots[inx] == fingerprint )
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/// @return size_t number of fingerprints in the set
+		size_t Size() const { return m_count; }
+
+	private:
+		static constexpr uint64_t EMPTY = 0;
+
+		/// @brief spread the bits, so fingerprints that only differ in the upper bits use different slots
+		static uint64_t Mix( uint64_t value )
+		{
+			value ^= value >> 33;
+			value *= 0xff51afd7ed558ccdULL;
+			value ^= value >> 33;
+			return value;
+		}
+
+		/// @brief double the number of slots and re-insert everything
+		void Grow()
+		{
+			std::vector<uint64_t> old( m_slots.size() * 2, EMPTY );
+			old.swap( m_slots );
+			auto mask = m_slots.size() - 1;
+			for ( auto fingerprint : old )
+			{
+				if ( fingerprint != EMPTY )
+				{
+					auto inx = Mix(fingerprint) & mask;
+					while ( m_slots[inx] != EMPTY )
+					{
+						inx = (inx+1) & mask;
+					}
+					m_slots[inx] = fingerprint;
+				}
+			}
+		}
+
+		std::vector<uint64_t>	m_slots;
+		size_t					m_count;
+};
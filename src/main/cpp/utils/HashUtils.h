@@ -0,0 +1,88 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+///	 @class HashUtils
+///  @brief	64-bit FNV-1a hashing of strings and raw values.  Used to build look up keys without
+///         building (allocating) a combined string first.
+class HashUtils
+{
+	public:
+		HashUtils() = delete;
+		~HashUtils() = delete;
+
+		/// @brief starting value for a hash
+		static constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+
+		/// @brief multiplier applied for each byte
+		static constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+
+		/// @brief Add bytes to a hash
+		/// @param [in] const void* data: bytes to add
+		/// @param [in] size_t size: number of bytes
+		/// @param [in] uint64_t hash: hash to add to (FNV_OFFSET_BASIS to start a new hash)
+		/// @return uint64_t updated hash
+		inline static uint64_t Hash( const void* data, size_t size, uint64_t hash = FNV_OFFSET_BASIS )
+		{
+			auto bytes = static_cast<const unsigned char*>(data);
+			for ( size_t inx=0; inx<size; ++inx )
+			{
+				hash ^= bytes[inx];
+				hash *= FNV_PRIME;
+			}
+			return hash;
+		}
+
+		/// @brief Add a string to a hash.  A separator byte is added after the string, so ("ab","c")
+		///        and ("a","bc") create different hashes when strings are chained together.
+		/// @param [in] std::string_view text: characters to add
+		/// @param [in] uint64_t hash: hash to add to (FNV_OFFSET_BASIS to start a new hash)
+		/// @return uint64_t updated hash
+		inline static constexpr uint64_t Hash( std::string_view text, uint64_t hash = FNV_OFFSET_BASIS )
+		{
+			for ( auto ch : text )
+			{
+				hash ^= static_cast<unsigned char>(ch);
+				hash *= FNV_PRIME;
+			}
+			hash ^= 0xFF;
+			hash *= FNV_PRIME;
+			return hash;
+		}
+
+		/// @brief Add a value (double, int, bool, ...) to a hash using its bytes
+		/// @param [in] T value: value to add
+		/// @param [in] uint64_t hash: hash to add to (FNV_OFFSET_BASIS to start a new hash)
+		/// @return uint64_t updated hash
+		template<typename T>
+		inline static uint64_t HashValue( T value, uint64_t hash = FNV_OFFSET_BASIS )
+		{
+			return Hash( &value, sizeof(value), hash );
+		}
+};
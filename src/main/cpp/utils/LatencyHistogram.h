@@ -0,0 +1,126 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <cstdint>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+///	 @class LatencyHistogram
+///  @brief	Fixed size histogram of durations in microseconds (HDR style:  exact below 16 us, then 16
+///         buckets per power of 2, so every value is within about 6% of its bucket).  Recording is
+///         a couple of shifts and an increment; nothing is ever allocated.  Values of 16 seconds or
+///         more are counted in the last bucket.
+class LatencyHistogram
+{
+	public:
+		LatencyHistogram() : m_counts(), m_count(0), m_max(0)
+		{
+		}
+		~LatencyHistogram() = default;
+
+		/// @brief Add a duration
+		/// @param [in] uint64_t micros: duration in microseconds
+		void Record( uint64_t micros )
+		{
+			++m_counts[GetBucket( micros )];
+			++m_count;
+			m_max = micros > m_max ? micros : m_max;
+		}
+
+		/// @brief Find the value below which a fraction of the durations fall
+		/// @param [in] double fraction: 0.5 for the median, 0.99 for the 99th percentile
+		/// @return uint64_t upper end of the bucket holding the percentile (microseconds), never more than GetMax
+		uint64_t GetPercentile( double fraction ) const
+		{
+			if ( m_count == 0 )
+			{
+				return 0;
+			}
+			auto target = static_cast<uint64_t>( fraction * static_cast<double>(m_count) + 0.5 );
+			target = target < 1 ? 1 : target;
+			uint64_t seen = 0;
+			for ( auto bucket = 0U; bucket < BUCKETS; ++bucket )
+			{
+				seen += m_counts[bucket];
+				if ( seen >= target )
+				{
+					auto value = GetBucketTop( bucket );
+					return value < m_max ? value : m_max;
+				}
+			}
+			return m_max;
+		}
+
+		/// @return uint64_t longest duration recorded (microseconds)
+		uint64_t GetMax() const { return m_max; }
+
+		/// @return uint64_t number of durations recorded
+		uint64_t GetCount() const { return m_count; }
+
+		/// @brief Start over (e.g. at the start of each publishing period)
+		void Reset()
+		{
+			m_counts.fill( 0 );
+			m_count = 0;
+			m_max = 0;
+		}
+
+	private:
+		static constexpr unsigned SUB_BITS = 4;						// 16 buckets per power of 2
+		static constexpr unsigned SUB_COUNT = 1U << SUB_BITS;
+		static constexpr unsigned MAX_POWER = 24;					// 2^24 us = 16.7 seconds
+		static constexpr unsigned BUCKETS = (MAX_POWER - SUB_BITS + 1) * SUB_COUNT;
+
+		static unsigned GetBucket( uint64_t micros )
+		{
+			if ( micros < SUB_COUNT )
+			{
+				return static_cast<unsigned>( micros );
+			}
+			unsigned power = 63U - static_cast<unsigned>( __builtin_clzll( micros ) );
+			if ( power >= MAX_POWER )
+			{
+				return BUCKETS - 1;
+			}
+			auto shift = power - SUB_BITS;
+			return shift * SUB_COUNT + static_cast<unsigned>( micros >> shift );		// micros >> shift is 16 - 31
+		}
+
+		static uint64_t GetBucketTop( unsigned bucket )
+		{
+			if ( bucket < 2 * SUB_COUNT )
+			{
+				return bucket;
+			}
+			auto shift = bucket / SUB_COUNT - 1;
+			auto sub = static_cast<uint64_t>( bucket % SUB_COUNT + SUB_COUNT );
+			return ( (sub + 1) << shift ) - 1;
+		}
+
+		std::array<uint32_t, BUCKETS>	m_counts;
+		uint64_t						m_count;
+		uint64_t						m_max;
+};
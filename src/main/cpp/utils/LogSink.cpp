@@ -0,0 +1,348 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// LogSink.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Queues log records on the robot loop and writes them from a low priority thread
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// FRC includes
+#include <frc/RobotController.h>
+
+// Team 302 includes
+#include <utils/LogSink.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    /// @brief copy as much of the text as fits into a fixed size field
+    /// @returns uint8_t number of characters copied
+    uint8_t CopyField
+    (
+        string_view     text,
+        char*           field,
+        size_t          fieldSize
+    )
+    {
+        auto length = min(text.size(), fieldSize);
+        memcpy(field, text.data(), length);
+        return static_cast<uint8_t>(length);
+    }
+}
+
+LogSink::LogSink() : m_ring(),
+                     m_dropped(0),
+                     m_running(false),
+                     m_writerStarted(false),
+                     m_writer(),
+                     m_file(),
+                     m_fileFailed(false)
+{
+}
+
+LogSink::~LogSink()
+{
+    m_running.store(false, memory_order_release);
+    if (m_writer.joinable())
+    {
+        m_writer.join();
+    }
+}
+
+/// @brief queue a message for the writer thread
+/// @param [in] SINK_TARGET: where the message goes
+/// @param [in] std::string_view: group (truncated if too long)
+/// @param [in] std::string_view: identifier (truncated if too long)
+/// @param [in] std::string_view: message text (truncated if too long)
+void LogSink::Write
+(
+    SINK_TARGET     target,
+    string_view     group,
+    string_view     identifier,
+    string_view     message
+)
+{
+    auto record = Start(target, VALUE_TYPE::TEXT, group, identifier);
+    if (record != nullptr)
+    {
+        record->messageLength = CopyField(message, record->message, MAX_MESSAGE_LENGTH);
+        m_ring.Commit();
+    }
+}
+
+/// @brief queue a value for the writer thread; it is formatted by the writer thread
+/// @param [in] SINK_TARGET: where the message goes
+/// @param [in] std::string_view: group (truncated if too long)
+/// @param [in] std::string_view: identifier (truncated if too long)
+/// @param [in] double: value to display
+void LogSink::Write
+(
+    SINK_TARGET     target,
+    string_view     group,
+    string_view     identifier,
+    double          value
+)
+{
+    auto record = Start(target, VALUE_TYPE::DOUBLE, group, identifier);
+    if (record != nullptr)
+    {
+        record->number = value;
+        m_ring.Commit();
+    }
+}
+
+/// @brief queue a value for the writer thread; it is formatted by the writer thread
+/// @param [in] SINK_TARGET: where the message goes
+/// @param [in] std::string_view: group (truncated if too long)
+/// @param [in] std::string_view: identifier (truncated if too long)
+/// @param [in] bool: value to display
+void LogSink::Write
+(
+    SINK_TARGET     target,
+    string_view     group,
+    string_view     identifier,
+    bool            value
+)
+{
+    auto record = Start(target, VALUE_TYPE::BOOL, group, identifier);
+    if (record != nullptr)
+    {
+        record->flag = value;
+        m_ring.Commit();
+    }
+}
+
+/// @brief queue a value for the writer thread; it is formatted by the writer thread
+/// @param [in] SINK_TARGET: where the message goes
+/// @param [in] std::string_view: group (truncated if too long)
+/// @param [in] std::string_view: identifier (truncated if too long)
+/// @param [in] int: value to display
+void LogSink::Write
+(
+    SINK_TARGET     target,
+    string_view     group,
+    string_view     identifier,
+    int             value
+)
+{
+    auto record = Start(target, VALUE_TYPE::INT, group, identifier);
+    if (record != nullptr)
+    {
+        record->integer = value;
+        m_ring.Commit();
+    }
+}
+
+/// @brief claim a ring buffer slot and fill in the common fields
+/// @returns LogRecord* slot to finish filling in or nullptr if the ring is full (record is dropped)
+LogSink::LogRecord* LogSink::Start
+(
+    SINK_TARGET     target,
+    VALUE_TYPE      type,
+    string_view     group,
+    string_view     identifier
+)
+{
+    if (!m_writerStarted)
+    {
+        StartWriter();
+    }
+
+    auto record = m_ring.Claim();
+    if (record == nullptr)
+    {
+        m_dropped.fetch_add(1, memory_order_relaxed);
+        return nullptr;
+    }
+
+    record->timestamp        = frc::RobotController::GetFPGATime();
+    record->target           = target;
+    record->type             = type;
+    record->groupLength      = CopyField(group, record->group, MAX_GROUP_LENGTH);
+    record->identifierLength = CopyField(identifier, record->identifier, MAX_IDENTIFIER_LENGTH);
+    record->messageLength    = 0;
+    return record;
+}
+
+/// @brief start the writer thread if it isn't running yet
+void LogSink::StartWriter()
+{
+    m_writerStarted = true;
+    m_running.store(true, memory_order_release);
+    m_writer = thread(&LogSink::WriterLoop, this);
+}
+
+/// @brief writer thread: drain the ring buffer, format and write the records
+void LogSink::WriterLoop()
+{
+#ifdef __linux__
+    // run below the robot threads (nice 10), so writing never competes with the robot loop
+    setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10);
+#endif
+
+    string consoleText;
+    string fileText;
+    uint64_t reportedDrops = 0;
+    LogRecord record;
+
+    while (m_running.load(memory_order_acquire) || !m_ring.IsEmpty())
+    {
+        consoleText.clear();
+        fileText.clear();
+        while (m_ring.TryPop(record))
+        {
+            if (record.target == SINK_TARGET::FILE)
+            {
+                Format(record, true, fileText);
+            }
+            else
+            {
+                Format(record, false, consoleText);
+            }
+        }
+
+        auto dropped = m_dropped.load(memory_order_relaxed);
+        if (dropped != reportedDrops)
+        {
+            consoleText.append("Logger dropped records: ");
+            consoleText.append(to_string(dropped - reportedDrops));
+            consoleText.append("\n");
+            reportedDrops = dropped;
+        }
+
+        // one write and flush per batch instead of per message
+        if (!consoleText.empty())
+        {
+            cout << consoleText << flush;
+        }
+        if (!fileText.empty() && OpenFile())
+        {
+            m_file << fileText << flush;
+        }
+
+        this_thread::sleep_for(chrono::milliseconds(20));
+    }
+}
+
+/// @brief format one record onto the end of a string
+/// @param [in] const LogRecord&: record to format
+/// @param [in] bool: true - include the timestamp
+/// @param [in/out] std::string&: text to append to
+void LogSink::Format
+(
+    const LogRecord&    record,
+    bool                includeTime,
+    string&             text
+)
+{
+    if (includeTime)
+    {
+        char time[32];
+        snprintf(time, sizeof(time), "%.6f ", static_cast<double>(record.timestamp) / 1000000.0);
+        text.append(time);
+    }
+
+    text.append(record.group, record.groupLength);
+    text.append(" ");
+    text.append(record.identifier, record.identifierLength);
+    text.append(": ");
+
+    switch (record.type)
+    {
+        case VALUE_TYPE::TEXT:
+            text.append(record.message, record.messageLength);
+            break;
+
+        case VALUE_TYPE::DOUBLE:
+            text.append(to_string(record.number));
+            break;
+
+        case VALUE_TYPE::BOOL:
+            text.append(to_string(record.flag));
+            break;
+
+        case VALUE_TYPE::INT:
+            text.append(to_string(record.integer));
+            break;
+
+        default:
+            break;
+    }
+    text.append("\n");
+}
+
+/// @brief open the log file the first time a FILE record is written
+/// @returns bool: true - file is open
+bool LogSink::OpenFile()
+{
+    if (m_file.is_open())
+    {
+        return true;
+    }
+    if (m_fileFailed)
+    {
+        return false;
+    }
+
+    auto name = GetLogDirectory() + "/robot_" + to_string(frc::RobotController::GetFPGATime()) + ".log";
+    m_file.open(name, ios::out | ios::app);
+    if (!m_file.is_open())
+    {
+        m_fileFailed = true;
+        cout << "Logger couldn't open log file " << name << endl;
+        return false;
+    }
+    return true;
+}
+
+/// @brief Directory log files are written to:  the USB stick (mounted at /u on the RoboRio) if there
+///        is one, so the RoboRio's flash isn't worn out, otherwise /home/lvuser/logs
+/// @returns std::string directory (created if needed)
+string LogSink::GetLogDirectory()
+{
+    error_code err;
+    filesystem::path dir("/u");
+    if (!filesystem::is_directory(dir, err))
+    {
+        dir = filesystem::path("/home/lvuser/logs");
+        filesystem::create_directories(dir, err);
+    }
+    return dir.string();
+}
@@ -0,0 +1,196 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// LogSink.h
+//========================================================================================================
+///
+/// File Description:
+///     Moves console and file logging off of the robot loop.  The loop copies a fixed size binary
+///     record into a lock-free ring buffer; a low priority thread formats the records and writes
+///     them out.  If the ring is full the record is dropped (and counted) instead of waiting.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <thread>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/SpscRingBuffer.h>
+
+// Third Party Includes
+
+
+class LogSink
+{
+    public:
+
+        /// @enum SINK_TARGET
+        /// @brief Where the writer thread sends a record
+        enum SINK_TARGET
+        {
+            CONSOLE,        ///< write to the RoboRio Console
+            FILE            ///< append to a log file (USB stick if one is plugged in, otherwise /home/lvuser/logs)
+        };
+
+        LogSink();
+        ~LogSink();
+
+        LogSink( const LogSink& ) = delete;
+        LogSink& operator=( const LogSink& ) = delete;
+
+        /// @brief queue a message for the writer thread
+        /// @param [in] SINK_TARGET: where the message goes
+        /// @param [in] std::string_view: group (truncated if too long)
+        /// @param [in] std::string_view: identifier (truncated if too long)
+        /// @param [in] std::string_view: message text (truncated if too long)
+        void Write
+        (
+            SINK_TARGET             target,
+            std::string_view        group,
+            std::string_view        identifier,
+            std::string_view        message
+        );
+
+        /// @brief queue a value for the writer thread; it is formatted by the writer thread
+        /// @param [in] SINK_TARGET: where the message goes
+        /// @param [in] std::string_view: group (truncated if too long)
+        /// @param [in] std::string_view: identifier (truncated if too long)
+        /// @param [in] double: value to display
+        void Write
+        (
+            SINK_TARGET             target,
+            std::string_view        group,
+            std::string_view        identifier,
+            double                  value
+        );
+
+        /// @brief queue a value for the writer thread; it is formatted by the writer thread
+        /// @param [in] SINK_TARGET: where the message goes
+        /// @param [in] std::string_view: group (truncated if too long)
+        /// @param [in] std::string_view: identifier (truncated if too long)
+        /// @param [in] bool: value to display
+        void Write
+        (
+            SINK_TARGET             target,
+            std::string_view        group,
+            std::string_view        identifier,
+            bool                    value
+        );
+
+        /// @brief queue a value for the writer thread; it is formatted by the writer thread
+        /// @param [in] SINK_TARGET: where the message goes
+        /// @param [in] std::string_view: group (truncated if too long)
+        /// @param [in] std::string_view: identifier (truncated if too long)
+        /// @param [in] int: value to display
+        void Write
+        (
+            SINK_TARGET             target,
+            std::string_view        group,
+            std::string_view        identifier,
+            int                     value
+        );
+
+        /// @brief Number of records thrown away because the writer thread couldn't keep up
+        /// @returns uint64_t number of dropped records
+        uint64_t GetDroppedCount() const { return m_dropped.load(std::memory_order_relaxed); }
+
+        /// @brief Directory log files are written to:  the USB stick if there is one, otherwise /home/lvuser/logs
+        /// @returns std::string directory (created if needed)
+        static std::string GetLogDirectory();
+
+    private:
+        /// @enum VALUE_TYPE
+        /// @brief how the record's value is stored
+        enum VALUE_TYPE : uint8_t
+        {
+            TEXT,
+            DOUBLE,
+            BOOL,
+            INT
+        };
+
+        static constexpr size_t MAX_GROUP_LENGTH      = 32;
+        static constexpr size_t MAX_IDENTIFIER_LENGTH = 64;
+        static constexpr size_t MAX_MESSAGE_LENGTH    = 128;
+        static constexpr size_t RING_SIZE             = 1024;   // ~1 s of heavy logging at 50 Hz
+
+        /// @struct LogRecord
+        /// @brief  fixed size record copied into the ring buffer (no pointers, no heap)
+        struct LogRecord
+        {
+            uint64_t        timestamp;                          // FPGA time (microseconds)
+            SINK_TARGET     target;
+            VALUE_TYPE      type;
+            uint8_t         groupLength;
+            uint8_t         identifierLength;
+            uint8_t         messageLength;
+            char            group[MAX_GROUP_LENGTH];
+            char            identifier[MAX_IDENTIFIER_LENGTH];
+            char            message[MAX_MESSAGE_LENGTH];
+            double          number;
+            int             integer;
+            bool            flag;
+        };
+
+        /// @brief claim a ring buffer slot and fill in the common fields
+        /// @returns LogRecord* slot to finish filling in or nullptr if the ring is full (record is dropped)
+        LogRecord* Start
+        (
+            SINK_TARGET             target,
+            VALUE_TYPE              type,
+            std::string_view        group,
+            std::string_view        identifier
+        );
+
+        /// @brief start the writer thread if it isn't running yet
+        void StartWriter();
+
+        /// @brief writer thread: drain the ring buffer, format and write the records
+        void WriterLoop();
+
+        /// @brief format one record onto the end of a string
+        /// @param [in] const LogRecord&: record to format
+        /// @param [in] bool: true - include the timestamp
+        /// @param [in/out] std::string&: text to append to
+        static void Format
+        (
+            const LogRecord&        record,
+            bool                    includeTime,
+            std::string&            text
+        );
+
+        /// @brief open the log file the first time a FILE record is written
+        /// @returns bool: true - file is open
+        bool OpenFile();
+
+        SpscRingBuffer<LogRecord, RING_SIZE>    m_ring;
+        std::atomic<uint64_t>                   m_dropped;
+        std::atomic<bool>                       m_running;
+        bool                                    m_writerStarted;    // only used by the producer thread
+        std::thread                             m_writer;
+        std::ofstream                           m_file;             // only used by the writer thread
+        bool                                    m_fileFailed;       // only used by the writer thread
+};
@@ -26,11 +26,15 @@
 
 // C++ Includes
 #include <algorithm>
-#include <iostream>
+#include <array>
+#include <cstdio>
 #include <locale>
+#include <mutex>
 #include <string>
+#include <string_view>
 
 // FRC includes
+#include <frc/RobotController.h>
 #include <frc/SmartDashboard/SendableChooser.h>
 #include <frc/SmartDashboard/SmartDashboard.h>
 #include <networktables/NetworkTableInstance.h>
@@ -38,6 +42,7 @@
 #include <networktables/NetworkTableEntry.h>
 
 // Team 302 includes
+#include <utils/HashUtils.h>
 #include <utils/Logger.h>
 
 
@@ -62,31 +67,42 @@ Logger* Logger::GetLogger()
 
 /// @brief log a message
 /// @param [in] LOGGER_LEVEL: message level
-/// @param [in] std::string: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
-/// @param [in] std::string: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
-/// @param [in] std::string: message/value
+/// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+/// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+/// @param [in] std::string_view: message/value
 void Logger::LogData
 (
     LOGGER_LEVEL    level,
-    const string&   group,
-    const string&   identifier,     
-    const string&   message                 
+    string_view     group,
+    string_view     identifier,     
+    string_view     message                 
 )
 {
-    if (ShouldDisplayIt(level, group, identifier, message))
+    if (!IsLoggingEnabled(level))
     {
-        switch ( m_option )
+        return;
+    }
+
+    lock_guard<recursive_mutex> lock(m_mutex);
+    if (PassesGroupFilters(level, group, identifier) && ShouldDisplayIt(level, group, identifier, message))
+    {
+        switch ( m_option.load(memory_order_relaxed) )
         {
             case LOGGER_OPTION::CONSOLE:
             {
-                cout << group << " " << identifier << ": " << message << endl;
+                m_sink.Write(LogSink::SINK_TARGET::CONSOLE, group, identifier, message);
+            }
+            break;
+
+            case LOGGER_OPTION::FILE:
+            {
+                m_sink.Write(LogSink::SINK_TARGET::FILE, group, identifier, message);
             }
             break;
 
             case LOGGER_OPTION::DASHBOARD:
             {
-                auto table = nt::NetworkTableInstance::GetDefault().GetTable(group);
-        	    table.get()->PutString(identifier, message);
+                m_signals[FindSignal(group, identifier)].entry.SetString(message);
             }
             break;
 
@@ -97,150 +113,518 @@ void Logger::LogData
     }
 }
 
+/// @brief log a message (string literals would otherwise be converted to bool)
+/// @param [in] LOGGER_LEVEL: message level
+/// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+/// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+/// @param [in] const char*: message/value
+void Logger::LogData
+(
+    LOGGER_LEVEL    level,
+    string_view     group,
+    string_view     identifier,     
+    const char*     message                 
+)
+{
+    LogData(level, group, identifier, string_view(message != nullptr ? message : ""));
+}
+
 /// @brief log a message
 /// @param [in] LOGGER_LEVEL: message level
-/// @param [in] std::string: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
-/// @param [in] std::string: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+/// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+/// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
 /// @param [in] double: value to display       
 void Logger::LogData
 (
     LOGGER_LEVEL    level,
-    const string&   group,
-    const string&   identifier,     
+    string_view     group,
+    string_view     identifier,     
     double          value                 
 )
 {
-    if (ShouldDisplayIt(level, group, identifier, to_string(value)))
+    if (!IsLoggingEnabled(level))
     {
-        switch ( m_option )
-        {
-            case LOGGER_OPTION::CONSOLE:
-            {
-                cout << group << " " << identifier << ": " << to_string(value) << endl;
-            }
-            break;
+        return;
+    }
 
-            case LOGGER_OPTION::DASHBOARD:
-            {
-                auto table = nt::NetworkTableInstance::GetDefault().GetTable(group);
-	            table.get()->PutNumber(identifier, value);
-            }
-            break;
+    lock_guard<recursive_mutex> lock(m_mutex);
+    if (!PassesGroupFilters(level, group, identifier) || (IsOnceLevel(level) && !ShouldDisplayIt(level, group, identifier, value)))
+    {
+        return;
+    }
 
-            default:  // case LOGGER_OPTION::EAT_IT:
-                break;
+    switch ( m_option.load(memory_order_relaxed) )
+    {
+        case LOGGER_OPTION::CONSOLE:
+        {
+            m_sink.Write(LogSink::SINK_TARGET::CONSOLE, group, identifier, value);
+        }
+        break;
 
+        case LOGGER_OPTION::FILE:
+        {
+            m_sink.Write(LogSink::SINK_TARGET::FILE, group, identifier, value);
         }
+        break;
+
+        case LOGGER_OPTION::DASHBOARD:
+        {
+            m_signals[FindSignal(group, identifier)].entry.SetDouble(value);
+        }
+        break;
+
+        default:  // case LOGGER_OPTION::EAT_IT:
+            break;
+
     }
 }
 
 
 /// @brief log a message
 /// @param [in] LOGGER_LEVEL: message level
-/// @param [in] std::string: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
-/// @param [in] std::string: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+/// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+/// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
 /// @param [in] bool: value to display       
 void Logger::LogData
 (
     LOGGER_LEVEL            level,   
-    const std::string&      group,
-    const std::string&      identifier,     
+    string_view             group,
+    string_view             identifier,     
     bool                    value                 
 )
 {
-    if (ShouldDisplayIt(level, group, identifier, to_string(value)))
+    if (!IsLoggingEnabled(level))
     {
-        switch ( m_option )
-        {
-            case LOGGER_OPTION::CONSOLE:
-            {
-                cout << group << " " << identifier << ": " << to_string(value) << endl;
-            }
-            break;
+        return;
+    }
 
-            case LOGGER_OPTION::DASHBOARD:
-            {
-                auto table = nt::NetworkTableInstance::GetDefault().GetTable(group);
-	            table.get()->PutBoolean(identifier, value);
-            }
-            break;
+    lock_guard<recursive_mutex> lock(m_mutex);
+    if (!PassesGroupFilters(level, group, identifier) || (IsOnceLevel(level) && !ShouldDisplayIt(level, group, identifier, static_cast<double>(value))))
+    {
+        return;
+    }
 
-            default:  // case LOGGER_OPTION::EAT_IT:
-                break;
+    switch ( m_option.load(memory_order_relaxed) )
+    {
+        case LOGGER_OPTION::CONSOLE:
+        {
+            m_sink.Write(LogSink::SINK_TARGET::CONSOLE, group, identifier, value);
+        }
+        break;
 
+        case LOGGER_OPTION::FILE:
+        {
+            m_sink.Write(LogSink::SINK_TARGET::FILE, group, identifier, value);
+        }
+        break;
+
+        case LOGGER_OPTION::DASHBOARD:
+        {
+            m_signals[FindSignal(group, identifier)].entry.SetBoolean(value);
         }
+        break;
+
+        default:  // case LOGGER_OPTION::EAT_IT:
+            break;
+
     }
 }
 
 /// @brief log a message
 /// @param [in] LOGGER_LEVEL: message level
-/// @param [in] std::string: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
-/// @param [in] std::string: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+/// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+/// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
 /// @param [in] int: value to display       
 void Logger::LogData
 (
     LOGGER_LEVEL            level,   
-    const std::string&      group,
-    const std::string&      identifier,     
+    string_view             group,
+    string_view             identifier,     
     int                     value                 
 )
 {
-    if (ShouldDisplayIt(level, group, identifier, to_string(value)))
+    if (!IsLoggingEnabled(level))
+    {
+        return;
+    }
+
+    lock_guard<recursive_mutex> lock(m_mutex);
+    if (!PassesGroupFilters(level, group, identifier) || (IsOnceLevel(level) && !ShouldDisplayIt(level, group, identifier, static_cast<double>(value))))
+    {
+        return;
+    }
+
+    switch ( m_option.load(memory_order_relaxed) )
     {
-        switch ( m_option )
+        case LOGGER_OPTION::CONSOLE:
         {
-            case LOGGER_OPTION::CONSOLE:
-            {
-                cout << group << " " << identifier << ": " << to_string(value) << endl;
-            }
+            m_sink.Write(LogSink::SINK_TARGET::CONSOLE, group, identifier, value);
+        }
+        break;
+
+        case LOGGER_OPTION::FILE:
+        {
+            m_sink.Write(LogSink::SINK_TARGET::FILE, group, identifier, value);
+        }
+        break;
+
+        case LOGGER_OPTION::DASHBOARD:
+        {
+            m_signals[FindSignal(group, identifier)].entry.SetDouble(value);
+        }
+        break;
+
+        default:  // case LOGGER_OPTION::EAT_IT:
             break;
 
-            case LOGGER_OPTION::DASHBOARD:
-            {
-                auto table = nt::NetworkTableInstance::GetDefault().GetTable(group);
-	            table.get()->PutNumber(identifier, value);
-            }
+    }
+}
+
+/// @brief Register a value that is logged every loop.  The group and identifier are resolved to a 
+///        network table entry once, so logging with the returned handle doesn't do any string look ups.
+/// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+/// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+/// @returns int: handle to pass to LogSignal
+int Logger::RegisterSignal
+(
+    string_view     group,
+    string_view     identifier
+)
+{
+    lock_guard<recursive_mutex> lock(m_mutex);
+    return FindSignal(group, identifier);
+}
+
+/// @brief log a value for a signal from RegisterSignal (bool values are sent as 0/1)
+/// @param [in] LOGGER_LEVEL: message level
+/// @param [in] int: signal handle from RegisterSignal
+/// @param [in] double: value to display       
+void Logger::LogSignal
+(
+    LOGGER_LEVEL    level,
+    int             signal,
+    double          value
+)
+{
+    if (!IsLoggingEnabled(level))
+    {
+        return;
+    }
+
+    lock_guard<recursive_mutex> lock(m_mutex);
+    if (signal < 0 || signal >= static_cast<int>(m_signals.size()))
+    {
+        return;
+    }
+
+    auto& logged = m_signals[signal];
+    if (!PassesGroupFilters(level, logged.groupHash, logged.key) || (IsOnceLevel(level) && !ShouldDisplayIt(level, logged.group, logged.identifier, value)))
+    {
+        return;
+    }
+
+    switch ( m_option.load(memory_order_relaxed) )
+    {
+        case LOGGER_OPTION::CONSOLE:
+        {
+            m_sink.Write(LogSink::SINK_TARGET::CONSOLE, logged.group, logged.identifier, value);
+        }
+        break;
+
+        case LOGGER_OPTION::FILE:
+        {
+            m_sink.Write(LogSink::SINK_TARGET::FILE, logged.group, logged.identifier, value);
+        }
+        break;
+
+        case LOGGER_OPTION::DASHBOARD:
+        {
+            logged.entry.SetDouble(value);
+        }
+        break;
+
+        default:  // case LOGGER_OPTION::EAT_IT:
             break;
+    }
+}
 
-            default:  // case LOGGER_OPTION::EAT_IT:
-                break;
+/// @brief log a message for a signal from RegisterSignal
+/// @param [in] LOGGER_LEVEL: message level
+/// @param [in] int: signal handle from RegisterSignal
+/// @param [in] std::string_view: message - text of the message       
+void Logger::LogSignal
+(
+    LOGGER_LEVEL    level,
+    int             signal,
+    string_view     message
+)
+{
+    if (!IsLoggingEnabled(level))
+    {
+        return;
+    }
+
+    lock_guard<recursive_mutex> lock(m_mutex);
+    if (signal < 0 || signal >= static_cast<int>(m_signals.size()))
+    {
+        return;
+    }
+
+    auto& logged = m_signals[signal];
+    if (!PassesGroupFilters(level, logged.groupHash, logged.key) || !ShouldDisplayIt(level, logged.group, logged.identifier, message))
+    {
+        return;
+    }
+
+    switch ( m_option.load(memory_order_relaxed) )
+    {
+        case LOGGER_OPTION::CONSOLE:
+        {
+            m_sink.Write(LogSink::SINK_TARGET::CONSOLE, logged.group, logged.identifier, message);
+        }
+        break;
 
+        case LOGGER_OPTION::FILE:
+        {
+            m_sink.Write(LogSink::SINK_TARGET::FILE, logged.group, logged.identifier, message);
         }
+        break;
+
+        case LOGGER_OPTION::DASHBOARD:
+        {
+            logged.entry.SetString(message);
+        }
+        break;
+
+        default:  // case LOGGER_OPTION::EAT_IT:
+            break;
     }
 }
 
+/// @brief Register a value that changes faster than the dashboard can show it.  The min, max, mean
+///        and last value over each window are published once per window.
+/// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+/// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+/// @param [in] double: window length (seconds)
+/// @returns int: handle to pass to LogAggregate
+int Logger::RegisterAggregate
+(
+    string_view     group,
+    string_view     identifier,
+    double          windowSeconds
+)
+{
+    lock_guard<recursive_mutex> lock(m_mutex);
+    auto signal = FindSignal(group, identifier);
+    auto window = static_cast<uint64_t>(max(windowSeconds, 0.02) * 1000000.0);
+    auto& logged = m_signals[signal];
+    if (logged.aggregate >= 0)
+    {
+        m_aggregates[logged.aggregate].window = window;
+        return logged.aggregate;
+    }
+
+    AggregatedSignal aggregate {signal, window, 0, LOGGER_LEVEL::PRINT, 0, 0.0, 0.0, 0.0, 0.0};
+    m_aggregates.emplace_back(aggregate);
+    logged.aggregate = static_cast<int>(m_aggregates.size()) - 1;
+    return logged.aggregate;
+}
+
+/// @brief add a value to an aggregate from RegisterAggregate; it is published when its window is over
+/// @param [in] LOGGER_LEVEL: message level
+/// @param [in] int: aggregate handle from RegisterAggregate
+/// @param [in] double: value
+void Logger::LogAggregate
+(
+    LOGGER_LEVEL    level,
+    int             aggregate,
+    double          value
+)
+{
+    if (!IsLoggingEnabled(level) || m_aggregationSuspended.load(memory_order_relaxed))
+    {
+        return;
+    }
+
+    lock_guard<recursive_mutex> lock(m_mutex);
+    if (aggregate < 0 || aggregate >= static_cast<int>(m_aggregates.size()))
+    {
+        return;
+    }
+
+    auto& values = m_aggregates[aggregate];
+    auto now = RobotController::GetFPGATime();
+    if (values.count > 0 && now - values.windowStart >= 2 * values.window)
+    {
+        values.count = 0;       // logging was off (or nothing was logged) for a while; don't publish old values
+    }
+    if (values.count == 0)
+    {
+        values.windowStart = now;
+        values.minimum = value;
+        values.maximum = value;
+        values.total = 0.0;
+    }
+    values.minimum = min(values.minimum, value);
+    values.maximum = max(values.maximum, value);
+    values.total += value;
+    values.last = value;
+    values.level = level;
+    ++values.count;
+
+    if (now - values.windowStart >= values.window)
+    {
+        PublishAggregate(values);
+        values.count = 0;
+    }
+}
+
+/// @brief add a value to an aggregate, registering it (with the default window) the first time it is seen
+/// @param [in] LOGGER_LEVEL: message level
+/// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+/// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+/// @param [in] double: value
+void Logger::LogAggregate
+(
+    LOGGER_LEVEL    level,
+    string_view     group,
+    string_view     identifier,
+    double          value
+)
+{
+    if (IsLoggingEnabled(level) && !m_aggregationSuspended.load(memory_order_relaxed))
+    {
+        lock_guard<recursive_mutex> lock(m_mutex);
+        auto aggregate = m_signals[FindSignal(group, identifier)].aggregate;
+        LogAggregate(level, aggregate >= 0 ? aggregate : RegisterAggregate(group, identifier), value);
+    }
+}
+
+/// @brief Publish an aggregate's window
+/// @param [in] AggregatedSignal&: aggregate
+void Logger::PublishAggregate
+(
+    const AggregatedSignal&     aggregate
+)
+{
+    auto& logged = m_signals[aggregate.signal];
+    if (!PassesGroupFilters(aggregate.level, logged.groupHash, logged.key))
+    {
+        return;
+    }
+
+    array<double, 4> values = {aggregate.minimum, aggregate.maximum, aggregate.total / aggregate.count, aggregate.last};
+    switch ( m_option.load(memory_order_relaxed) )
+    {
+        case LOGGER_OPTION::CONSOLE:
+        case LOGGER_OPTION::FILE:
+        {
+            char message[128];
+            snprintf(message, sizeof(message), "min %g max %g mean %g last %g", values[0], values[1], values[2], values[3]);
+            m_sink.Write(m_option.load(memory_order_relaxed) == LOGGER_OPTION::CONSOLE ? LogSink::SINK_TARGET::CONSOLE : LogSink::SINK_TARGET::FILE,
+                         logged.group, logged.identifier, string_view(message));
+        }
+        break;
+
+        case LOGGER_OPTION::DASHBOARD:
+        {
+            logged.entry.SetDoubleArray(values);
+        }
+        break;
+
+        default:  // case LOGGER_OPTION::EAT_IT:
+            break;
+    }
+}
+
+/// @brief Find the signal for a group/identifier, registering it the first time it is seen
+/// @param [in] std::string_view: network table name or classname to group messages
+/// @param [in] std::string_view: message identifier
+/// @returns int: signal handle (index into m_signals)
+int Logger::FindSignal
+(
+    string_view     group,
+    string_view     identifier
+)
+{
+    auto groupHash = HashUtils::Hash(group);
+    auto key = HashUtils::Hash(identifier, groupHash);
+    auto it = m_signalLookup.find(key);
+    if (it != m_signalLookup.end())
+    {
+        auto& logged = m_signals[it->second];
+        if (logged.group == group && logged.identifier == identifier)
+        {
+            return it->second;
+        }
+
+        // two keys hashed to the same value (very unlikely); keep the first one in the look up table 
+        // and just append the new signal, so it is still published correctly (with a linear search)
+        for (auto inx=0U; inx<m_signals.size(); ++inx)
+        {
+            if (m_signals[inx].group == group && m_signals[inx].identifier == identifier)
+            {
+                return static_cast<int>(inx);
+            }
+        }
+    }
+
+    LoggedSignal logged;
+    logged.group.assign(group);
+    logged.identifier.assign(identifier);
+    logged.entry = nt::NetworkTableInstance::GetDefault().GetTable(group)->GetEntry(identifier);
+    logged.groupHash = groupHash;
+    logged.key = key;
+    logged.aggregate = -1;
+    m_signals.emplace_back(logged);
+
+    auto handle = static_cast<int>(m_signals.size()) - 1;
+    m_signalLookup.emplace(key, handle);    // no-op when this was a hash collision
+    return handle;
+}
+
 /// @brief Determines whether a message should be displayed or not.   For instance if EAT_IT is the logging option, this will return false or if the level is xxx_ONCE, it may return false if the message was already logged.
 /// @param [in] LOGGER_LEVEL: message level
-/// @param [in] std::string: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
-/// @param [in] std::string: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
-/// @param [in] std::string: message/value
+/// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+/// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+/// @param [in] std::string_view: message/value
 /// @returns bool: true - display the message, false - don't display the message
 bool Logger::ShouldDisplayIt
 (
     LOGGER_LEVEL    level,
-    const string&   group,
-    const string&   identifier,     
-    const string&   message                 
+    string_view     group,
+    string_view     identifier,     
+    string_view     message                 
 )
 {
-    if (m_option == LOGGER_OPTION::EAT_IT)
+    if (m_option.load(memory_order_relaxed) == LOGGER_OPTION::EAT_IT)
     {
         return false;
     }
     // If the error level is *_ONCE, display it only the first time it happens
-    if ((level == ERROR_ONCE) || (level == WARNING_ONCE) || (level == PRINT_ONCE))
+    return !IsOnceLevel(level) || m_alreadyDisplayed.Insert(HashUtils::Hash(message, HashUtils::Hash(identifier, HashUtils::Hash(group))));
+}
+
+/// @brief Determines whether a value should be displayed or not (see above).  The value's bytes are
+///        used to find duplicates, so it doesn't have to be converted to a string first.
+/// @param [in] LOGGER_LEVEL: message level
+/// @param [in] std::string_view: network table name or classname to group messages
+/// @param [in] std::string_view: message identifier
+/// @param [in] double: value (int and bool values are passed as doubles)
+/// @returns bool: true - display the value, false - don't display the value
+bool Logger::ShouldDisplayIt
+(
+    LOGGER_LEVEL    level,
+    string_view     group,
+    string_view     identifier,     
+    double          value                 
+)
+{
+    if (m_option.load(memory_order_relaxed) == LOGGER_OPTION::EAT_IT)
     {
-        string key = group + identifier + message;
-        auto it = m_alreadyDisplayed.find(key);
-        if (it == m_alreadyDisplayed.end())  // display if not already displayed
-        {
-            m_alreadyDisplayed.insert(key);     // save the key
-            return true;
-        }
         return false;
-
     }
-    return true;
+    return !IsOnceLevel(level) || m_alreadyDisplayed.Insert(HashUtils::HashValue(value, HashUtils::Hash(identifier, HashUtils::Hash(group))));
 }
 
 /// @brief Display/select logging options/levels on dashboard
@@ -250,6 +634,7 @@ void Logger::PutLoggingSelectionsOnDashboard()
     m_optionChooser.SetDefaultOption("EAT_IT", LOGGER_OPTION::EAT_IT);
     m_optionChooser.AddOption("DASHBOARD", LOGGER_OPTION::DASHBOARD);
     m_optionChooser.AddOption("CONSOLE", LOGGER_OPTION::CONSOLE);
+    m_optionChooser.AddOption("FILE", LOGGER_OPTION::FILE);
     frc::SmartDashboard::PutData("Logging Options", &m_optionChooser);
 
     // set up level menu
@@ -267,6 +652,7 @@ void Logger::PutLoggingSelectionsOnDashboard()
 /// @brief Read logging option from dashboard, but not every 20ms
 void Logger::PeriodicLog()
 {
+    lock_guard<recursive_mutex> lock(m_mutex);
     m_cyclingCounter += 1;          // count 20ms loops
     if (m_cyclingCounter >= 25)     // execute every 500ms
     {
@@ -277,10 +663,10 @@ void Logger::PeriodicLog()
         //
         LOGGER_OPTION selectedOption = m_optionChooser.GetSelected();
 
-        if (selectedOption != m_option)
+        if (selectedOption != m_option.load(memory_order_relaxed))
         {
             // re-work so we aren't writing this out every 25 loops
-            m_option = selectedOption <= LOGGER_OPTION::EAT_IT ? selectedOption : LOGGER_OPTION::EAT_IT;
+            SetLoggingOption(selectedOption <= LOGGER_OPTION::EAT_IT ? selectedOption : LOGGER_OPTION::EAT_IT);
             string optionAsString;
             switch(selectedOption)
             {
@@ -292,16 +678,20 @@ void Logger::PeriodicLog()
                     optionAsString.assign("DASHBOARD");
                     break;
 
+                case FILE:
+                    optionAsString.assign("FILE");
+                    break;
+
                 case EAT_IT:
                     optionAsString.assign("EAT_IT");
                     break;
 
                 default:
                     optionAsString.assign("Out of range !");
-                    m_option = EAT_IT;
+                    SetLoggingOption(EAT_IT);
                     break;
             }
-            LogData(LOGGER_LEVEL::PRINT, string("Logger"), string("Selected Option"), optionAsString);
+            LogData(LOGGER_LEVEL::PRINT, "Logger", "Selected Option", optionAsString);
         }
 
         //
@@ -312,7 +702,7 @@ void Logger::PeriodicLog()
         if (selectedLevel != m_level)
         {
             // re-work so we aren't writing this out every 25 loops
-            m_level = selectedLevel <= LOGGER_LEVEL::PRINT ? selectedLevel : LOGGER_LEVEL::WARNING;
+            SetLoggingLevel(selectedLevel <= LOGGER_LEVEL::PRINT ? selectedLevel : LOGGER_LEVEL::WARNING);
 
             string levelAsString;
             switch(selectedLevel)
@@ -343,10 +733,10 @@ void Logger::PeriodicLog()
 
                 default:
                     levelAsString.assign("Out of range !");
-                    m_level = WARNING;
+                    SetLoggingLevel(WARNING);
                     break;
             }
-            LogData(LOGGER_LEVEL::PRINT, string("Logger"), string("Selected Level"), levelAsString);
+            LogData(LOGGER_LEVEL::PRINT, "Logger", "Selected Level", levelAsString);
         }
     }
 }
@@ -358,7 +748,8 @@ void Logger::SetLoggingOption
     LOGGER_OPTION option    
 )
 {
-    m_option = option;
+    m_option.store(option, memory_order_relaxed);
+    UpdateEnabledSeverity();
 }
 
 /// @brief set the level for messages that will be displayed
@@ -369,14 +760,176 @@ void Logger::SetLoggingLevel
 )
 {
     m_level = level;
+    UpdateEnabledSeverity();
+}
+
+/// @brief Stop sending PRINT messages to the dashboard while the loop is overloaded (LoopWatchdog)
+/// @param [in] bool: true - only warnings and errors go to the dashboard, false - back to the selected level
+void Logger::SetDashboardSuspended
+(
+    bool            suspended
+)
+{
+    lock_guard<recursive_mutex> lock(m_mutex);
+    m_dashboardSuspended.store(suspended, memory_order_relaxed);
+    UpdateEnabledSeverity();
+}
+
+/// @brief Drop LogAggregate values while the loop is overloaded (LoopWatchdog)
+/// @param [in] bool: true - drop the values, false - aggregate them
+void Logger::SetAggregationSuspended
+(
+    bool            suspended
+)
+{
+    m_aggregationSuspended.store(suspended, memory_order_relaxed);
+}
+
+/// @brief Set the level for one group of messages; it replaces the dashboard level for that group.
+/// @param [in] std::string_view: network table name or classname used to group messages
+/// @param [in] LOGGER_LEVEL: messages at this level or worse are displayed
+void Logger::SetGroupLevel
+(
+    string_view     group,
+    LOGGER_LEVEL    level
+)
+{
+    lock_guard<recursive_mutex> lock(m_mutex);
+    auto& settings = m_groupSettings.try_emplace(HashUtils::Hash(group), GroupSettings{false, level, 0.0, 1.0}).first->second;
+    settings.hasLevel = true;
+    settings.level = level;
+    UpdateEnabledSeverity();
+}
+
+/// @brief Go back to using the dashboard level for a group
+/// @param [in] std::string_view: network table name or classname used to group messages
+void Logger::ClearGroupLevel
+(
+    string_view     group
+)
+{
+    lock_guard<recursive_mutex> lock(m_mutex);
+    auto it = m_groupSettings.find(HashUtils::Hash(group));
+    if (it != m_groupSettings.end())
+    {
+        it->second.hasLevel = false;
+        UpdateEnabledSeverity();
+    }
+}
+
+/// @brief Limit how often each identifier in a group is displayed (token bucket).  xxx_ONCE
+///        messages aren't limited.
+/// @param [in] std::string_view: network table name or classname used to group messages
+/// @param [in] double: messages per second allowed for each identifier (<= 0 removes the limit)
+/// @param [in] double: number of messages that can be displayed back to back before the limit applies
+void Logger::SetGroupRateLimit
+(
+    string_view     group,
+    double          messagesPerSecond,
+    double          burst
+)
+{
+    lock_guard<recursive_mutex> lock(m_mutex);
+    auto& settings = m_groupSettings.try_emplace(HashUtils::Hash(group), GroupSettings{false, m_level, 0.0, 1.0}).first->second;
+    settings.messagesPerSecond = messagesPerSecond;
+    settings.burst = max(burst, 1.0);
+}
+
+/// @brief Determine whether a message passes its group's level and rate limit
+/// @param [in] LOGGER_LEVEL: message level
+/// @param [in] std::string_view: network table name or classname to group messages
+/// @param [in] std::string_view: message identifier
+/// @returns bool: true - display the message, false - filtered out
+bool Logger::PassesGroupFilters
+(
+    LOGGER_LEVEL    level,
+    string_view     group,
+    string_view     identifier
+)
+{
+    if (m_groupSettings.empty())
+    {
+        return Severity(level) <= Severity(m_level);    // nothing to hash when no groups are configured
+    }
+    auto groupHash = HashUtils::Hash(group);
+    return PassesGroupFilters(level, groupHash, HashUtils::Hash(identifier, groupHash));
+}
+
+/// @brief Determine whether a message passes its group's level and rate limit
+/// @param [in] LOGGER_LEVEL: message level
+/// @param [in] uint64_t: hash of the group (HashUtils::Hash(group))
+/// @param [in] uint64_t: hash of the group and identifier (HashUtils::Hash(identifier, groupHash))
+/// @returns bool: true - display the message, false - filtered out
+bool Logger::PassesGroupFilters
+(
+    LOGGER_LEVEL    level,
+    uint64_t        groupHash,
+    uint64_t        key
+)
+{
+    auto it = m_groupSettings.find(groupHash);
+    if (it == m_groupSettings.end())
+    {
+        return Severity(level) <= Severity(m_level);
+    }
+
+    auto& settings = it->second;
+    if (Severity(level) > Severity(settings.hasLevel ? settings.level : m_level))
+    {
+        return false;
+    }
+    if (settings.messagesPerSecond <= 0.0 || IsOnceLevel(level))
+    {
+        return true;
+    }
+
+    // refill the bucket for the time since the last message, then spend a token if there is one
+    auto now = frc::RobotController::GetFPGATime();
+    auto& bucket = m_buckets.try_emplace(key, TokenBucket{settings.burst, now}).first->second;
+    bucket.tokens = min(settings.burst, bucket.tokens + static_cast<double>(now - bucket.lastTime) * 1.0E-6 * settings.messagesPerSecond);
+    bucket.lastTime = now;
+    if (bucket.tokens < 1.0)
+    {
+        return false;
+    }
+    bucket.tokens -= 1.0;
+    return true;
+}
+
+/// @brief work out the loosest level in use (dashboard or any group), so IsLoggingEnabled stays a single compare
+void Logger::UpdateEnabledSeverity()
+{
+    auto severity = Severity(m_level);
+    for (auto& group : m_groupSettings)
+    {
+        if (group.second.hasLevel)
+        {
+            severity = max(severity, Severity(group.second.level));
+        }
+    }
+    if (m_dashboardSuspended.load(memory_order_relaxed) && m_option.load(memory_order_relaxed) == LOGGER_OPTION::DASHBOARD)
+    {
+        severity = min(severity, Severity(LOGGER_LEVEL::WARNING));
+    }
+    m_enabledSeverity.store(severity, memory_order_relaxed);
 }
 
 
 Logger::Logger() : m_option( LOGGER_OPTION::EAT_IT ), 
                    m_level( LOGGER_LEVEL::PRINT ),
+                   m_enabledSeverity( Severity(LOGGER_LEVEL::PRINT) ),
                    m_alreadyDisplayed(),
                    m_cyclingCounter(0), 
                    m_optionChooser(),
-                   m_levelChooser()
+                   m_levelChooser(),
+                   m_signals(),
+                   m_signalLookup(),
+                   m_aggregates(),
+                   m_sink(),
+                   m_groupSettings(),
+                   m_buckets(),
+                   m_mutex(),
+                   m_dashboardSuspended(false),
+                   m_aggregationSuspended(false)
 {
 }
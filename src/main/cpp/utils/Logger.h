@@ -21,13 +21,22 @@
 /// File Description:
 ///     This logs error messages, and can also be used to log non-error events.
 ///
+///     It can be called from the robot loop and from the swerve control thread; the checks that
+///     throw a message away (IsLoggingEnabled) don't lock, everything after them does.
+///
 //========================================================================================================
 
 #pragma once
 
 // C++ Includes
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
 #include <string>
-#include <set>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 // FRC includes
 #include <networktables/NetworkTableInstance.h>
@@ -36,6 +45,8 @@
 #include <frc/SmartDashboard/SendableChooser.h>
 
 // Team 302 includes
+#include <utils/FingerprintSet.h>
+#include <utils/LogSink.h>
 
 
 // Third Party Includes
@@ -52,6 +63,7 @@ class Logger
         {
             CONSOLE,        ///< write to the RoboRio Console
             DASHBOARD,      ///< write to the SmartDashboard
+            FILE,           ///< write to a log file on the USB stick (or the RoboRio if there isn't one)
             EAT_IT          ///< don't write anything (useful at comps where we want to minimize network traffic)
         };
 
@@ -69,63 +81,228 @@ class Logger
             PRINT           ///< this is an information/debug message
         };
 
+        /// @brief default window for LogAggregate (seconds)
+        static constexpr double DEFAULT_AGGREGATE_WINDOW = 0.25;
+
         /// @brief Find or create the singleton logger
         /// @returns Logger* pointer to the logger
         static Logger* GetLogger();
 
+        /// @brief Determine whether messages of a level are built into this program.  Competition
+        ///        builds (gradle -PcompetitionBuild defines LOGGER_STRIP_PRINT) remove the PRINT levels,
+        ///        so a guarded block of PRINT messages is removed by the compiler.
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @returns bool: true - messages of this level can be logged, false - they are compiled out
+        static constexpr bool IsLevelCompiledIn
+        (
+            [[maybe_unused]] LOGGER_LEVEL   level
+        )
+        {
+#ifdef LOGGER_STRIP_PRINT
+            return level != LOGGER_LEVEL::PRINT_ONCE && level != LOGGER_LEVEL::PRINT;
+#else
+            return true;
+#endif
+        }
+
+        /// @brief Cheap check that can be done before building any of the values for a message.  Code that 
+        ///        runs every loop should wrap its logging in this check, so nothing is calculated, 
+        ///        converted or allocated when the message won't go anywhere.
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @returns bool: true - a message at this level may be displayed (by at least one group), false - it will be thrown away
+        inline bool IsLoggingEnabled
+        (
+            LOGGER_LEVEL            level
+        ) const
+        {
+            return IsLevelCompiledIn(level) &&
+                   m_option.load(std::memory_order_relaxed) != LOGGER_OPTION::EAT_IT &&
+                   Severity(level) <= m_enabledSeverity.load(std::memory_order_relaxed);
+        }
+
+        /// @brief Set the level for one group of messages; it replaces the dashboard level for that group.
+        ///        For example "Swerve Chassis" at WARNING and "DragonLimelight" at PRINT.
+        /// @param [in] std::string_view: network table name or classname used to group messages
+        /// @param [in] LOGGER_LEVEL: messages at this level or worse are displayed
+        void SetGroupLevel
+        (
+            std::string_view        group,
+            LOGGER_LEVEL            level
+        );
+
+        /// @brief Go back to using the dashboard level for a group
+        /// @param [in] std::string_view: network table name or classname used to group messages
+        void ClearGroupLevel
+        (
+            std::string_view        group
+        );
+
+        /// @brief Stop sending PRINT messages to the dashboard while the loop is overloaded (LoopWatchdog)
+        /// @param [in] bool: true - only warnings and errors go to the dashboard, false - back to the selected level
+        void SetDashboardSuspended
+        (
+            bool                    suspended
+        );
+
+        /// @brief Drop LogAggregate values while the loop is overloaded (LoopWatchdog)
+        /// @param [in] bool: true - drop the values, false - aggregate them
+        void SetAggregationSuspended
+        (
+            bool                    suspended
+        );
+
+        /// @brief Limit how often each identifier in a group is displayed (token bucket).  xxx_ONCE
+        ///        messages aren't limited.
+        /// @param [in] std::string_view: network table name or classname used to group messages
+        /// @param [in] double: messages per second allowed for each identifier (<= 0 removes the limit)
+        /// @param [in] double: number of messages that can be displayed back to back before the limit applies
+        void SetGroupRateLimit
+        (
+            std::string_view        group,
+            double                  messagesPerSecond,
+            double                  burst = 1.0
+        );
+
 
         /// @brief log a message
         /// @param [in] LOGGER_LEVEL: message level
-        /// @param [in] std::string: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
-        /// @param [in] std::string: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
-        /// @param [in] std::string: message - text of the message       
+        /// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+        /// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+        /// @param [in] std::string_view: message - text of the message       
+        void LogData
+        (
+            LOGGER_LEVEL            level,
+            std::string_view        group,
+            std::string_view        identifier,     
+            std::string_view        message                 
+        );
+
+        /// @brief log a message (string literals would otherwise be converted to bool)
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+        /// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+        /// @param [in] const char*: message - text of the message       
         void LogData
         (
             LOGGER_LEVEL            level,
-            const std::string&      group,
-            const std::string&      identifier,     
-            const std::string&      message                 
+            std::string_view        group,
+            std::string_view        identifier,     
+            const char*             message                 
         );
 
         /// @brief log a message
         /// @param [in] LOGGER_LEVEL: message level
-        /// @param [in] std::string: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
-        /// @param [in] std::string: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+        /// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+        /// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
         /// @param [in] double: value to display       
         void LogData
         (
             LOGGER_LEVEL            level,
-            const std::string&      group,
-            const std::string&      identifier,     
+            std::string_view        group,
+            std::string_view        identifier,     
             double                  value                 
         );
 
 
         /// @brief log a message
         /// @param [in] LOGGER_LEVEL: message level
-        /// @param [in] std::string: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
-        /// @param [in] std::string: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+        /// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+        /// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
         /// @param [in] bool: value to display       
         void LogData
         (
             LOGGER_LEVEL            level,   
-            const std::string&      group,
-            const std::string&      identifier,     
+            std::string_view        group,
+            std::string_view        identifier,     
             bool                    value                 
         );
 
         /// @brief log a message
         /// @param [in] LOGGER_LEVEL: message level
-        /// @param [in] std::string: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
-        /// @param [in] std::string: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+        /// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+        /// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
         /// @param [in] int: value to display       
         void LogData
         (
             LOGGER_LEVEL            level,   
-            const std::string&      group,
-            const std::string&      identifier,     
+            std::string_view        group,
+            std::string_view        identifier,     
             int                     value                 
         );
+
+        /// @brief Register a value that is logged every loop.  The group and identifier are resolved to a 
+        ///        network table entry once, so logging with the returned handle doesn't do any string look ups.
+        ///        Registering the same group/identifier again returns the same handle.
+        /// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+        /// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+        /// @returns int: handle to pass to LogSignal
+        int RegisterSignal
+        (
+            std::string_view        group,
+            std::string_view        identifier
+        );
+
+        /// @brief log a value for a signal from RegisterSignal (bool values are sent as 0/1)
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @param [in] int: signal handle from RegisterSignal
+        /// @param [in] double: value to display       
+        void LogSignal
+        (
+            LOGGER_LEVEL            level,
+            int                     signal,
+            double                  value
+        );
+
+        /// @brief log a message for a signal from RegisterSignal
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @param [in] int: signal handle from RegisterSignal
+        /// @param [in] std::string_view: message - text of the message       
+        void LogSignal
+        (
+            LOGGER_LEVEL            level,
+            int                     signal,
+            std::string_view        message
+        );
+
+        /// @brief Register a value that changes faster than the dashboard can show it (motor speeds,
+        ///        accelerations).  Instead of every value, the min, max, mean and last value over each
+        ///        window are published once per window, so spikes between refreshes aren't lost.  On the
+        ///        dashboard the entry is a number array [min, max, mean, last].
+        /// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+        /// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+        /// @param [in] double: window length (seconds)
+        /// @returns int: handle to pass to LogAggregate
+        int RegisterAggregate
+        (
+            std::string_view        group,
+            std::string_view        identifier,
+            double                  windowSeconds = DEFAULT_AGGREGATE_WINDOW
+        );
+
+        /// @brief add a value to an aggregate from RegisterAggregate; it is published when its window is over
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @param [in] int: aggregate handle from RegisterAggregate
+        /// @param [in] double: value
+        void LogAggregate
+        (
+            LOGGER_LEVEL            level,
+            int                     aggregate,
+            double                  value
+        );
+
+        /// @brief add a value to an aggregate, registering it (with the default window) the first time it is seen
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+        /// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+        /// @param [in] double: value
+        void LogAggregate
+        (
+            LOGGER_LEVEL            level,
+            std::string_view        group,
+            std::string_view        identifier,
+            double                  value
+        );
+
         /// @brief Display logging options on dashboard
         void PutLoggingSelectionsOnDashboard();
 
@@ -137,19 +314,86 @@ class Logger
 
 
     private:
+        friend class LoggerTest;
+
         /// @brief Determines whether a message should be displayed or not.   For instance if EAT_IT is the logging option, this will return false or if the level is xxx_ONCE, it may return false if the message was already logged.
         /// @param [in] LOGGER_LEVEL: message level
-        /// @param [in] std::string: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
-        /// @param [in] std::string: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
-        /// @param [in] std::string: message/value
+        /// @param [in] std::string_view: network table name or classname to group messages.  If logging option is DASHBOARD, this will be the network table name
+        /// @param [in] std::string_view: message identifier: within a grouping multiple messages may be displayed this is the prefix/look up key
+        /// @param [in] std::string_view: message/value
         /// @returns bool: true - display the message, false - don't display the message
         bool ShouldDisplayIt
         (
             LOGGER_LEVEL            level,
-            const std::string&      group,
-            const std::string&      identifier,     
-            const std::string&      message  
+            std::string_view        group,
+            std::string_view        identifier,     
+            std::string_view        message  
+        );
+
+        /// @brief Determines whether a value should be displayed or not (see above).  The value's bytes are
+        ///        used to find duplicates, so it doesn't have to be converted to a string first.
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @param [in] std::string_view: network table name or classname to group messages
+        /// @param [in] std::string_view: message identifier
+        /// @param [in] double: value (int and bool values are passed as doubles)
+        /// @returns bool: true - display the value, false - don't display the value
+        bool ShouldDisplayIt
+        (
+            LOGGER_LEVEL            level,
+            std::string_view        group,
+            std::string_view        identifier,     
+            double                  value  
         );
+
+        /// @brief Determine whether a message passes its group's level and rate limit
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @param [in] uint64_t: hash of the group (HashUtils::Hash(group))
+        /// @param [in] uint64_t: hash of the group and identifier (HashUtils::Hash(identifier, groupHash))
+        /// @returns bool: true - display the message, false - filtered out
+        bool PassesGroupFilters
+        (
+            LOGGER_LEVEL            level,
+            uint64_t                groupHash,
+            uint64_t                key
+        );
+
+        /// @brief Determine whether a message passes its group's level and rate limit
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @param [in] std::string_view: network table name or classname to group messages
+        /// @param [in] std::string_view: message identifier
+        /// @returns bool: true - display the message, false - filtered out
+        bool PassesGroupFilters
+        (
+            LOGGER_LEVEL            level,
+            std::string_view        group,
+            std::string_view        identifier
+        );
+
+        /// @brief work out the loosest level in use (dashboard or any group), so IsLoggingEnabled stays a single compare
+        void UpdateEnabledSeverity();
+
+        /// @brief How bad a level is; a level and its xxx_ONCE version are the same (ERROR_ONCE and ERROR are 0)
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @returns int: 0 errors, 1 warnings, 2 prints
+        static constexpr int Severity
+        (
+            LOGGER_LEVEL            level
+        )
+        {
+            return (level == LOGGER_LEVEL::ERROR_ONCE || level == LOGGER_LEVEL::ERROR) ? 0 :
+                   (level == LOGGER_LEVEL::WARNING_ONCE || level == LOGGER_LEVEL::WARNING) ? 1 : 2;
+        }
+
+        /// @brief Is this one of the xxx_ONCE levels that need the message text to filter duplicates
+        /// @param [in] LOGGER_LEVEL: message level
+        /// @returns bool: true - xxx_ONCE level, false - display every time
+        static constexpr bool IsOnceLevel
+        (
+            LOGGER_LEVEL            level
+        )
+        {
+            return level == LOGGER_LEVEL::ERROR_ONCE || level == LOGGER_LEVEL::WARNING_ONCE || level == LOGGER_LEVEL::PRINT_ONCE;
+        }
         
         /// @brief set the option for where the logging messages should be displayed
         /// @param [in] LOGGER_OPTION:  logging option for where to log messages
@@ -166,16 +410,90 @@ class Logger
         );
 
 
+        /// @brief Find the signal for a group/identifier, registering it the first time it is seen
+        /// @param [in] std::string_view: network table name or classname to group messages
+        /// @param [in] std::string_view: message identifier
+        /// @returns int: signal handle (index into m_signals)
+        int FindSignal
+        (
+            std::string_view        group,
+            std::string_view        identifier
+        );
+
+        /// @struct LoggedSignal
+        /// @brief  group/identifier with its resolved network table entry
+        struct LoggedSignal
+        {
+            std::string             group;
+            std::string             identifier;
+            nt::NetworkTableEntry   entry;
+            uint64_t                groupHash;
+            uint64_t                key;                // hash of group and identifier
+            int                     aggregate;          // index into m_aggregates (-1 if it isn't aggregated)
+        };
+
+        /// @struct AggregatedSignal
+        /// @brief  values logged for a signal during the current window
+        struct AggregatedSignal
+        {
+            int                     signal;             // index into m_signals
+            uint64_t                window;             // microseconds
+            uint64_t                windowStart;        // FPGA time (microseconds) of the first value in the window
+            LOGGER_LEVEL            level;              // level of the last value
+            int                     count;
+            double                  minimum;
+            double                  maximum;
+            double                  total;
+            double                  last;
+        };
+
+        /// @brief Publish an aggregate's window
+        /// @param [in] AggregatedSignal&: aggregate
+        void PublishAggregate
+        (
+            const AggregatedSignal& aggregate
+        );
+
+        /// @struct GroupSettings
+        /// @brief  level and rate limit for a group of messages
+        struct GroupSettings
+        {
+            bool                    hasLevel;
+            LOGGER_LEVEL            level;
+            double                  messagesPerSecond;  // <= 0 means no limit
+            double                  burst;
+        };
+
+        /// @struct TokenBucket
+        /// @brief  rate limit state for one group/identifier
+        struct TokenBucket
+        {
+            double                  tokens;
+            uint64_t                lastTime;           // FPGA time (microseconds) tokens was updated
+        };
+
         Logger();
         ~Logger() = default;
 
-        LOGGER_OPTION                           m_option;               // indicates where the message should go
+        // m_option, m_enabledSeverity and the suspended flags are read without the lock by IsLoggingEnabled
+        // (from the control, odometry and worker threads), so they are atomic; the rest is only used under m_mutex
+        std::atomic<LOGGER_OPTION>              m_option;               // indicates where the message should go
         LOGGER_LEVEL                            m_level;                // the level at which a message is important enough to send
-        std::set<std::string>                   m_alreadyDisplayed;
+        std::atomic<int>                        m_enabledSeverity;      // loosest Severity of m_level and the group levels
+        FingerprintSet                          m_alreadyDisplayed;     // fingerprints of xxx_ONCE messages already displayed
         static Logger*                          m_instance;
         int                                     m_cyclingCounter;       // count 20ms loops
         frc::SendableChooser<LOGGER_OPTION>     m_optionChooser;
         frc::SendableChooser<LOGGER_LEVEL>      m_levelChooser;
+        std::vector<LoggedSignal>               m_signals;              // signals indexed by handle
+        std::unordered_map<uint64_t, int>       m_signalLookup;         // hash of group/identifier to signal handle
+        std::vector<AggregatedSignal>           m_aggregates;           // aggregates indexed by handle
+        LogSink                                 m_sink;                 // console/file output is written by a background thread
+        std::unordered_map<uint64_t, GroupSettings> m_groupSettings;    // hash of group to its level/rate limit
+        std::unordered_map<uint64_t, TokenBucket>   m_buckets;          // hash of group/identifier to its rate limit state
+        std::recursive_mutex                    m_mutex;                // LogAggregate/LogData call back into the public methods
+        std::atomic<bool>                       m_dashboardSuspended;   // LoopWatchdog is shedding dashboard PRINT messages
+        std::atomic<bool>                       m_aggregationSuspended; // LoopWatchdog is shedding LogAggregate
 };
 
 
@@ -0,0 +1,156 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// LoopProfiler.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Measures where the 20 ms loop goes and publishes p50/p99/max per zone
+///
+//========================================================================================================
+
+// C++ Includes
+#include <string>
+#include <string_view>
+
+// FRC includes
+#include <frc/RobotController.h>
+#include <networktables/NetworkTable.h>
+#include <networktables/NetworkTableEntry.h>
+#include <networktables/NetworkTableInstance.h>
+
+// Team 302 includes
+#include <utils/LoopProfiler.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    constexpr const char* TABLE_NAME = "Loop Profiler";
+}
+
+/// @brief Find or create the loop profiler
+/// @returns LoopProfiler* pointer to the profiler
+LoopProfiler* LoopProfiler::m_instance = nullptr;
+LoopProfiler* LoopProfiler::GetInstance()
+{
+    if ( LoopProfiler::m_instance == nullptr )
+    {
+        LoopProfiler::m_instance = new LoopProfiler();
+    }
+    return LoopProfiler::m_instance;
+}
+
+LoopProfiler::LoopProfiler() : m_zones(),
+                               m_enabled(true),
+                               m_enabledEntry(),
+                               m_lastPublish(0)
+{
+    m_enabledEntry = nt::NetworkTableInstance::GetDefault().GetTable(TABLE_NAME)->GetEntry("enabled");
+    m_enabledEntry.SetDefaultBoolean(m_enabled);
+    m_zones.reserve(32);
+}
+
+/// @brief Add a zone; registering the same name again returns the same zone
+/// @param [in] std::string_view: zone name (e.g. "Robot::TeleopPeriodic")
+/// @returns int: handle to pass to ProfileScope / Record
+int LoopProfiler::RegisterZone
+(
+    string_view     name
+)
+{
+    for (auto inx=0U; inx<m_zones.size(); ++inx)
+    {
+        if (m_zones[inx].name == name)
+        {
+            return static_cast<int>(inx);
+        }
+    }
+
+    auto table = nt::NetworkTableInstance::GetDefault().GetTable(TABLE_NAME);
+    Zone zone;
+    zone.name.assign(name);
+    zone.p50 = table->GetEntry(zone.name + " p50 (ms)");
+    zone.p99 = table->GetEntry(zone.name + " p99 (ms)");
+    zone.max = table->GetEntry(zone.name + " max (ms)");
+    zone.count = table->GetEntry(zone.name + " count");
+    zone.alwaysMeasured = false;
+    zone.loopTime = 0;
+    m_zones.emplace_back(zone);
+    return static_cast<int>(m_zones.size()) - 1;
+}
+
+/// @brief Measure a zone even when profiling is disabled (LoopWatchdog budgets)
+/// @param [in] int: handle from RegisterZone
+void LoopProfiler::SetAlwaysMeasured
+(
+    int             zone
+)
+{
+    if (zone >= 0 && zone < static_cast<int>(m_zones.size()))
+    {
+        m_zones[zone].alwaysMeasured = true;
+    }
+}
+
+/// @param [in] int: handle from RegisterZone
+/// @returns const std::string&: zone name (empty for an unknown handle)
+const string& LoopProfiler::GetZoneName
+(
+    int             zone
+) const
+{
+    static const string unknown;
+    return (zone >= 0 && zone < static_cast<int>(m_zones.size())) ? m_zones[zone].name : unknown;
+}
+
+/// @brief Start a new loop for GetLoopTime (LoopWatchdog::BeginLoop calls this)
+void LoopProfiler::StartLoop()
+{
+    for (auto& zone : m_zones)
+    {
+        zone.loopTime = 0;
+    }
+}
+
+/// @brief Publish the zones every PUBLISH_PERIOD and check whether profiling is enabled (call once per loop)
+void LoopProfiler::PeriodicPublish()
+{
+    auto now = frc::RobotController::GetFPGATime();
+    if (now - m_lastPublish < PUBLISH_PERIOD)
+    {
+        return;
+    }
+    m_lastPublish = now;
+
+    for (auto& zone : m_zones)
+    {
+        auto& histogram = zone.histogram;
+        if (m_enabled)
+        {
+            zone.p50.SetDouble(static_cast<double>(histogram.GetPercentile(0.50)) / 1000.0);
+            zone.p99.SetDouble(static_cast<double>(histogram.GetPercentile(0.99)) / 1000.0);
+            zone.max.SetDouble(static_cast<double>(histogram.GetMax()) / 1000.0);
+            zone.count.SetDouble(static_cast<double>(histogram.GetCount()));
+        }
+        histogram.Reset();
+    }
+    m_enabled = m_enabledEntry.GetBoolean(true);
+}
@@ -0,0 +1,199 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// LoopProfiler.h
+//========================================================================================================
+///
+/// File Description:
+///     Measures where the 20 ms loop goes.  Code that runs every loop is wrapped in a zone:
+///
+///         // constructor / Init
+///         m_profileZone = LoopProfiler::GetInstance()->RegisterZone("SwerveChassis::Drive");
+///
+///         // every loop
+///         ProfileScope scope(m_profileZone);
+///
+///     Each zone keeps a histogram of its durations (FPGA time).  Once a second the p50, p99 and
+///     max (ms) and the number of calls are published to the "Loop Profiler" network table and the
+///     histograms start over.  Setting "Loop Profiler/enabled" to false on the dashboard turns the
+///     zones into a single bool check.
+///
+///     Zones are only recorded and published on the robot loop's thread, or by a StateMgrScheduler
+///     worker while the robot loop waits for it (each zone is only recorded by one thread at a time).
+///
+///     Zones with a LoopWatchdog budget are always measured (even when profiling is disabled) and
+///     also keep their total for the current loop (GetLoopTime).
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// FRC includes
+#include <frc/RobotController.h>
+#include <networktables/NetworkTableEntry.h>
+
+// Team 302 includes
+#include <utils/LatencyHistogram.h>
+
+// Third Party Includes
+
+
+class LoopProfiler
+{
+    public:
+
+        /// @brief Find or create the loop profiler
+        /// @returns LoopProfiler* pointer to the profiler
+        static LoopProfiler* GetInstance();
+
+        /// @brief Add a zone; registering the same name again returns the same zone
+        /// @param [in] std::string_view: zone name (e.g. "Robot::TeleopPeriodic")
+        /// @returns int: handle to pass to ProfileScope / Record
+        int RegisterZone
+        (
+            std::string_view        name
+        );
+
+        /// @returns bool: true - zones are being measured
+        inline bool IsEnabled() const { return m_enabled; }
+
+        /// @param [in] int: handle from RegisterZone
+        /// @returns bool: true - the zone is being measured (profiling is enabled or the zone has a budget)
+        inline bool IsMeasured
+        (
+            int                     zone
+        ) const
+        {
+            return m_enabled || (zone >= 0 && zone < static_cast<int>(m_zones.size()) && m_zones[zone].alwaysMeasured);
+        }
+
+        /// @brief Measure a zone even when profiling is disabled (LoopWatchdog budgets)
+        /// @param [in] int: handle from RegisterZone
+        void SetAlwaysMeasured
+        (
+            int                     zone
+        );
+
+        /// @brief Add a duration to a zone
+        /// @param [in] int: handle from RegisterZone
+        /// @param [in] uint64_t: duration (microseconds)
+        inline void Record
+        (
+            int                     zone,
+            uint64_t                micros
+        )
+        {
+            if (zone >= 0 && zone < static_cast<int>(m_zones.size()))
+            {
+                auto& entry = m_zones[zone];
+                entry.loopTime += micros;
+                if (m_enabled)
+                {
+                    entry.histogram.Record(micros);
+                }
+            }
+        }
+
+        /// @param [in] int: handle from RegisterZone
+        /// @returns uint64_t: time (microseconds) recorded in the zone since StartLoop
+        inline uint64_t GetLoopTime
+        (
+            int                     zone
+        ) const
+        {
+            return (zone >= 0 && zone < static_cast<int>(m_zones.size())) ? m_zones[zone].loopTime : 0;
+        }
+
+        /// @param [in] int: handle from RegisterZone
+        /// @returns const std::string&: zone name (empty for an unknown handle)
+        const std::string& GetZoneName
+        (
+            int                     zone
+        ) const;
+
+        /// @brief Start a new loop for GetLoopTime (LoopWatchdog::BeginLoop calls this)
+        void StartLoop();
+
+        /// @brief Publish the zones every PUBLISH_PERIOD and check whether profiling is enabled (call once per loop)
+        void PeriodicPublish();
+
+    private:
+        LoopProfiler();
+        ~LoopProfiler() = default;
+
+        static constexpr uint64_t PUBLISH_PERIOD = 1000000;    // microseconds
+
+        /// @struct Zone
+        /// @brief  histogram for one zone and the network table entries it is published to
+        struct Zone
+        {
+            std::string             name;
+            LatencyHistogram        histogram;
+            nt::NetworkTableEntry   p50;
+            nt::NetworkTableEntry   p99;
+            nt::NetworkTableEntry   max;
+            nt::NetworkTableEntry   count;
+            bool                    alwaysMeasured;     // has a LoopWatchdog budget
+            uint64_t                loopTime;           // microseconds since StartLoop
+        };
+
+        static LoopProfiler*        m_instance;
+
+        std::vector<Zone>           m_zones;
+        bool                        m_enabled;
+        nt::NetworkTableEntry       m_enabledEntry;
+        uint64_t                    m_lastPublish;          // FPGA time (microseconds)
+};
+
+
+/// @class ProfileScope
+/// @brief Measures from construction to the end of the scope and records the time in a zone.
+///        When the zone isn't being measured, the FPGA time isn't read.
+class ProfileScope
+{
+    public:
+        /// @param [in] int: handle from LoopProfiler::RegisterZone
+        explicit ProfileScope
+        (
+            int                     zone
+        ) : m_zone(zone),
+            m_start(LoopProfiler::GetInstance()->IsMeasured(zone) ? frc::RobotController::GetFPGATime() : 0)
+        {
+        }
+
+        ~ProfileScope()
+        {
+            if (m_start != 0)
+            {
+                LoopProfiler::GetInstance()->Record(m_zone, frc::RobotController::GetFPGATime() - m_start);
+            }
+        }
+
+        ProfileScope(const ProfileScope&) = delete;
+        ProfileScope& operator=(const ProfileScope&) = delete;
+
+    private:
+        int                         m_zone;
+        uint64_t                    m_start;                // FPGA time (microseconds); 0 when the zone isn't measured
+};
@@ -0,0 +1,236 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// LoopWatchdog.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Checks the subsystem time budgets and sheds optional work when the loop gets close to overrunning
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <string>
+
+// FRC includes
+#include <frc/RobotController.h>
+#include <networktables/NetworkTable.h>
+#include <networktables/NetworkTableEntry.h>
+#include <networktables/NetworkTableInstance.h>
+
+// Team 302 includes
+#include <utils/Logger.h>
+#include <utils/LoopProfiler.h>
+#include <utils/LoopWatchdog.h>
+
+// Third Party Includes
+
+using namespace std;
+
+namespace
+{
+    constexpr const char* TABLE_NAME = "Loop Watchdog";
+}
+
+/// @brief Find or create the loop watchdog
+/// @returns LoopWatchdog* pointer to the watchdog
+LoopWatchdog* LoopWatchdog::m_instance = nullptr;
+LoopWatchdog* LoopWatchdog::GetInstance()
+{
+    if ( LoopWatchdog::m_instance == nullptr )
+    {
+        LoopWatchdog::m_instance = new LoopWatchdog();
+    }
+    return LoopWatchdog::m_instance;
+}
+
+LoopWatchdog::LoopWatchdog() : m_budgets(),
+                               m_shedThreshold(17000),
+                               m_recoverThreshold(12000),
+                               m_level(SHED_LEVEL::NONE),
+                               m_loopStart(0),
+                               m_loopCount(0),
+                               m_loopsSinceChange(0),
+                               m_quietLoops(0),
+                               m_maxLoopTime(0),
+                               m_lastPublish(0),
+                               m_exceeded(),
+                               m_levelEntry(),
+                               m_maxLoopEntry()
+{
+    auto table = nt::NetworkTableInstance::GetDefault().GetTable(TABLE_NAME);
+    m_levelEntry = table->GetEntry("shed level");
+    m_maxLoopEntry = table->GetEntry("max loop time (ms)");
+    m_levelEntry.SetString(GetLevelName(m_level));
+}
+
+/// @brief Give a LoopProfiler zone a time budget (setting it again changes the budget)
+/// @param [in] int: handle from LoopProfiler::RegisterZone
+/// @param [in] double: budget per loop (milliseconds)
+void LoopWatchdog::SetBudget
+(
+    int             zone,
+    double          budgetMs
+)
+{
+    auto profiler = LoopProfiler::GetInstance();
+    if (profiler->GetZoneName(zone).empty() || budgetMs <= 0.0)
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, "LoopWatchdog", "SetBudget", "invalid zone or budget");
+        return;
+    }
+
+    auto budget = static_cast<uint64_t>(budgetMs * 1000.0);
+    for (auto& existing : m_budgets)
+    {
+        if (existing.zone == zone)
+        {
+            existing.budget = budget;
+            return;
+        }
+    }
+
+    profiler->SetAlwaysMeasured(zone);
+    auto entry = nt::NetworkTableInstance::GetDefault().GetTable(TABLE_NAME)->GetEntry(profiler->GetZoneName(zone) + " exceeded");
+    m_budgets.emplace_back(Budget{zone, budget, 0, entry});
+}
+
+/// @brief Set when work is shed and restored
+/// @param [in] double: loop time (milliseconds) above which the next level is shed
+/// @param [in] double: loop time (milliseconds) below which a level is restored (after RECOVER_LOOPS loops)
+void LoopWatchdog::SetThresholds
+(
+    double          shedMs,
+    double          recoverMs
+)
+{
+    m_shedThreshold = static_cast<uint64_t>(max(shedMs, 0.0) * 1000.0);
+    m_recoverThreshold = static_cast<uint64_t>(max(min(recoverMs, shedMs), 0.0) * 1000.0);
+}
+
+/// @brief Start timing a loop (start of the mode's periodic method)
+void LoopWatchdog::BeginLoop()
+{
+    m_loopStart = frc::RobotController::GetFPGATime();
+    LoopProfiler::GetInstance()->StartLoop();
+}
+
+/// @brief Finish timing a loop, check the budgets and update the shed level (end of RobotPeriodic)
+void LoopWatchdog::EndLoop()
+{
+    auto now = frc::RobotController::GetFPGATime();
+    if (m_loopStart == 0)
+    {
+        return;
+    }
+    auto loopTime = now - m_loopStart;
+    m_loopStart = 0;
+    ++m_loopCount;
+    ++m_loopsSinceChange;
+    m_maxLoopTime = max(m_maxLoopTime, loopTime);
+
+    auto profiler = LoopProfiler::GetInstance();
+    m_exceeded.clear();
+    for (auto& budget : m_budgets)
+    {
+        if (profiler->GetLoopTime(budget.zone) > budget.budget)
+        {
+            ++budget.exceeded;
+            m_exceeded += m_exceeded.empty() ? "" : ", ";
+            m_exceeded += profiler->GetZoneName(budget.zone);
+        }
+    }
+
+    if (loopTime > m_shedThreshold)
+    {
+        m_quietLoops = 0;
+        if (m_level < SHED_LEVEL::IDLE_MECHANISMS && m_loopsSinceChange >= SHED_HOLD_LOOPS)
+        {
+            m_level = static_cast<SHED_LEVEL>(m_level + 1);
+            m_loopsSinceChange = 0;
+            ApplyLevel();
+            string msg = string("shedding ") + GetLevelName(m_level) + " (loop " + to_string(loopTime / 1000) + " ms";
+            msg += m_exceeded.empty() ? string(")") : "; over budget: " + m_exceeded + ")";
+            Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::WARNING, "LoopWatchdog", "shed level", msg);
+        }
+    }
+    else if (loopTime < m_recoverThreshold && m_level > SHED_LEVEL::NONE)
+    {
+        if (++m_quietLoops >= RECOVER_LOOPS)
+        {
+            m_level = static_cast<SHED_LEVEL>(m_level - 1);
+            m_loopsSinceChange = 0;
+            m_quietLoops = 0;
+            ApplyLevel();
+        }
+    }
+    else
+    {
+        m_quietLoops = 0;
+    }
+
+    if (now - m_lastPublish >= PUBLISH_PERIOD)
+    {
+        m_lastPublish = now;
+        m_levelEntry.SetString(GetLevelName(m_level));
+        m_maxLoopEntry.SetDouble(static_cast<double>(m_maxLoopTime) / 1000.0);
+        m_maxLoopTime = 0;
+        for (auto& budget : m_budgets)
+        {
+            budget.entry.SetDouble(budget.exceeded);
+        }
+    }
+}
+
+/// @brief tell the Logger what it should skip
+void LoopWatchdog::ApplyLevel()
+{
+    auto logger = Logger::GetLogger();
+    logger->SetDashboardSuspended(IsShedding(SHED_LEVEL::DASHBOARD_LOGGING));
+    logger->SetAggregationSuspended(IsShedding(SHED_LEVEL::LOGGER_AGGREGATION));
+    m_levelEntry.SetString(GetLevelName(m_level));
+}
+
+/// @brief name of a level for the dashboard and log
+const char* LoopWatchdog::GetLevelName
+(
+    SHED_LEVEL      level
+)
+{
+    switch (level)
+    {
+        case SHED_LEVEL::NONE:
+            return "none";
+
+        case SHED_LEVEL::DASHBOARD_LOGGING:
+            return "dashboard logging";
+
+        case SHED_LEVEL::LOGGER_AGGREGATION:
+            return "logger aggregation";
+
+        case SHED_LEVEL::VISION:
+            return "vision";
+
+        case SHED_LEVEL::IDLE_MECHANISMS:
+            return "idle mechanisms";
+
+        default:
+            return "unknown";
+    }
+}
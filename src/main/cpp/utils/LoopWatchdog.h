@@ -0,0 +1,178 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// LoopWatchdog.h
+//========================================================================================================
+///
+/// File Description:
+///     Keeps the 20 ms loop from overrunning.  Each subsystem's LoopProfiler zone can have a time
+///     budget; the watchdog counts the loops where a zone went over its budget.  When the whole loop
+///     gets close to the period, optional work is shed one level at a time:
+///
+///         DASHBOARD_LOGGING       Logger sends only errors to the dashboard
+///         LOGGER_AGGREGATION      Logger::LogAggregate values are dropped
+///         VISION                  the limelight is read every VISION_DIVISOR loops
+///         IDLE_MECHANISMS         idle mechanisms (e.g. the climber when it is off) run IDLE_DIVISOR times less
+///                                 often than their StateMgrScheduler rate
+///
+///     Each level includes the ones before it.  The level goes up (at most once every SHED_HOLD_LOOPS
+///     loops, so the last level has time to help) when a loop takes longer than the shed threshold.  It
+///     goes down one level after RECOVER_LOOPS loops in a row shorter than the recover threshold.
+///
+///     The level, the longest loop and the number of loops each budget was exceeded are published
+///     to the "Loop Watchdog" network table once a second.
+///
+///     BeginLoop goes at the start of each mode's periodic method and EndLoop at the end of
+///     RobotPeriodic (which runs after them).  Robot loop thread only.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// FRC includes
+#include <networktables/NetworkTableEntry.h>
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+class LoopWatchdog
+{
+    public:
+
+        /// @enum SHED_LEVEL
+        /// @brief optional work that is shed, in the order it is shed
+        enum SHED_LEVEL
+        {
+            NONE,
+            DASHBOARD_LOGGING,
+            LOGGER_AGGREGATION,
+            VISION,
+            IDLE_MECHANISMS,
+            MAX_SHED_LEVEL
+        };
+
+        static constexpr int VISION_DIVISOR = 5;       // loops per limelight read when VISION is shed
+        static constexpr int IDLE_DIVISOR = 5;         // idle mechanism rate divisor when IDLE_MECHANISMS is shed
+
+        /// @brief Find or create the loop watchdog
+        /// @returns LoopWatchdog* pointer to the watchdog
+        static LoopWatchdog* GetInstance();
+
+        /// @brief Give a LoopProfiler zone a time budget (setting it again changes the budget)
+        /// @param [in] int: handle from LoopProfiler::RegisterZone
+        /// @param [in] double: budget per loop (milliseconds)
+        void SetBudget
+        (
+            int                     zone,
+            double                  budgetMs
+        );
+
+        /// @brief Set when work is shed and restored
+        /// @param [in] double: loop time (milliseconds) above which the next level is shed
+        /// @param [in] double: loop time (milliseconds) below which a level is restored (after RECOVER_LOOPS loops)
+        void SetThresholds
+        (
+            double                  shedMs,
+            double                  recoverMs
+        );
+
+        /// @brief Start timing a loop (start of the mode's periodic method)
+        void BeginLoop();
+
+        /// @brief Finish timing a loop, check the budgets and update the shed level (end of RobotPeriodic)
+        void EndLoop();
+
+        /// @returns SHED_LEVEL: current level
+        inline SHED_LEVEL GetShedLevel() const { return m_level; }
+
+        /// @returns uint64_t: loops finished so far (changes once a loop, in EndLoop)
+        inline uint64_t GetLoopCount() const { return m_loopCount; }
+
+        /// @param [in] SHED_LEVEL: level to check
+        /// @returns bool: true - the work at this level is being shed
+        inline bool IsShedding
+        (
+            SHED_LEVEL              level
+        ) const
+        {
+            return level != SHED_LEVEL::NONE && m_level >= level;
+        }
+
+        /// @brief Should reduced rate work run this loop
+        /// @param [in] SHED_LEVEL: level the work is shed at
+        /// @param [in] int: loops per run while it is shed
+        /// @returns bool: true - run it this loop
+        inline bool ShouldRun
+        (
+            SHED_LEVEL              level,
+            int                     divisor
+        ) const
+        {
+            return !IsShedding(level) || divisor <= 1 || (m_loopCount % static_cast<uint64_t>(divisor)) == 0;
+        }
+
+    private:
+        LoopWatchdog();
+        ~LoopWatchdog() = default;
+
+        /// @brief tell the Logger what it should skip
+        void ApplyLevel();
+
+        /// @brief name of a level for the dashboard and log
+        static const char* GetLevelName
+        (
+            SHED_LEVEL              level
+        );
+
+        static constexpr int        SHED_HOLD_LOOPS = 5;
+        static constexpr int        RECOVER_LOOPS = 50;
+        static constexpr uint64_t   PUBLISH_PERIOD = 1000000;  // microseconds
+
+        /// @struct Budget
+        /// @brief  time budget for one zone
+        struct Budget
+        {
+            int                     zone;
+            uint64_t                budget;             // microseconds
+            int                     exceeded;           // loops over budget since the watchdog started
+            nt::NetworkTableEntry   entry;
+        };
+
+        static LoopWatchdog*        m_instance;
+
+        std::vector<Budget>         m_budgets;
+        uint64_t                    m_shedThreshold;        // microseconds
+        uint64_t                    m_recoverThreshold;     // microseconds
+        SHED_LEVEL                  m_level;
+        uint64_t                    m_loopStart;            // FPGA time (microseconds); 0 - BeginLoop hasn't been called
+        uint64_t                    m_loopCount;
+        int                         m_loopsSinceChange;
+        int                         m_quietLoops;           // loops in a row below the recover threshold
+        uint64_t                    m_maxLoopTime;          // microseconds since the last publish
+        uint64_t                    m_lastPublish;          // FPGA time (microseconds)
+        std::string                 m_exceeded;             // zones over budget in the current loop
+        nt::NetworkTableEntry       m_levelEntry;
+        nt::NetworkTableEntry       m_maxLoopEntry;
+};
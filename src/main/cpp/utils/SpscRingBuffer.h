@@ -0,0 +1,113 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+///	 @class SpscRingBuffer
+///  @brief	Fixed size, lock-free queue for exactly one producer thread and one consumer thread.
+///         Neither side ever blocks or allocates:  TryPush fails when the buffer is full and
+///         TryPop fails when it is empty.
+///  @tparam T         item type (copied in and out)
+///  @tparam CAPACITY  number of slots; must be a power of 2
+template<typename T, size_t CAPACITY>
+class SpscRingBuffer
+{
+	static_assert( CAPACITY >= 2 && (CAPACITY & (CAPACITY-1)) == 0, "CAPACITY must be a power of 2" );
+
+	public:
+		SpscRingBuffer() : m_slots(), m_head(0), m_tail(0)
+		{
+		}
+		~SpscRingBuffer() = default;
+
+		SpscRingBuffer( const SpscRingBuffer& ) = delete;
+		SpscRingBuffer& operator=( const SpscRingBuffer& ) = delete;
+
+		/// @brief Add an item (producer thread only)
+		/// @param [in] const T& item: item to copy into the buffer
+		/// @return bool true - item was added, false - buffer was full
+		bool TryPush( const T& item )
+		{
+			auto head = m_head.load( std::memory_order_relaxed );
+			if ( head - m_tail.load( std::memory_order_acquire ) >= CAPACITY )
+			{
+				return false;
+			}
+			m_slots[head & MASK] = item;
+			m_head.store( head+1, std::memory_order_release );
+			return true;
+		}
+
+		/// @brief Reserve the next slot so the producer can fill it in place instead of copying
+		///        a whole item.  The item isn't visible to the consumer until Commit is called.
+		/// @return T* slot to fill or nullptr if the buffer is full
+		T* Claim()
+		{
+			auto head = m_head.load( std::memory_order_relaxed );
+			if ( head - m_tail.load( std::memory_order_acquire ) >= CAPACITY )
+			{
+				return nullptr;
+			}
+			return &m_slots[head & MASK];
+		}
+
+		/// @brief Publish the slot returned by the last successful Claim (producer thread only)
+		void Commit()
+		{
+			m_head.store( m_head.load( std::memory_order_relaxed )+1, std::memory_order_release );
+		}
+
+		/// @brief Remove the oldest item (consumer thread only)
+		/// @param [out] T& item: item that was removed
+		/// @return bool true - item was removed, false - buffer was empty
+		bool TryPop( T& item )
+		{
+			auto tail = m_tail.load( std::memory_order_relaxed );
+			if ( tail == m_head.load( std::memory_order_acquire ) )
+			{
+				return false;
+			}
+			item = m_slots[tail & MASK];
+			m_tail.store( tail+1, std::memory_order_release );
+			return true;
+		}
+
+		/// @brief Determine if there is anything to pop (approximate when called from the producer)
+		/// @return bool true - empty, false - there are items
+		bool IsEmpty() const
+		{
+			return m_tail.load( std::memory_order_acquire ) == m_head.load( std::memory_order_acquire );
+		}
+
+	private:
+		static constexpr size_t MASK = CAPACITY - 1;
+
+		std::array<T, CAPACITY>		m_slots;
+		alignas(64) std::atomic<size_t>	m_head;		// next slot to write (only changed by the producer)
+		alignas(64) std::atomic<size_t>	m_tail;		// next slot to read (only changed by the consumer)
+};
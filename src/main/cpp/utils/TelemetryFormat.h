@@ -0,0 +1,65 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+///	 @class TelemetryFormat
+///  @brief	Layout of the telemetry files written by TelemetryRecorder.  This header doesn't use any
+///         FRC headers, so the desktop reader (tools/telemetry) includes it too.
+///
+///         All values are little endian (RoboRio and desktop PCs).  The file is append only:
+///
+///         header:     char[8]  FILE_MAGIC
+///                     uint16_t VERSION
+///                     uint16_t signal count
+///                     for each signal:  uint8_t SIGNAL_TYPE, uint16_t name length, char name[length]
+///
+///         block:      uint32_t BLOCK_MAGIC
+///                     uint32_t row count
+///                     uint64_t timestamps[row count]          (FPGA time in microseconds)
+///                     for each signal:  double values[row count]
+///
+///         Blocks repeat until the end of the file; a partial block at the end (power was cut
+///         while writing) is ignored by the reader.
+class TelemetryFormat
+{
+	public:
+		TelemetryFormat() = delete;
+		~TelemetryFormat() = delete;
+
+		/// @enum SIGNAL_TYPE
+		/// @brief How a signal's values should be displayed (they are all stored as doubles)
+		enum SIGNAL_TYPE : uint8_t
+		{
+			DOUBLE,
+			INT,
+			BOOL
+		};
+
+		static constexpr char		FILE_MAGIC[8] = { 'T', '3', '0', '2', 'T', 'L', 'M', '1' };
+		static constexpr uint16_t	VERSION = 1;
+		static constexpr uint32_t	BLOCK_MAGIC = 0x314B4C42;	// "BLK1"
+};
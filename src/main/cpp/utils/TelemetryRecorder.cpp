@@ -0,0 +1,276 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// TelemetryRecorder.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Records registered signals every robot loop into a binary, column oriented file
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#ifdef __linux__
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+// FRC includes
+#include <frc/DriverStation.h>
+#include <frc/RobotController.h>
+
+// Team 302 includes
+#include <utils/LogSink.h>
+#include <utils/Logger.h>
+#include <utils/TelemetryFormat.h>
+#include <utils/TelemetryRecorder.h>
+
+// Third Party Includes
+
+using namespace std;
+
+/// @brief Find or create the telemetry recorder
+/// @returns TelemetryRecorder* pointer to the recorder
+TelemetryRecorder* TelemetryRecorder::m_instance = nullptr;
+TelemetryRecorder* TelemetryRecorder::GetInstance()
+{
+    if ( TelemetryRecorder::m_instance == nullptr )
+    {
+        TelemetryRecorder::m_instance = new TelemetryRecorder();
+    }
+    return TelemetryRecorder::m_instance;
+}
+
+TelemetryRecorder::TelemetryRecorder() : m_names(),
+                                         m_types(),
+                                         m_latest(),
+                                         m_signalCount(0),
+                                         m_started(false),
+                                         m_recordWhenDisabled(false),
+                                         m_blocks(),
+                                         m_filling(0),
+                                         m_pending(NO_BLOCK),
+                                         m_droppedBlocks(0),
+                                         m_running(false),
+                                         m_wakeMutex(),
+                                         m_wake(),
+                                         m_writer(),
+                                         m_file()
+{
+}
+
+/// @brief Add a signal to the recording.  Signals have to be registered before Start is called.
+/// @param [in] std::string_view: signal name (e.g. "Swerve Chassis/pose x")
+/// @param [in] TelemetryFormat::SIGNAL_TYPE: how the values should be displayed
+/// @returns int: handle to pass to Record or -1 if recording already started
+int TelemetryRecorder::RegisterSignal
+(
+    string_view                     name,
+    TelemetryFormat::SIGNAL_TYPE    type
+)
+{
+    if (m_started)
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, "TelemetryRecorder", name, "registered after Start; not recorded");
+        return -1;
+    }
+
+    m_names.emplace_back(name);
+    m_types.emplace_back(type);
+    m_latest.emplace_back(0.0);
+    m_signalCount = static_cast<int>(m_latest.size());
+    return m_signalCount - 1;
+}
+
+/// @brief Freeze the signal list, allocate the blocks and start the writer thread (call at the end of RobotInit)
+void TelemetryRecorder::Start()
+{
+    if (m_started)
+    {
+        return;
+    }
+    m_started = true;
+
+    for (auto& block : m_blocks)
+    {
+        block.timestamps.resize(ROWS_PER_BLOCK);
+        block.values.resize(static_cast<size_t>(m_signalCount) * ROWS_PER_BLOCK);
+        block.rows = 0;
+    }
+
+    auto name = LogSink::GetLogDirectory() + "/telemetry_" + to_string(frc::RobotController::GetFPGATime()) + ".t302";
+    m_file.open(name, ios::out | ios::binary | ios::trunc);
+    if (!m_file.is_open())
+    {
+        Logger::GetLogger()->LogData(Logger::LOGGER_LEVEL::ERROR_ONCE, "TelemetryRecorder", "Start", "couldn't open " + name);
+        return;
+    }
+
+    // header
+    auto count = static_cast<uint16_t>(m_signalCount);
+    m_file.write(TelemetryFormat::FILE_MAGIC, sizeof(TelemetryFormat::FILE_MAGIC));
+    m_file.write(reinterpret_cast<const char*>(&TelemetryFormat::VERSION), sizeof(TelemetryFormat::VERSION));
+    m_file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+    for (auto inx=0; inx<m_signalCount; ++inx)
+    {
+        auto length = static_cast<uint16_t>(min(m_names[inx].size(), static_cast<size_t>(UINT16_MAX)));
+        m_file.write(reinterpret_cast<const char*>(&m_types[inx]), sizeof(m_types[inx]));
+        m_file.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        m_file.write(m_names[inx].data(), length);
+    }
+    m_file.flush();
+
+    m_running.store(true, memory_order_release);
+    m_writer = thread(&TelemetryRecorder::WriterLoop, this);
+}
+
+TelemetryRecorder::~TelemetryRecorder()
+{
+    Stop();
+}
+
+/// @brief Flush and stop the writer thread once it has written everything
+void TelemetryRecorder::Stop()
+{
+    if (!m_writer.joinable())
+    {
+        return;
+    }
+    Flush();
+    {
+        lock_guard<mutex> lock(m_wakeMutex);
+        m_running.store(false, memory_order_release);
+    }
+    m_wake.notify_all();
+    m_writer.join();
+}
+
+/// @brief Add a row with the current FPGA time and the latest values (call once per loop)
+void TelemetryRecorder::EndCycle()
+{
+    if (!m_running.load(memory_order_relaxed) || (!m_recordWhenDisabled && frc::DriverStation::IsDisabled()))
+    {
+        return;
+    }
+
+    auto& block = m_blocks[m_filling];
+    auto row = block.rows;
+    block.timestamps[row] = frc::RobotController::GetFPGATime();
+    auto column = block.values.data() + row;
+    for (auto inx=0; inx<m_signalCount; ++inx, column += ROWS_PER_BLOCK)
+    {
+        *column = m_latest[inx].load(memory_order_relaxed);
+    }
+    block.rows = row + 1;
+
+    if (block.rows >= ROWS_PER_BLOCK)
+    {
+        HandOff(true);
+    }
+}
+
+/// @brief Hand the partially filled block to the writer (e.g. when the robot is disabled)
+void TelemetryRecorder::Flush()
+{
+    if (!m_running.load(memory_order_relaxed) || m_blocks[m_filling].rows == 0)
+    {
+        return;
+    }
+    {
+        unique_lock<mutex> lock(m_wakeMutex);
+        m_wake.wait_for(lock, FLUSH_TIMEOUT, [this] { return m_pending.load(memory_order_acquire) == NO_BLOCK; });
+    }
+    HandOff(false);
+}
+
+/// @brief give the block being filled to the writer and start filling the other one
+/// @param [in] bool: true - if the writer is busy drop the block, false - keep filling it
+void TelemetryRecorder::HandOff
+(
+    bool        dropIfBusy
+)
+{
+    if (m_pending.load(memory_order_acquire) != NO_BLOCK)
+    {
+        if (dropIfBusy)
+        {
+            m_blocks[m_filling].rows = 0;
+            m_droppedBlocks.fetch_add(1, memory_order_relaxed);
+        }
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(m_wakeMutex);
+        m_pending.store(m_filling, memory_order_release);
+    }
+    m_wake.notify_all();
+    m_filling = 1 - m_filling;
+    m_blocks[m_filling].rows = 0;
+}
+
+/// @brief writer thread: write blocks as they are handed off
+void TelemetryRecorder::WriterLoop()
+{
+#ifdef __linux__
+    // run below the robot threads (nice 10), so writing never competes with the robot loop
+    setpriority(PRIO_PROCESS, static_cast<id_t>(syscall(SYS_gettid)), 10);
+#endif
+
+    while (true)
+    {
+        int pending = NO_BLOCK;
+        {
+            unique_lock<mutex> lock(m_wakeMutex);
+            m_wake.wait(lock, [this] { return m_pending.load(memory_order_acquire) != NO_BLOCK || !m_running.load(memory_order_acquire); });
+            pending = m_pending.load(memory_order_acquire);
+        }
+        if (pending == NO_BLOCK)
+        {
+            break;      // Stop, and everything has been written
+        }
+
+        auto& block = m_blocks[pending];
+        auto rows = block.rows;
+        m_file.write(reinterpret_cast<const char*>(&TelemetryFormat::BLOCK_MAGIC), sizeof(TelemetryFormat::BLOCK_MAGIC));
+        m_file.write(reinterpret_cast<const char*>(&rows), sizeof(rows));
+        m_file.write(reinterpret_cast<const char*>(block.timestamps.data()), rows * sizeof(uint64_t));
+        auto column = block.values.data();
+        for (auto inx=0; inx<m_signalCount; ++inx, column += ROWS_PER_BLOCK)
+        {
+            m_file.write(reinterpret_cast<const char*>(column), rows * sizeof(double));
+        }
+        m_file.flush();
+
+        {
+            lock_guard<mutex> lock(m_wakeMutex);
+            m_pending.store(NO_BLOCK, memory_order_release);
+        }
+        m_wake.notify_all();        // Flush may be waiting for the writer
+    }
+    m_file.close();
+}
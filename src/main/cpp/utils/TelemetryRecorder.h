@@ -0,0 +1,169 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// TelemetryRecorder.h
+//========================================================================================================
+///
+/// File Description:
+///     Records registered signals every robot loop into a binary, column oriented file (see
+///     TelemetryFormat.h) so matches can be looked at afterwards without the dashboard connected.
+///     tools/telemetry has the desktop reader and a CSV converter.
+///
+///     Usage:
+///         - RegisterSignal during construction/RobotInit (the file header is frozen by Start)
+///         - Record(handle, value) whenever the value is known; it is just a store
+///         - EndCycle once per loop copies the latest values into the current block (only while the
+///           robot is enabled, unless SetRecordWhenDisabled is used)
+///         - Flush when the robot is disabled, Stop when the program ends
+///     Full blocks are handed to a low priority writer thread (double buffered), which sleeps on a
+///     condition variable until there is one; if the writer is still busy with the other block, the
+///     new block is dropped instead of waiting.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/TelemetryFormat.h>
+
+// Third Party Includes
+
+
+class TelemetryRecorder
+{
+    public:
+
+        /// @brief Find or create the telemetry recorder
+        /// @returns TelemetryRecorder* pointer to the recorder
+        static TelemetryRecorder* GetInstance();
+
+        /// @brief Add a signal to the recording.  Signals have to be registered before Start is called.
+        /// @param [in] std::string_view: signal name (e.g. "Swerve Chassis/pose x")
+        /// @param [in] TelemetryFormat::SIGNAL_TYPE: how the values should be displayed
+        /// @returns int: handle to pass to Record or -1 if recording already started
+        int RegisterSignal
+        (
+            std::string_view                name,
+            TelemetryFormat::SIGNAL_TYPE    type = TelemetryFormat::SIGNAL_TYPE::DOUBLE
+        );
+
+        /// @brief Save the latest value of a signal; it is written out at the next EndCycle.
+        ///        Signals that aren't recorded in a loop keep their last value.  Safe to call from
+        ///        any thread (e.g. the motor control thread).
+        /// @param [in] int: handle from RegisterSignal
+        /// @param [in] double: value
+        inline void Record
+        (
+            int                             signal,
+            double                          value
+        )
+        {
+            if (signal >= 0 && signal < m_signalCount)
+            {
+                m_latest[signal].store(value, std::memory_order_relaxed);
+            }
+        }
+
+        /// @brief Freeze the signal list, allocate the blocks and start the writer thread (call at the end of RobotInit)
+        void Start();
+
+        /// @brief Add a row with the current FPGA time and the latest values (call once per loop).  Nothing
+        ///        is added while the robot is disabled, unless SetRecordWhenDisabled(true) was called.
+        void EndCycle();
+
+        /// @brief Hand the partially filled block to the writer (e.g. when the robot is disabled).  If the
+        ///        writer is still busy with the other block, this waits for it (up to FLUSH_TIMEOUT).
+        void Flush();
+
+        /// @brief Flush and stop the writer thread once it has written everything
+        void Stop();
+
+        /// @param [in] bool: true - record every loop, false - only record while the robot is enabled
+        void SetRecordWhenDisabled
+        (
+            bool                            record
+        )
+        {
+            m_recordWhenDisabled = record;
+        }
+
+        /// @brief Number of blocks thrown away because the writer thread couldn't keep up
+        /// @returns uint64_t number of dropped blocks
+        uint64_t GetDroppedBlocks() const { return m_droppedBlocks.load(std::memory_order_relaxed); }
+
+    private:
+        TelemetryRecorder();
+        ~TelemetryRecorder();
+
+        /// @brief give the block being filled to the writer and start filling the other one
+        /// @param [in] bool: true - if the writer is busy drop the block, false - keep filling it
+        void HandOff
+        (
+            bool                            dropIfBusy
+        );
+
+        /// @brief writer thread: write blocks as they are handed off
+        void WriterLoop();
+
+        static constexpr uint32_t ROWS_PER_BLOCK = 250;      // 5 seconds at 50 Hz
+        static constexpr int      NO_BLOCK = -1;
+        static constexpr auto     FLUSH_TIMEOUT = std::chrono::milliseconds(100);
+
+        /// @struct Block
+        /// @brief  rows of data stored by column (signal), so each column is written with one call
+        struct Block
+        {
+            std::vector<uint64_t>   timestamps;
+            std::vector<double>     values;             // signal * ROWS_PER_BLOCK + row
+            uint32_t                rows;
+        };
+
+        static TelemetryRecorder*           m_instance;
+
+        std::vector<std::string>            m_names;
+        std::vector<uint8_t>                m_types;
+        std::deque<std::atomic<double>>     m_latest;           // last recorded value for each signal (deque: atomics can't be moved when it grows)
+        int                                 m_signalCount;
+        bool                                m_started;
+        bool                                m_recordWhenDisabled;
+
+        std::array<Block, 2>                m_blocks;
+        int                                 m_filling;          // block the robot loop is filling
+        std::atomic<int>                    m_pending;          // block waiting for the writer (NO_BLOCK when the writer is idle)
+        std::atomic<uint64_t>               m_droppedBlocks;
+        std::atomic<bool>                   m_running;          // false - the writer finishes the pending block and exits
+        std::mutex                          m_wakeMutex;
+        std::condition_variable             m_wake;             // a block was handed off, the writer finished one or Stop
+        std::thread                         m_writer;
+        std::ofstream                       m_file;             // only used by the writer thread
+};
@@ -0,0 +1,182 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// WorkerPool.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Fixed set of threads for fork/join work inside the robot loop
+///
+//========================================================================================================
+
+// C++ Includes
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#ifdef __linux__
+#include <pthread.h>
+#endif
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/WorkerPool.h>
+
+// Third Party Includes
+
+using namespace std;
+
+/// @brief Start the workers
+/// @param [in] int: number of worker threads (the calling thread also runs tasks)
+/// @param [in] const std::string&: thread name (shows up in top / ps)
+WorkerPool::WorkerPool
+(
+    int                     threads,
+    const string&           name
+) : m_threads(),
+    m_name(name),
+    m_mutex(),
+    m_workReady(),
+    m_workDone(),
+    m_task(nullptr),
+    m_count(0),
+    m_next(0),
+    m_done(0),
+    m_active(0),
+    m_generation(0),
+    m_stopping(false)
+{
+    for (auto inx=0; inx<threads; ++inx)
+    {
+        m_threads.emplace_back(&WorkerPool::WorkerLoop, this);
+    }
+}
+
+/// @brief Stop and join the workers
+WorkerPool::~WorkerPool()
+{
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_workReady.notify_all();
+    for (auto& worker : m_threads)
+    {
+        worker.join();
+    }
+}
+
+/// @brief Run task(0) ... task(count - 1) on the workers and this thread
+/// @param [in] size_t: number of tasks
+/// @param [in] const std::function<void(size_t)>&: task (called with the task index)
+void WorkerPool::ParallelFor
+(
+    size_t                                  count,
+    const function<void(size_t)>&           task
+)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    if (m_threads.empty() || count == 1)
+    {
+        for (size_t inx=0; inx<count; ++inx)
+        {
+            task(inx);
+        }
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(m_mutex);
+        m_task = &task;
+        m_count = count;
+        m_next.store(0, memory_order_relaxed);
+        m_done = 0;
+        ++m_generation;
+    }
+    m_workReady.notify_all();
+
+    auto ran = RunTasks(task, count);
+
+    // a worker that is still running a task has to finish before the task goes out of scope
+    unique_lock<mutex> lock(m_mutex);
+    m_done += ran;
+    m_workDone.wait(lock, [this] { return m_done == m_count && m_active == 0; });
+    m_task = nullptr;
+}
+
+/// @brief worker thread: wait for work, run tasks, repeat
+void WorkerPool::WorkerLoop()
+{
+#ifdef __linux__
+    pthread_setname_np(pthread_self(), m_name.substr(0, 15).c_str());
+#endif
+
+    uint64_t generation = 0;
+    unique_lock<mutex> lock(m_mutex);
+    while (true)
+    {
+        m_workReady.wait(lock, [this, generation] { return m_stopping || m_generation != generation; });
+        if (m_stopping)
+        {
+            return;
+        }
+        generation = m_generation;
+
+        // the call may already be finished if this worker woke up late
+        if (m_task == nullptr || m_done == m_count)
+        {
+            continue;
+        }
+        auto task = m_task;
+        auto count = m_count;
+        ++m_active;
+        lock.unlock();
+
+        auto ran = RunTasks(*task, count);
+
+        lock.lock();
+        m_done += ran;
+        --m_active;
+        if (m_done == m_count && m_active == 0)
+        {
+            m_workDone.notify_one();
+        }
+    }
+}
+
+/// @brief run tasks until there are none left
+/// @returns size_t: number of tasks run
+size_t WorkerPool::RunTasks
+(
+    const function<void(size_t)>&           task,
+    size_t                                  count
+)
+{
+    size_t ran = 0;
+    for (auto inx = m_next.fetch_add(1, memory_order_relaxed); inx < count; inx = m_next.fetch_add(1, memory_order_relaxed))
+    {
+        task(inx);
+        ++ran;
+    }
+    return ran;
+}
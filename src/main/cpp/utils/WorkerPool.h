@@ -0,0 +1,107 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+
+//========================================================================================================
+/// WorkerPool.h
+//========================================================================================================
+///
+/// File Description:
+///     A small, fixed set of threads for fork/join work inside the robot loop (the roboRIO has two
+///     cores, so one worker plus the calling thread uses both).
+///
+///         pool.ParallelFor(count, [&](size_t inx) { ... });
+///
+///     ParallelFor hands out the indexes to the workers and the calling thread and returns when
+///     every one has finished, so the caller can use the results right away.  The workers sleep
+///     between calls.  One ParallelFor at a time (robot loop thread).
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// FRC includes
+
+// Team 302 includes
+
+// Third Party Includes
+
+
+class WorkerPool
+{
+    public:
+        /// @brief Start the workers
+        /// @param [in] int: number of worker threads (the calling thread also runs tasks)
+        /// @param [in] const std::string&: thread name (shows up in top / ps)
+        WorkerPool
+        (
+            int                     threads,
+            const std::string&      name
+        );
+
+        /// @brief Stop and join the workers
+        ~WorkerPool();
+
+        WorkerPool( const WorkerPool& ) = delete;
+        WorkerPool& operator=( const WorkerPool& ) = delete;
+
+        /// @returns int: number of worker threads
+        inline int GetThreadCount() const { return static_cast<int>(m_threads.size()); }
+
+        /// @brief Run task(0) ... task(count - 1) on the workers and this thread
+        /// @param [in] size_t: number of tasks
+        /// @param [in] const std::function<void(size_t)>&: task (called with the task index)
+        void ParallelFor
+        (
+            size_t                                  count,
+            const std::function<void(size_t)>&      task
+        );
+
+    private:
+        /// @brief worker thread: wait for work, run tasks, repeat
+        void WorkerLoop();
+
+        /// @brief run tasks until there are none left
+        /// @returns size_t: number of tasks run
+        size_t RunTasks
+        (
+            const std::function<void(size_t)>&      task,
+            size_t                                  count
+        );
+
+        std::vector<std::thread>                    m_threads;
+        std::string                                 m_name;
+        std::mutex                                  m_mutex;
+        std::condition_variable                     m_workReady;
+        std::condition_variable                     m_workDone;
+        const std::function<void(size_t)>*          m_task;         // current ParallelFor task (nullptr - none)
+        size_t                                      m_count;
+        std::atomic<size_t>                         m_next;         // next task index to hand out
+        size_t                                      m_done;         // tasks finished
+        int                                         m_active;       // workers inside RunTasks
+        uint64_t                                    m_generation;   // ParallelFor calls
+        bool                                        m_stopping;
+};
@@ -0,0 +1,168 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// File Description:
+/// Tests for the CurrentGovernor's scales, driven with made up power distribution snapshots.
+//========================================================================================================
+
+// C++ Includes
+#include <cmath>
+#include <initializer_list>
+#include <utility>
+
+// FRC includes
+
+// Team 302 includes
+#include <hw/CurrentGovernor.h>
+#include <hw/PowerMonitor.h>
+#include <hw/usages/MotorControllerUsage.h>
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+
+class CurrentGovernorTest : public ::testing::Test
+{
+    protected:
+        static constexpr int DRIVE_CHANNELS = 4;
+        static constexpr int SHOOTER_CHANNEL = 8;
+        static constexpr int CLIMBER_CHANNEL = 11;
+
+        void SetUp() override
+        {
+            // a new governor each test, so the scales don't carry over
+            m_governor = new CurrentGovernor();
+            for ( auto channel=0; channel<DRIVE_CHANNELS; ++channel )
+            {
+                m_governor->Register( MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SWERVE_DRIVE, channel );
+            }
+            m_governor->Register( MotorControllerUsage::MOTOR_CONTROLLER_USAGE::SHOOTER, SHOOTER_CHANNEL );
+            m_governor->Register( MotorControllerUsage::MOTOR_CONTROLLER_USAGE::CLIMBER_LIFT, CLIMBER_CHANNEL );
+        }
+
+        void TearDown() override
+        {
+            delete m_governor;
+        }
+
+        /// @brief build a snapshot; the total current includes current that isn't on a governed channel
+        PowerSnapshot Snapshot
+        (
+            double                                              voltage,
+            double                                              totalCurrent,
+            std::initializer_list<std::pair<int, double>>       currents
+        ) const
+        {
+            PowerSnapshot snapshot {};
+            snapshot.channels = PowerSnapshot::MAX_CHANNELS;
+            for ( auto& current : currents )
+            {
+                snapshot.currents[current.first] = current.second;
+            }
+            snapshot.totalCurrent = totalCurrent;
+            snapshot.voltage = voltage;
+            return snapshot;
+        }
+
+        void ExpectValidScales() const
+        {
+            for ( auto priority=0; priority<CurrentGovernor::PRIORITY::MAX_PRIORITIES; ++priority )
+            {
+                auto scale = m_governor->GetScale( static_cast<CurrentGovernor::PRIORITY>(priority) );
+                EXPECT_TRUE( std::isfinite( scale ) ) << "priority " << priority;
+                EXPECT_GE( scale, CurrentGovernor::MIN_SCALE ) << "priority " << priority;
+                EXPECT_LE( scale, 1.0 ) << "priority " << priority;
+            }
+        }
+
+        CurrentGovernor*    m_governor;
+};
+
+TEST_F( CurrentGovernorTest, NoSagLeavesEverythingAtFullOutput )
+{
+    m_governor->Update( Snapshot( 12.0, 60.0, { {0, 10.0}, {1, 10.0}, {SHOOTER_CHANNEL, 30.0} } ) );
+    ExpectValidScales();
+    EXPECT_DOUBLE_EQ( m_governor->GetScale( CurrentGovernor::PRIORITY::DRIVE ), 1.0 );
+    EXPECT_DOUBLE_EQ( m_governor->GetScale( CurrentGovernor::PRIORITY::SHOOTER ), 1.0 );
+    EXPECT_DOUBLE_EQ( m_governor->GetScale( CurrentGovernor::PRIORITY::CLIMBER ), 1.0 );
+}
+
+TEST_F( CurrentGovernorTest, LowVoltageWithIdleDriveStaysFinite )
+{
+    // sagging below the target voltage at low current leaves no budget; the drive draws nothing,
+    // so there is nothing to divide its share by
+    for ( auto loop=0; loop<4; ++loop )
+    {
+        m_governor->Update( Snapshot( 7.0, 12.0, { {SHOOTER_CHANNEL, 5.0} } ) );
+        ExpectValidScales();
+    }
+    EXPECT_DOUBLE_EQ( m_governor->GetScale( CurrentGovernor::PRIORITY::DRIVE ), 1.0 );
+}
+
+TEST_F( CurrentGovernorTest, LowestPriorityIsScaledFirst )
+{
+    // 200 A at 7.0 V leaves room for the drive and shooter but only part of the climber
+    m_governor->Update( Snapshot( 7.0, 200.0, { {0, 25.0}, {1, 25.0}, {2, 25.0}, {3, 25.0},
+                                                {SHOOTER_CHANNEL, 60.0}, {CLIMBER_CHANNEL, 40.0} } ) );
+    ExpectValidScales();
+    EXPECT_DOUBLE_EQ( m_governor->GetScale( CurrentGovernor::PRIORITY::DRIVE ), 1.0 );
+    EXPECT_DOUBLE_EQ( m_governor->GetScale( CurrentGovernor::PRIORITY::SHOOTER ), 1.0 );
+    EXPECT_LT( m_governor->GetScale( CurrentGovernor::PRIORITY::CLIMBER ), 1.0 );
+}
+
+TEST_F( CurrentGovernorTest, ScalesRecoverGradually )
+{
+    m_governor->Update( Snapshot( 7.0, 200.0, { {0, 25.0}, {1, 25.0}, {2, 25.0}, {3, 25.0},
+                                                {SHOOTER_CHANNEL, 60.0}, {CLIMBER_CHANNEL, 40.0} } ) );
+    auto scaled = m_governor->GetScale( CurrentGovernor::PRIORITY::CLIMBER );
+    ASSERT_LT( scaled, 1.0 );
+
+    m_governor->Update( Snapshot( 12.5, 5.0, {} ) );
+    auto recovering = m_governor->GetScale( CurrentGovernor::PRIORITY::CLIMBER );
+    EXPECT_GT( recovering, scaled );
+    EXPECT_LT( recovering, 1.0 );
+
+    for ( auto loop=0; loop<50; ++loop )
+    {
+        m_governor->Update( Snapshot( 12.5, 5.0, {} ) );
+    }
+    EXPECT_DOUBLE_EQ( m_governor->GetScale( CurrentGovernor::PRIORITY::CLIMBER ), 1.0 );
+}
+
+TEST_F( CurrentGovernorTest, UngovernedIsNeverScaled )
+{
+    m_governor->Update( Snapshot( 6.5, 250.0, { {0, 50.0}, {SHOOTER_CHANNEL, 80.0}, {CLIMBER_CHANNEL, 40.0} } ) );
+    EXPECT_DOUBLE_EQ( m_governor->GetScale( CurrentGovernor::PRIORITY::UNGOVERNED ), 1.0 );
+}
+
+TEST_F( CurrentGovernorTest, PeakScaleIsQuantized )
+{
+    EXPECT_DOUBLE_EQ( m_governor->GetPeakScale( CurrentGovernor::PRIORITY::CLIMBER ), 1.0 );
+
+    m_governor->Update( Snapshot( 7.0, 200.0, { {0, 25.0}, {1, 25.0}, {2, 25.0}, {3, 25.0},
+                                                {SHOOTER_CHANNEL, 60.0}, {CLIMBER_CHANNEL, 40.0} } ) );
+    auto scale = m_governor->GetScale( CurrentGovernor::PRIORITY::CLIMBER );
+    auto peak  = m_governor->GetPeakScale( CurrentGovernor::PRIORITY::CLIMBER );
+    EXPECT_LE( peak, scale );
+    EXPECT_GT( peak, scale - CurrentGovernor::PEAK_SCALE_STEP );
+
+    // a recovery step moves the peak scale by one step at most
+    m_governor->Update( Snapshot( 12.5, 5.0, {} ) );
+    auto recovered = m_governor->GetPeakScale( CurrentGovernor::PRIORITY::CLIMBER );
+    EXPECT_GE( recovered, peak );
+    EXPECT_LE( recovered, peak + CurrentGovernor::PEAK_SCALE_STEP );
+}
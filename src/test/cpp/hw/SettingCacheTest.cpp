@@ -0,0 +1,60 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// File Description:
+/// Tests for SettingCache, which drops motor controller setting writes that wouldn't change anything.
+//========================================================================================================
+
+// C++ Includes
+
+// FRC includes
+
+// Team 302 includes
+#include <hw/SettingCache.h>
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+
+TEST( SettingCacheTest, RepeatedWriteIsDropped )
+{
+    SettingCache settings;
+    EXPECT_TRUE( settings.ShouldWrite( SettingCache::SETTING::INVERTED, 1.0 ) );
+    EXPECT_FALSE( settings.ShouldWrite( SettingCache::SETTING::INVERTED, 1.0 ) );
+    EXPECT_TRUE( settings.ShouldWrite( SettingCache::SETTING::INVERTED, 0.0 ) );
+    EXPECT_EQ( settings.GetSuppressed(), 1U );
+}
+
+TEST( SettingCacheTest, FullPeakScaleIsSentAfterRestart )
+{
+    // a restart during a brownout leaves the scaled peak output in the controller, so the first
+    // SetPeakScale(1.0) has to be sent even though 1.0 is the configured value
+    SettingCache settings;
+    EXPECT_TRUE( settings.ShouldWrite( SettingCache::SETTING::PEAK_SCALE, 1.0 ) );
+    EXPECT_FALSE( settings.ShouldWrite( SettingCache::SETTING::PEAK_SCALE, 1.0 ) );
+    EXPECT_TRUE( settings.ShouldWrite( SettingCache::SETTING::PEAK_SCALE, 0.5 ) );
+}
+
+TEST( SettingCacheTest, RememberedValueIsNotWrittenAgain )
+{
+    // SetControlConstants sends the configured peak output, which resets the scale to 1.0
+    SettingCache settings;
+    settings.ShouldWrite( SettingCache::SETTING::PEAK_SCALE, 0.5 );
+    settings.Remember( SettingCache::SETTING::PEAK_SCALE, 1.0 );
+    EXPECT_FALSE( settings.ShouldWrite( SettingCache::SETTING::PEAK_SCALE, 1.0 ) );
+    EXPECT_TRUE( settings.ShouldWrite( SettingCache::SETTING::PEAK_SCALE, 0.5 ) );
+}
@@ -0,0 +1,93 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// File Description:
+/// Tests for FingerprintSet, the open addressing set the Logger uses to remember xxx_ONCE messages.
+//========================================================================================================
+
+// C++ Includes
+#include <cstdint>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/FingerprintSet.h>
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+
+TEST( FingerprintSetTest, InsertReportsFirstTimeOnly )
+{
+    FingerprintSet set;
+    EXPECT_TRUE( set.Insert( 42 ) );
+    EXPECT_FALSE( set.Insert( 42 ) );
+    EXPECT_EQ( set.Size(), 1U );
+}
+
+TEST( FingerprintSetTest, ContainsFindsInsertedKeys )
+{
+    FingerprintSet set;
+    EXPECT_FALSE( set.Contains( 7 ) );
+    set.Insert( 7 );
+    set.Insert( 9 );
+    EXPECT_TRUE( set.Contains( 7 ) );
+    EXPECT_TRUE( set.Contains( 9 ) );
+    EXPECT_FALSE( set.Contains( 8 ) );
+}
+
+TEST( FingerprintSetTest, ZeroIsTreatedAsOne )
+{
+    // 0 marks an empty slot, so it is folded into 1
+    FingerprintSet set;
+    EXPECT_TRUE( set.Insert( 0 ) );
+    EXPECT_FALSE( set.Insert( 1 ) );
+    EXPECT_TRUE( set.Contains( 0 ) );
+    EXPECT_TRUE( set.Contains( 1 ) );
+}
+
+TEST( FingerprintSetTest, GrowKeepsEveryKey )
+{
+    // start at the minimum capacity so the set grows many times
+    FingerprintSet set( 16 );
+    const uint64_t count = 100000;
+    for ( uint64_t i=0; i<count; ++i )
+    {
+        ASSERT_TRUE( set.Insert( i * 7919 + 1 ) ) << "false duplicate at " << i;
+    }
+    EXPECT_EQ( set.Size(), count );
+
+    for ( uint64_t i=0; i<count; ++i )
+    {
+        ASSERT_TRUE( set.Contains( i * 7919 + 1 ) ) << "lost key at " << i;
+        ASSERT_FALSE( set.Insert( i * 7919 + 1 ) );
+    }
+    EXPECT_EQ( set.Size(), count );
+    EXPECT_FALSE( set.Contains( 2 ) );
+}
+
+TEST( FingerprintSetTest, NoFalseDuplicatesForCollidingLowBits )
+{
+    // keys that share their low bits all land on the same home slot
+    FingerprintSet set;
+    const uint64_t count = 100000;
+    for ( uint64_t i=1; i<=count; ++i )
+    {
+        ASSERT_TRUE( set.Insert( i << 32 ) ) << "false duplicate at " << i;
+    }
+    EXPECT_EQ( set.Size(), count );
+}
@@ -0,0 +1,103 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// File Description:
+/// Microbenchmark for the steady state xxx_ONCE check.  Replaces the global operator new so the test can
+/// count allocations; once a message has been seen, checking it again must not allocate.
+//========================================================================================================
+
+// C++ Includes
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <new>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/Logger.h>
+#include "LoggerTest.h"
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+namespace
+{
+    std::atomic<long> allocations{0};
+}
+
+void* operator new
+(
+    std::size_t size
+)
+{
+    allocations.fetch_add( 1, std::memory_order_relaxed );
+    auto ptr = std::malloc( size > 0 ? size : 1 );
+    if ( ptr == nullptr )
+    {
+        throw std::bad_alloc();
+    }
+    return ptr;
+}
+
+void operator delete
+(
+    void*       ptr
+) noexcept
+{
+    std::free( ptr );
+}
+
+void operator delete
+(
+    void*       ptr,
+    std::size_t
+) noexcept
+{
+    std::free( ptr );
+}
+
+
+TEST_F( LoggerTest, SteadyStateOnceCheckDoesNotAllocate )
+{
+    const int iterations = 1000000;
+
+    // first pass displays each message once and may grow the fingerprint set
+    int displayed = 0;
+    for ( int i=0; i<16; ++i )
+    {
+        displayed += ShouldDisplayIt( Logger::LOGGER_LEVEL::WARNING_ONCE, "LoggerBenchmark", "speed", static_cast<double>(i) );
+    }
+    displayed += ShouldDisplayIt( Logger::LOGGER_LEVEL::WARNING_ONCE, "LoggerBenchmark", "Current X", "error message text" );
+    EXPECT_EQ( displayed, 17 );
+
+    auto before = allocations.load();
+    auto start  = std::chrono::steady_clock::now();
+    displayed = 0;
+    for ( int i=0; i<iterations; ++i )
+    {
+        displayed += ShouldDisplayIt( Logger::LOGGER_LEVEL::WARNING_ONCE, "LoggerBenchmark", "Current X", "error message text" );
+        displayed += ShouldDisplayIt( Logger::LOGGER_LEVEL::WARNING_ONCE, "LoggerBenchmark", "speed", static_cast<double>(i & 15) );
+    }
+    auto elapsed = std::chrono::duration<double, std::nano>( std::chrono::steady_clock::now() - start ).count();
+    auto after   = allocations.load();
+
+    EXPECT_EQ( displayed, 0 );
+    EXPECT_EQ( after - before, 0 );
+    std::cout << "[ BENCHMARK] " << elapsed / (2.0 * iterations) << " ns per xxx_ONCE check" << std::endl;
+}
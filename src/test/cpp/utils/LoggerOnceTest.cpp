@@ -0,0 +1,83 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// File Description:
+/// Tests that xxx_ONCE messages are only displayed the first time they are seen.
+//========================================================================================================
+
+// C++ Includes
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/Logger.h>
+#include "LoggerTest.h"
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+
+TEST_F( LoggerTest, OnceMessageDisplaysOnlyOnce )
+{
+    EXPECT_TRUE( ShouldDisplayIt( Logger::LOGGER_LEVEL::ERROR_ONCE, "LoggerTest", "once", "message" ) );
+    EXPECT_FALSE( ShouldDisplayIt( Logger::LOGGER_LEVEL::ERROR_ONCE, "LoggerTest", "once", "message" ) );
+}
+
+TEST_F( LoggerTest, OnceValueDisplaysOnlyOnce )
+{
+    EXPECT_TRUE( ShouldDisplayIt( Logger::LOGGER_LEVEL::WARNING_ONCE, "LoggerTest", "value", 1.5 ) );
+    EXPECT_FALSE( ShouldDisplayIt( Logger::LOGGER_LEVEL::WARNING_ONCE, "LoggerTest", "value", 1.5 ) );
+    EXPECT_TRUE( ShouldDisplayIt( Logger::LOGGER_LEVEL::WARNING_ONCE, "LoggerTest", "value", 2.5 ) );
+}
+
+TEST_F( LoggerTest, OnceKeyIncludesEveryField )
+{
+    EXPECT_TRUE( ShouldDisplayIt( Logger::LOGGER_LEVEL::PRINT_ONCE, "LoggerTest", "fields", "abc" ) );
+    EXPECT_TRUE( ShouldDisplayIt( Logger::LOGGER_LEVEL::PRINT_ONCE, "LoggerTest", "fields", "abd" ) );
+    EXPECT_TRUE( ShouldDisplayIt( Logger::LOGGER_LEVEL::PRINT_ONCE, "LoggerTest", "field", "sabc" ) );
+    EXPECT_TRUE( ShouldDisplayIt( Logger::LOGGER_LEVEL::PRINT_ONCE, "LoggerTes", "tfields", "abc" ) );
+}
+
+TEST_F( LoggerTest, RepeatingLevelsAlwaysDisplay )
+{
+    EXPECT_TRUE( ShouldDisplayIt( Logger::LOGGER_LEVEL::PRINT, "LoggerTest", "repeat", 1.5 ) );
+    EXPECT_TRUE( ShouldDisplayIt( Logger::LOGGER_LEVEL::PRINT, "LoggerTest", "repeat", 1.5 ) );
+}
+
+TEST_F( LoggerTest, EatItDisplaysNothing )
+{
+    SetLoggingOption( Logger::LOGGER_OPTION::EAT_IT );
+    EXPECT_FALSE( ShouldDisplayIt( Logger::LOGGER_LEVEL::ERROR_ONCE, "LoggerTest", "eat", "message" ) );
+    EXPECT_FALSE( ShouldDisplayIt( Logger::LOGGER_LEVEL::PRINT, "LoggerTest", "eat", 1.0 ) );
+}
+
+TEST_F( LoggerTest, DashboardSheddingFollowsTheOption )
+{
+    // PRINT is shed only while the option is DASHBOARD
+    m_logger->SetDashboardSuspended( true );
+    EXPECT_FALSE( m_logger->IsLoggingEnabled( Logger::LOGGER_LEVEL::PRINT ) );
+    EXPECT_TRUE( m_logger->IsLoggingEnabled( Logger::LOGGER_LEVEL::WARNING ) );
+
+    SetLoggingOption( Logger::LOGGER_OPTION::CONSOLE );
+    EXPECT_TRUE( m_logger->IsLoggingEnabled( Logger::LOGGER_LEVEL::PRINT ) );
+
+    SetLoggingOption( Logger::LOGGER_OPTION::DASHBOARD );
+    EXPECT_FALSE( m_logger->IsLoggingEnabled( Logger::LOGGER_LEVEL::PRINT ) );
+
+    m_logger->SetDashboardSuspended( false );
+    EXPECT_TRUE( m_logger->IsLoggingEnabled( Logger::LOGGER_LEVEL::PRINT ) );
+}
@@ -0,0 +1,81 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// File Description:
+/// Test fixture that exposes the Logger's private once-only filtering to the google tests.
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <string_view>
+
+// FRC includes
+
+// Team 302 includes
+#include <utils/Logger.h>
+
+// Third Party Includes
+#include "gtest/gtest.h"
+
+
+class LoggerTest : public ::testing::Test
+{
+    protected:
+        void SetUp() override
+        {
+            m_logger = Logger::GetLogger();
+            m_logger->SetLoggingOption( Logger::LOGGER_OPTION::DASHBOARD );
+        }
+
+        void TearDown() override
+        {
+            m_logger->SetLoggingOption( Logger::LOGGER_OPTION::EAT_IT );
+        }
+
+        bool ShouldDisplayIt
+        (
+            Logger::LOGGER_LEVEL    level,
+            std::string_view        group,
+            std::string_view        identifier,
+            std::string_view        message
+        )
+        {
+            return m_logger->ShouldDisplayIt( level, group, identifier, message );
+        }
+
+        bool ShouldDisplayIt
+        (
+            Logger::LOGGER_LEVEL    level,
+            std::string_view        group,
+            std::string_view        identifier,
+            double                  value
+        )
+        {
+            return m_logger->ShouldDisplayIt( level, group, identifier, value );
+        }
+
+        void SetLoggingOption
+        (
+            Logger::LOGGER_OPTION   option
+        )
+        {
+            m_logger->SetLoggingOption( option );
+        }
+
+        Logger*     m_logger;
+};
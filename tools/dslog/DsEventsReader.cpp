@@ -0,0 +1,347 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// DsEventsReader.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Reads the Driver Station's .dsevents files one console entry at a time
+///
+//========================================================================================================
+
+// C++ Includes
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Team 302 includes
+#include <DsEventsReader.h>
+#include <DsLogReader.h>
+
+using namespace std;
+
+namespace
+{
+    constexpr int32_t MAX_RECORD_LENGTH = 1024 * 1024;     // anything bigger means the file is corrupt
+
+    const char* const ENTRY_TAG = "<TagVersion>";
+    const vector<string> TAGS = { "<time>", "<message>", "<count>", "<flags>", "<Code>", "<details>", "<location>", "<stack>" };
+
+    uint32_t ReadU32
+    (
+        const uint8_t*  data
+    )
+    {
+        return (static_cast<uint32_t>(data[0]) << 24) | (data[1] << 16) | (data[2] << 8) | data[3];
+    }
+
+    uint64_t ReadU64
+    (
+        const uint8_t*  data
+    )
+    {
+        uint64_t value = 0;
+        for (auto inx=0; inx<8; ++inx)
+        {
+            value = (value << 8) | data[inx];
+        }
+        return value;
+    }
+
+    double ToUnixTime
+    (
+        const uint8_t*  data
+    )
+    {
+        auto seconds = static_cast<int64_t>(ReadU64(data));
+        auto fraction = ReadU64(data + 8);
+        return static_cast<double>(seconds) - DsLogReader::LABVIEW_TO_UNIX_SECONDS + static_cast<double>(fraction) / 18446744073709551616.0;
+    }
+
+    string Trim
+    (
+        const string&   text
+    )
+    {
+        auto first = text.find_first_not_of(" \r\n");
+        if (first == string::npos)
+        {
+            return string();
+        }
+        auto last = text.find_last_not_of(" \r\n");
+        return text.substr(first, last - first + 1);
+    }
+
+    bool StartsWith
+    (
+        const string&   text,
+        const char*     prefix
+    )
+    {
+        return text.rfind(prefix, 0) == 0;
+    }
+
+    bool Contains
+    (
+        const string&   text,
+        const char*     part
+    )
+    {
+        return text.find(part) != string::npos;
+    }
+
+    /// @brief Get a tag's value:  everything up to the next known tag.  Messages can have '<' in them
+    ///        (e.g. template names in stack traces), so only the known tags end a value.
+    bool GetTag
+    (
+        const string&   entry,
+        const string&   tag,
+        string&         value
+    )
+    {
+        auto start = entry.find(tag);
+        if (start == string::npos)
+        {
+            return false;
+        }
+        start += tag.size();
+        auto end = entry.size();
+        for (auto& other : TAGS)
+        {
+            auto next = entry.find(other, start);
+            if (next != string::npos && next < end)
+            {
+                end = next;
+            }
+        }
+        value = entry.substr(start, end - start);
+        return true;
+    }
+}
+
+/// @brief Open a .dsevents file and read its header
+/// @param [in] const std::string&: file name
+/// @returns bool: true - ready to read events, false - see GetError
+bool DsEventsReader::Open
+(
+    const string&       fileName
+)
+{
+    m_pending.clear();
+    m_error.clear();
+    m_file.open(fileName, ios::in | ios::binary);
+    if (!m_file.is_open())
+    {
+        m_error = "couldn't open " + fileName;
+        return false;
+    }
+
+    uint8_t header[20];
+    if (!m_file.read(reinterpret_cast<char*>(header), sizeof(header)))
+    {
+        m_error = fileName + " is too short to be a dsevents file";
+        return false;
+    }
+
+    auto version = static_cast<int>(ReadU32(header));
+    if (version != 3 && version != 4)
+    {
+        m_error = "unsupported dsevents version " + to_string(version);
+        return false;
+    }
+    m_startTime = ToUnixTime(header + 4);
+    return true;
+}
+
+/// @brief Read the next event
+/// @param [out] DsEvent&: event
+/// @returns bool: true - event was read, false - end of the file
+bool DsEventsReader::Next
+(
+    DsEvent&            event
+)
+{
+    string text;
+    while (m_pending.empty() && m_file.is_open())
+    {
+        uint8_t header[20];
+        if (!m_file.read(reinterpret_cast<char*>(header), sizeof(header)))
+        {
+            return false;
+        }
+        auto length = static_cast<int32_t>(ReadU32(header + 16));
+        if (length < 0 || length > MAX_RECORD_LENGTH)
+        {
+            return false;
+        }
+        text.resize(static_cast<size_t>(length));
+        if (length > 0 && !m_file.read(text.data(), length))
+        {
+            return false;
+        }
+        Split(ToUnixTime(header), text);
+    }
+
+    if (m_pending.empty())
+    {
+        return false;
+    }
+    event = std::move(m_pending.front());
+    m_pending.pop_front();
+    return true;
+}
+
+/// @brief split a record's text into events
+void DsEventsReader::Split
+(
+    double              time,
+    const string&       text
+)
+{
+    auto start = text.find(ENTRY_TAG);
+    auto prefix = Trim(text.substr(0, start));
+    if (!prefix.empty())
+    {
+        DsEvent event { time, DsEvent::EVENT_TYPE::ROBOT_OUTPUT, 0, prefix, string() };
+        event.type = Classify(event, true);
+        m_pending.push_back(event);
+    }
+
+    while (start != string::npos)
+    {
+        auto end = text.find(ENTRY_TAG, start + 1);
+        auto entry = text.substr(start, end == string::npos ? string::npos : end - start);
+        start = end;
+
+        DsEvent event { time, DsEvent::EVENT_TYPE::ROBOT_OUTPUT, 0, string(), string() };
+        string value;
+        auto isMessage = GetTag(entry, "<message>", value);
+        if (!isMessage && !GetTag(entry, "<details>", value))
+        {
+            continue;
+        }
+        // keep leading tabs, since they identify stack frames and Tracer output
+        auto first = value.find_first_not_of(' ');
+        auto last = value.find_last_not_of(" \r\n");
+        if (first == string::npos || last == string::npos || last < first)
+        {
+            continue;
+        }
+        event.text = value.substr(first, last - first + 1);
+        // multi-line messages (e.g. the Tracer epochs after a watchdog warning) become one line
+        for (auto newline = event.text.find('\n'); newline != string::npos; newline = event.text.find('\n', newline))
+        {
+            auto next = event.text.find_first_not_of("\r\n\t", newline);
+            event.text.replace(newline, next == string::npos ? string::npos : next - newline, "; ");
+        }
+        if (GetTag(entry, "<Code>", value))
+        {
+            event.code = atoi(value.c_str());
+        }
+        if (GetTag(entry, "<location>", value))
+        {
+            event.location = Trim(value);
+        }
+        event.type = Classify(event, isMessage);
+        m_pending.push_back(event);
+    }
+}
+
+/// @brief decide what kind of event it is
+DsEvent::EVENT_TYPE DsEventsReader::Classify
+(
+    const DsEvent&      event,
+    bool                isMessage
+)
+{
+    auto& text = event.text;
+    if (isMessage && (StartsWith(text, "\tat ") || StartsWith(text, "at ") || StartsWith(text, "Error at ") || StartsWith(text, "Warning at ")))
+    {
+        return DsEvent::EVENT_TYPE::ERROR_ECHO;
+    }
+    if (Contains(text, "Loop time of") && Contains(text, "overrun"))
+    {
+        return DsEvent::EVENT_TYPE::LOOP_OVERRUN;
+    }
+    if (text.back() == 's' && Contains(text, "(): "))
+    {
+        return DsEvent::EVENT_TYPE::TRACER;
+    }
+    if (Contains(text, "Watchdog not fed") || Contains(text, "Output not updated often enough"))
+    {
+        return DsEvent::EVENT_TYPE::WATCHDOG;
+    }
+    if (StartsWith(text, "CTR:") || StartsWith(text, "[phoenix") || StartsWith(event.location, "Talon") || StartsWith(event.location, "Victor"))
+    {
+        return DsEvent::EVENT_TYPE::CAN_ERROR;
+    }
+    if (Contains(text, "lost communication") || Contains(text, "Ping Results") || Contains(text, "Communications Timeout"))
+    {
+        return DsEvent::EVENT_TYPE::COMMS;
+    }
+    if (StartsWith(text, "Info ") || StartsWith(text, "DS ") || StartsWith(text, "FRC: No robot code") || StartsWith(text, "**********"))
+    {
+        return DsEvent::EVENT_TYPE::DS_EVENT;
+    }
+    if (!isMessage || event.code != 0)
+    {
+        return DsEvent::EVENT_TYPE::OTHER_ERROR;
+    }
+    return DsEvent::EVENT_TYPE::ROBOT_OUTPUT;
+}
+
+/// @brief Name of an event type for reports
+const char* DsEventsReader::GetTypeName
+(
+    DsEvent::EVENT_TYPE     type
+)
+{
+    switch (type)
+    {
+        case DsEvent::EVENT_TYPE::ROBOT_OUTPUT:
+            return "robot output";
+
+        case DsEvent::EVENT_TYPE::LOOP_OVERRUN:
+            return "loop overrun";
+
+        case DsEvent::EVENT_TYPE::TRACER:
+            return "tracer";
+
+        case DsEvent::EVENT_TYPE::WATCHDOG:
+            return "watchdog";
+
+        case DsEvent::EVENT_TYPE::CAN_ERROR:
+            return "CAN error";
+
+        case DsEvent::EVENT_TYPE::COMMS:
+            return "communications";
+
+        case DsEvent::EVENT_TYPE::DS_EVENT:
+            return "driver station";
+
+        case DsEvent::EVENT_TYPE::ERROR_ECHO:
+            return "error echo";
+
+        case DsEvent::EVENT_TYPE::OTHER_ERROR:
+            return "other error";
+
+        default:
+            return "unknown";
+    }
+}
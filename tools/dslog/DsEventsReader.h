@@ -0,0 +1,122 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// DsEventsReader.h
+//========================================================================================================
+///
+/// File Description:
+///     Reads the Driver Station's .dsevents files (the messages shown in the DS console).
+///
+///     The header is the same as the .dslog header.  Each record is int64 seconds, uint64 fraction,
+///     int32 length and then the text.  The text holds one or more tagged entries:
+///
+///         <TagVersion>1 <time> 12.345 <message> text printed by the robot
+///         <TagVersion>1 <time> 12.345 <count> 1 <flags> 1 <Code> -111 <details> text <location> where <stack> trace
+///
+///     and, sometimes, untagged DS information ("Info roboRIO: ...") in front of the first tag.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+#include <deque>
+#include <fstream>
+#include <string>
+
+
+/// @struct DsEvent
+/// @brief  one entry from the driver station console
+struct DsEvent
+{
+    enum EVENT_TYPE
+    {
+        ROBOT_OUTPUT,           ///< printed by the robot program (cout, Logger)
+        LOOP_OVERRUN,           ///< "Loop time of 0.02s overrun"
+        TRACER,                 ///< epoch times printed after an overrun ("\tRobotPeriodic(): 0.01s")
+        WATCHDOG,               ///< "Watchdog not fed" / motor safety
+        CAN_ERROR,              ///< CTR: errors
+        COMMS,                  ///< lost communication, ping results
+        DS_EVENT,               ///< enable/disable, code restart, DS information
+        ERROR_ECHO,             ///< "Error at ..." lines and stack frames that repeat an error
+        OTHER_ERROR,            ///< any other error or warning with a code
+        MAX_EVENT_TYPE
+    };
+
+    double          time;       ///< unix time (seconds)
+    EVENT_TYPE      type;
+    int             code;       ///< error code (0 for messages)
+    std::string     text;       ///< message or error details
+    std::string     location;   ///< error location (empty for messages)
+};
+
+
+class DsEventsReader
+{
+    public:
+        DsEventsReader() = default;
+        ~DsEventsReader() = default;
+
+        /// @brief Open a .dsevents file and read its header
+        /// @param [in] const std::string&: file name
+        /// @returns bool: true - ready to read events, false - see GetError
+        bool Open
+        (
+            const std::string&      fileName
+        );
+
+        /// @brief Read the next event
+        /// @param [out] DsEvent&: event
+        /// @returns bool: true - event was read, false - end of the file
+        bool Next
+        (
+            DsEvent&                event
+        );
+
+        /// @returns double: unix time (seconds) when the file was started
+        double GetStartTime() const { return m_startTime; }
+
+        /// @returns const std::string&: why Open failed
+        const std::string& GetError() const { return m_error; }
+
+        /// @brief Name of an event type for reports
+        static const char* GetTypeName
+        (
+            DsEvent::EVENT_TYPE     type
+        );
+
+    private:
+        /// @brief split a record's text into events
+        void Split
+        (
+            double                  time,
+            const std::string&      text
+        );
+
+        /// @brief decide what kind of event it is
+        static DsEvent::EVENT_TYPE Classify
+        (
+            const DsEvent&          event,
+            bool                    isMessage
+        );
+
+        std::ifstream           m_file;
+        double                  m_startTime = 0.0;
+        std::deque<DsEvent>     m_pending;
+        std::string             m_error;
+};
@@ -0,0 +1,439 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// DsLogAnalyzer.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Summarizes the health of one driver station log
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cstdio>
+#include <ctime>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Team 302 includes
+#include <DsEventsReader.h>
+#include <DsLogAnalyzer.h>
+#include <DsLogReader.h>
+
+using namespace std;
+
+namespace
+{
+    constexpr double CONTEXT_SECONDS = 0.5;     // robot output this close to an overrun window is shown with it
+    constexpr size_t MAX_CONTEXT_LINES = 8;
+    constexpr double MAX_BATTERY_VOLTAGE = 16.0;  // a 12 V battery fresh off the charger is under 14 V; anything above is a bad sample
+
+    /// @param [in] double: battery voltage from a record
+    /// @returns bool: true - a real reading, false - the DS wasn't connected (zero) or the sample is garbage
+    bool IsValidVoltage
+    (
+        double          voltage
+    )
+    {
+        return voltage > 0.0 && voltage <= MAX_BATTERY_VOLTAGE;
+    }
+}
+
+/// @param [in] double: battery voltage below which a low voltage window is reported
+/// @param [in] double: overrun / watchdog messages closer together than this (seconds) are one window
+DsLogAnalyzer::DsLogAnalyzer
+(
+    double          lowVoltage,
+    double          mergeGap
+) : m_lowVoltage(lowVoltage),
+    m_mergeGap(mergeGap),
+    m_version(0),
+    m_startTime(0.0),
+    m_records(0),
+    m_modeTime(),
+    m_voltage(),
+    m_cpu(),
+    m_can(),
+    m_tripTime(),
+    m_packetLoss(),
+    m_current(),
+    m_events(),
+    m_eventCounts(),
+    m_enabledPeriods(),
+    m_brownouts(),
+    m_overruns(),
+    m_nextOverrun(0),
+    m_inEnabled(false),
+    m_inBrownout(false),
+    m_error()
+{
+}
+
+/// @brief Analyze a log
+/// @param [in] const std::string&: .dslog file
+/// @param [in] const std::string&: .dsevents file (empty or missing - only the .dslog is analyzed)
+/// @returns bool: true - analyzed, false - see GetError
+bool DsLogAnalyzer::Analyze
+(
+    const string&       dslogFile,
+    const string&       dseventsFile
+)
+{
+    DsLogReader reader;
+    if (!reader.Open(dslogFile))
+    {
+        m_error = reader.GetError();
+        return false;
+    }
+    m_version = reader.GetVersion();
+    m_startTime = reader.GetStartTime();
+
+    ReadEvents(dseventsFile, m_startTime);
+
+    DsLogRecord record;
+    while (reader.Next(record))
+    {
+        AddRecord(record);
+    }
+
+    AddContext();
+    return true;
+}
+
+/// @brief read the events and group the overrun / watchdog messages into windows
+void DsLogAnalyzer::ReadEvents
+(
+    const string&       dseventsFile,
+    double              logStartTime
+)
+{
+    DsEventsReader reader;
+    if (dseventsFile.empty() || !reader.Open(dseventsFile))
+    {
+        return;
+    }
+
+    DsEvent event;
+    while (reader.Next(event))
+    {
+        event.time -= logStartTime;
+        ++m_eventCounts[event.type];
+        m_events.push_back(event);
+    }
+    stable_sort(m_events.begin(), m_events.end(), [](const DsEvent& a, const DsEvent& b) { return a.time < b.time; });
+
+    for (auto& item : m_events)
+    {
+        if (item.type != DsEvent::EVENT_TYPE::LOOP_OVERRUN && item.type != DsEvent::EVENT_TYPE::WATCHDOG)
+        {
+            continue;
+        }
+        if (m_overruns.empty() || item.time - m_overruns.back().end > m_mergeGap)
+        {
+            DsLogWindow window;
+            window.start = item.time;
+            m_overruns.push_back(window);
+        }
+        m_overruns.back().end = item.time;
+        ++m_overruns.back().count;
+    }
+}
+
+/// @brief update the statistics and windows with one record
+void DsLogAnalyzer::AddRecord
+(
+    const DsLogRecord&  record
+)
+{
+    ++m_records;
+    auto mode = GetMode(record);
+    m_modeTime[mode] += DsLogReader::RECORD_PERIOD;
+
+    // the DS logs zeros when it isn't connected to the robot
+    auto connected = IsValidVoltage(record.batteryVoltage);
+    if (connected)
+    {
+        m_voltage.Add(record.batteryVoltage);
+        m_cpu.Add(record.cpu);
+        m_can.Add(record.canUtilization);
+        m_tripTime.Add(record.tripTimeMs);
+        m_packetLoss.Add(record.packetLoss);
+    }
+
+    auto current = 0.0;
+    for (auto channel=0; channel<record.channelCount; ++channel)
+    {
+        current += record.currents[channel];
+    }
+    if (record.channelCount > 0)
+    {
+        m_current.Add(current);
+    }
+
+    // enabled periods
+    auto enabled = mode != MODE::DISABLED;
+    if (enabled && (!m_inEnabled || m_enabledPeriods.back().mode != GetModeName(mode)))
+    {
+        DsLogWindow period;
+        period.start = record.time;
+        period.mode = GetModeName(mode);
+        m_enabledPeriods.push_back(period);
+    }
+    m_inEnabled = enabled;
+    if (enabled)
+    {
+        auto& period = m_enabledPeriods.back();
+        period.end = record.time + DsLogReader::RECORD_PERIOD;
+        auto reported = mode == MODE::AUTON ? record.robotAuto : record.robotTeleop;
+        period.count += reported ? 0 : 1;
+        UpdateWindow(record, period);
+    }
+
+    // brownouts and low voltage
+    auto brownout = connected && (record.brownout || record.batteryVoltage < m_lowVoltage);
+    if (brownout && !m_inBrownout)
+    {
+        DsLogWindow window;
+        window.start = record.time;
+        window.mode = GetModeName(mode);
+        m_brownouts.push_back(window);
+    }
+    m_inBrownout = brownout;
+    if (brownout)
+    {
+        auto& window = m_brownouts.back();
+        window.end = record.time + DsLogReader::RECORD_PERIOD;
+        window.count += record.brownout ? 1 : 0;
+        UpdateWindow(record, window);
+    }
+
+    // conditions around the overrun windows (the windows are sorted and don't overlap)
+    while (m_nextOverrun < m_overruns.size() && record.time > m_overruns[m_nextOverrun].end + CONTEXT_SECONDS)
+    {
+        ++m_nextOverrun;
+    }
+    for (auto inx=m_nextOverrun; inx<m_overruns.size() && record.time >= m_overruns[inx].start - CONTEXT_SECONDS; ++inx)
+    {
+        auto& window = m_overruns[inx];
+        if (record.time <= window.end + CONTEXT_SECONDS)
+        {
+            if (record.time <= window.start)
+            {
+                window.mode = GetModeName(mode);
+            }
+            UpdateWindow(record, window);
+        }
+    }
+}
+
+/// @brief add the conditions during a record to a window
+void DsLogAnalyzer::UpdateWindow
+(
+    const DsLogRecord&  record,
+    DsLogWindow&        window
+)
+{
+    if (IsValidVoltage(record.batteryVoltage))
+    {
+        window.minVoltage = min(window.minVoltage, record.batteryVoltage);
+    }
+    window.maxCpu = max(window.maxCpu, record.cpu);
+    window.maxCan = max(window.maxCan, record.canUtilization);
+    window.maxTripTimeMs = max(window.maxTripTimeMs, record.tripTimeMs);
+
+    auto current = 0.0;
+    for (auto channel=0; channel<record.channelCount; ++channel)
+    {
+        current += record.currents[channel];
+    }
+    window.maxCurrent = max(window.maxCurrent, current);
+}
+
+/// @brief add the robot output and tracer lines near the overrun windows.  Tracer epochs and errors
+///        are kept first; repeated robot output (e.g. a value printed every loop) is shown once.
+void DsLogAnalyzer::AddContext()
+{
+    struct ContextLine
+    {
+        const DsEvent*  event;
+        int             repeats;
+    };
+
+    for (auto& window : m_overruns)
+    {
+        vector<ContextLine> lines;
+        for (auto& event : m_events)
+        {
+            if (event.time > window.end + CONTEXT_SECONDS)
+            {
+                break;
+            }
+            if (event.time < window.start - CONTEXT_SECONDS ||
+                event.type == DsEvent::EVENT_TYPE::LOOP_OVERRUN || event.type == DsEvent::EVENT_TYPE::WATCHDOG ||
+                event.type == DsEvent::EVENT_TYPE::ERROR_ECHO || event.type == DsEvent::EVENT_TYPE::DS_EVENT)
+            {
+                continue;
+            }
+            auto repeat = find_if(lines.begin(), lines.end(), [&event](const ContextLine& line) { return line.event->text == event.text; });
+            if (repeat != lines.end())
+            {
+                ++repeat->repeats;
+            }
+            else
+            {
+                lines.push_back(ContextLine{ &event, 1 });
+            }
+        }
+
+        stable_partition(lines.begin(), lines.end(), [](const ContextLine& line) { return line.event->type != DsEvent::EVENT_TYPE::ROBOT_OUTPUT; });
+        if (lines.size() > MAX_CONTEXT_LINES)
+        {
+            lines.resize(MAX_CONTEXT_LINES);
+        }
+        stable_sort(lines.begin(), lines.end(), [](const ContextLine& a, const ContextLine& b) { return a.event->time < b.event->time; });
+
+        for (auto& line : lines)
+        {
+            auto text = line.event->text;
+            text.erase(0, text.find_first_not_of('\t'));
+            char prefix[64];
+            snprintf(prefix, sizeof(prefix), "%8.2f  %-12s ", line.event->time, DsEventsReader::GetTypeName(line.event->type));
+            window.context.emplace_back(prefix + text);
+            if (line.repeats > 1)
+            {
+                window.context.back() += "  (x" + to_string(line.repeats) + ")";
+            }
+        }
+    }
+}
+
+/// @brief Write the summary
+void DsLogAnalyzer::Report
+(
+    ostream&            out
+) const
+{
+    char line[256];
+    auto start = static_cast<time_t>(m_startTime);
+    char when[64];
+    strftime(when, sizeof(when), "%Y-%m-%d %H:%M:%S", localtime(&start));
+    auto duration = static_cast<double>(m_records) * DsLogReader::RECORD_PERIOD;
+
+    snprintf(line, sizeof(line), "version %d, started %s, %.1f s, %llu records\n", m_version, when, duration, static_cast<unsigned long long>(m_records));
+    out << line;
+    snprintf(line, sizeof(line), "time:  disabled %.1f s   auton %.1f s   teleop %.1f s\n", m_modeTime[MODE::DISABLED], m_modeTime[MODE::AUTON], m_modeTime[MODE::TELEOP]);
+    out << line;
+
+    out << "\nenabled periods:\n";
+    for (auto& period : m_enabledPeriods)
+    {
+        snprintf(line, sizeof(line), "  %8.2f - %8.2f s  %-8s  min %.2f V  CPU max %.0f%%  CAN max %.0f%%  mode not reported by the robot %.2f s\n",
+                 period.start, period.end, period.mode, period.minVoltage, period.maxCpu * 100.0, period.maxCan * 100.0,
+                 period.count * DsLogReader::RECORD_PERIOD);
+        out << line;
+    }
+
+    out << "\nwhole log (connected records):\n";
+    out << "                       min      mean       max\n";
+    auto statistic = [&out, &line](const char* name, const DsLogStatistic& value, double scale)
+    {
+        if (value.count == 0)
+        {
+            snprintf(line, sizeof(line), "%-16s         -         -         -\n", name);
+        }
+        else
+        {
+            snprintf(line, sizeof(line), "%-16s %9.2f %9.2f %9.2f\n", name, value.minimum * scale, value.GetMean() * scale, value.maximum * scale);
+        }
+        out << line;
+    };
+    statistic("battery (V)", m_voltage, 1.0);
+    statistic("CPU (%)", m_cpu, 100.0);
+    statistic("CAN (%)", m_can, 100.0);
+    statistic("trip time (ms)", m_tripTime, 1.0);
+    statistic("packet loss (%)", m_packetLoss, 100.0);
+    statistic("current (A)", m_current, 1.0);
+
+    snprintf(line, sizeof(line), "\nbrownouts / low voltage (< %.1f V):  %zu\n", m_lowVoltage, m_brownouts.size());
+    out << line;
+    for (auto& window : m_brownouts)
+    {
+        snprintf(line, sizeof(line), "  %8.2f - %8.2f s  %-8s  min %.2f V  %s  max current %.0f A  CAN max %.0f%%\n",
+                 window.start, window.end, window.mode, window.minVoltage, window.count > 0 ? "brownout" : "low     ",
+                 window.maxCurrent, window.maxCan * 100.0);
+        out << line;
+    }
+
+    snprintf(line, sizeof(line), "\nloop overrun / watchdog windows:  %zu  (%d overruns, %d watchdog)\n", m_overruns.size(),
+             m_eventCounts[DsEvent::EVENT_TYPE::LOOP_OVERRUN], m_eventCounts[DsEvent::EVENT_TYPE::WATCHDOG]);
+    out << line;
+    for (auto& window : m_overruns)
+    {
+        snprintf(line, sizeof(line), "  %8.2f - %8.2f s  %-8s  %d messages  CPU max %.0f%%  CAN max %.0f%%  min %.2f V  trip max %.1f ms\n",
+                 window.start, window.end, window.mode, window.count, window.maxCpu * 100.0, window.maxCan * 100.0,
+                 window.minVoltage, window.maxTripTimeMs);
+        out << line;
+        for (auto& context : window.context)
+        {
+            out << "      " << context << '\n';
+        }
+    }
+
+    out << "\nevents:\n";
+    for (auto type=0; type<DsEvent::EVENT_TYPE::MAX_EVENT_TYPE; ++type)
+    {
+        snprintf(line, sizeof(line), "  %-16s %6d\n", DsEventsReader::GetTypeName(static_cast<DsEvent::EVENT_TYPE>(type)), m_eventCounts[type]);
+        out << line;
+    }
+}
+
+DsLogAnalyzer::MODE DsLogAnalyzer::GetMode
+(
+    const DsLogRecord&  record
+)
+{
+    // the mode the robot reports drops out when its loop is late, so use the DS mode
+    if (record.dsAuto && !record.dsDisabled)
+    {
+        return MODE::AUTON;
+    }
+    if (record.dsTeleop && !record.dsDisabled)
+    {
+        return MODE::TELEOP;
+    }
+    return MODE::DISABLED;
+}
+
+const char* DsLogAnalyzer::GetModeName
+(
+    MODE                mode
+)
+{
+    switch (mode)
+    {
+        case MODE::AUTON:
+            return "auton";
+
+        case MODE::TELEOP:
+            return "teleop";
+
+        default:
+            return "disabled";
+    }
+}
@@ -0,0 +1,183 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// DsLogAnalyzer.h
+//========================================================================================================
+///
+/// File Description:
+///     Summarizes the health of one driver station log (a match or a practice session):  time in
+///     each mode, battery / CPU / CAN / network statistics, brownout and low voltage windows, and
+///     loop overrun / watchdog windows with the conditions at the time and the robot output
+///     (Logger messages, Tracer epochs) printed around them.
+///
+///     The .dsevents file is small, so it is read first; the .dslog file is streamed one record
+///     at a time.
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Team 302 includes
+#include <DsEventsReader.h>
+#include <DsLogReader.h>
+
+
+/// @struct DsLogStatistic
+/// @brief  minimum, mean and maximum of a signal
+struct DsLogStatistic
+{
+    double      minimum = std::numeric_limits<double>::max();
+    double      maximum = std::numeric_limits<double>::lowest();
+    double      total = 0.0;
+    uint64_t    count = 0;
+
+    void Add( double value )
+    {
+        minimum = value < minimum ? value : minimum;
+        maximum = value > maximum ? value : maximum;
+        total += value;
+        ++count;
+    }
+    double GetMean() const { return count > 0 ? total / static_cast<double>(count) : 0.0; }
+};
+
+
+/// @struct DsLogWindow
+/// @brief  a period of time when something was wrong (or, for the match periods, when the robot was enabled)
+struct DsLogWindow
+{
+    double                      start = 0.0;        ///< seconds since the start of the log
+    double                      end = 0.0;
+    const char*                 mode = "disabled";  ///< robot mode when the window started
+    int                         count = 0;          ///< number of messages (overrun / watchdog windows)
+    double                      minVoltage = std::numeric_limits<double>::max();
+    double                      maxCpu = 0.0;
+    double                      maxCan = 0.0;
+    double                      maxTripTimeMs = 0.0;
+    double                      maxCurrent = 0.0;   ///< sum of the power distribution channels
+    std::vector<std::string>    context;            ///< robot output / tracer lines around the window
+};
+
+
+class DsLogAnalyzer
+{
+    public:
+        /// @param [in] double: battery voltage below which a low voltage window is reported
+        /// @param [in] double: overrun / watchdog messages closer together than this (seconds) are one window
+        DsLogAnalyzer
+        (
+            double          lowVoltage = 7.0,
+            double          mergeGap = 1.0
+        );
+        ~DsLogAnalyzer() = default;
+
+        /// @brief Analyze a log
+        /// @param [in] const std::string&: .dslog file
+        /// @param [in] const std::string&: .dsevents file (empty or missing - only the .dslog is analyzed)
+        /// @returns bool: true - analyzed, false - see GetError
+        bool Analyze
+        (
+            const std::string&      dslogFile,
+            const std::string&      dseventsFile
+        );
+
+        /// @brief Write the summary
+        void Report
+        (
+            std::ostream&           out
+        ) const;
+
+        /// @returns const std::vector<DsEvent>&: the events (times are seconds since the start of the log)
+        const std::vector<DsEvent>& GetEvents() const { return m_events; }
+
+        const std::vector<DsLogWindow>& GetEnabledPeriods() const { return m_enabledPeriods; }
+        const std::vector<DsLogWindow>& GetBrownouts() const { return m_brownouts; }
+        const std::vector<DsLogWindow>& GetOverruns() const { return m_overruns; }
+
+        /// @returns const std::string&: why Analyze failed
+        const std::string& GetError() const { return m_error; }
+
+    private:
+        enum MODE
+        {
+            DISABLED,
+            AUTON,
+            TELEOP,
+            MAX_MODES
+        };
+
+        static MODE GetMode( const DsLogRecord& record );
+        static const char* GetModeName( MODE mode );
+
+        /// @brief read the events and group the overrun / watchdog messages into windows
+        void ReadEvents
+        (
+            const std::string&      dseventsFile,
+            double                  logStartTime
+        );
+
+        /// @brief update the statistics and windows with one record
+        void AddRecord
+        (
+            const DsLogRecord&      record
+        );
+
+        /// @brief add the conditions during a record to a window
+        static void UpdateWindow
+        (
+            const DsLogRecord&      record,
+            DsLogWindow&            window
+        );
+
+        /// @brief add the robot output and tracer lines near the overrun windows
+        void AddContext();
+
+        double                          m_lowVoltage;
+        double                          m_mergeGap;
+
+        int                             m_version;
+        double                          m_startTime;
+        uint64_t                        m_records;
+        std::array<double, MAX_MODES>   m_modeTime;
+
+        DsLogStatistic                  m_voltage;
+        DsLogStatistic                  m_cpu;
+        DsLogStatistic                  m_can;
+        DsLogStatistic                  m_tripTime;
+        DsLogStatistic                  m_packetLoss;
+        DsLogStatistic                  m_current;
+
+        std::vector<DsEvent>            m_events;
+        std::array<int, DsEvent::EVENT_TYPE::MAX_EVENT_TYPE> m_eventCounts;
+
+        std::vector<DsLogWindow>        m_enabledPeriods;
+        std::vector<DsLogWindow>        m_brownouts;
+        std::vector<DsLogWindow>        m_overruns;
+        size_t                          m_nextOverrun;
+        bool                            m_inEnabled;
+        bool                            m_inBrownout;
+
+        std::string                     m_error;
+};
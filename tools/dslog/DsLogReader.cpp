@@ -0,0 +1,221 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// DsLogReader.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Reads the Driver Station's .dslog files one record at a time
+///
+//========================================================================================================
+
+// C++ Includes
+#include <algorithm>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+// Team 302 includes
+#include <DsLogReader.h>
+
+using namespace std;
+
+namespace
+{
+    constexpr size_t DATA_SIZE      = 10;   // trip time through bandwidth
+    constexpr size_t PD_HEADER_SIZE = 4;    // version 4 only
+    constexpr size_t CTRE_SIZE      = 25;   // CAN id, 21 bytes of currents, 3 other bytes
+    constexpr size_t REV_SIZE       = 33;   // CAN id, 27 bytes of currents, 4 extra currents, 1 other byte
+
+    uint16_t ReadU16
+    (
+        const uint8_t*  data
+    )
+    {
+        return static_cast<uint16_t>((data[0] << 8) | data[1]);
+    }
+
+    uint64_t ReadU64
+    (
+        const uint8_t*  data
+    )
+    {
+        uint64_t value = 0;
+        for (auto inx=0; inx<8; ++inx)
+        {
+            value = (value << 8) | data[inx];
+        }
+        return value;
+    }
+}
+
+/// @brief Open a .dslog file and read its header
+/// @param [in] const std::string&: file name
+/// @returns bool: true - ready to read records, false - see GetError
+bool DsLogReader::Open
+(
+    const string&       fileName
+)
+{
+    m_count = 0;
+    m_error.clear();
+    m_file.open(fileName, ios::in | ios::binary);
+    if (!m_file.is_open())
+    {
+        m_error = "couldn't open " + fileName;
+        return false;
+    }
+
+    uint8_t header[20];
+    if (!m_file.read(reinterpret_cast<char*>(header), sizeof(header)))
+    {
+        m_error = fileName + " is too short to be a dslog file";
+        return false;
+    }
+
+    m_version = static_cast<int>(ReadU64(header) >> 32);
+    if (m_version != 3 && m_version != 4)
+    {
+        m_error = "unsupported dslog version " + to_string(m_version);
+        return false;
+    }
+
+    auto seconds = static_cast<int64_t>(ReadU64(header + 4));
+    auto fraction = ReadU64(header + 12);
+    m_startTime = static_cast<double>(seconds) - LABVIEW_TO_UNIX_SECONDS + static_cast<double>(fraction) / 18446744073709551616.0;
+    return true;
+}
+
+/// @brief Read the next record
+/// @param [out] DsLogRecord&: record
+/// @returns bool: true - record was read, false - end of the file (or a partial record)
+bool DsLogReader::Next
+(
+    DsLogRecord&        record
+)
+{
+    uint8_t data[DATA_SIZE + PD_HEADER_SIZE + REV_SIZE];
+    if (!m_file.is_open() || !m_file.read(reinterpret_cast<char*>(data), DATA_SIZE))
+    {
+        return false;
+    }
+
+    record.time           = static_cast<double>(m_count++) * RECORD_PERIOD;
+    record.tripTimeMs     = data[0] * 0.5;
+    record.packetLoss     = max(0.0, min(1.0, static_cast<int8_t>(data[1]) * 4 * 0.01));
+    record.batteryVoltage = ReadU16(data + 2) == 0xFFFF ? 0.0 : ReadU16(data + 2) / 256.0;
+    record.cpu            = data[4] * 0.5 * 0.01;
+    record.canUtilization = data[6] * 0.5 * 0.01;
+    record.wifiDb         = data[7] * 0.5;
+    record.bandwidthMb    = ReadU16(data + 8) / 256.0;
+
+    auto status = data[5];
+    record.brownout       = (status & 0x80) == 0;
+    record.watchdog       = (status & 0x40) == 0;
+    record.dsTeleop       = (status & 0x20) == 0;
+    record.dsAuto         = (status & 0x10) == 0;
+    record.dsDisabled     = (status & 0x08) == 0;
+    record.robotTeleop    = (status & 0x04) == 0;
+    record.robotAuto      = (status & 0x02) == 0;
+    record.robotDisabled  = (status & 0x01) == 0;
+
+    record.pdCanId = -1;
+    record.channelCount = 0;
+    record.currents.fill(0.0);
+
+    auto pd = data + DATA_SIZE;
+    if (m_version == 3)
+    {
+        if (!m_file.read(reinterpret_cast<char*>(pd), CTRE_SIZE))
+        {
+            return false;
+        }
+        ReadCtrePdp(pd, record);
+        return true;
+    }
+
+    if (!m_file.read(reinterpret_cast<char*>(pd), PD_HEADER_SIZE))
+    {
+        return false;
+    }
+    auto type = pd[PD_HEADER_SIZE - 1];
+    pd += PD_HEADER_SIZE;
+    if (type == PD_TYPE_CTRE)
+    {
+        if (!m_file.read(reinterpret_cast<char*>(pd), CTRE_SIZE))
+        {
+            return false;
+        }
+        ReadCtrePdp(pd, record);
+    }
+    else if (type == PD_TYPE_REV)
+    {
+        if (!m_file.read(reinterpret_cast<char*>(pd), REV_SIZE))
+        {
+            return false;
+        }
+        ReadRevPdh(pd, record);
+    }
+    return true;
+}
+
+/// @brief decode the CTRE PDP currents:  6 10-bit values (most significant bit first) are packed in
+///        each 64 bits after the CAN id
+void DsLogReader::ReadCtrePdp
+(
+    const uint8_t*      data,
+    DsLogRecord&        record
+)
+{
+    record.pdCanId = data[0];
+    record.channelCount = 16;
+    for (auto channel=0; channel<16; ++channel)
+    {
+        auto offset = 8 + (channel / 6) * 64 + (channel % 6) * 10;
+        auto first = offset / 8;
+        uint32_t bits = (static_cast<uint32_t>(data[first]) << 16) | (data[first+1] << 8) | data[first+2];
+        auto raw = (bits >> (24 - (offset % 8) - 10)) & 0x3FF;
+        record.currents[channel] = raw / 8.0;
+    }
+}
+
+/// @brief decode the REV PDH currents:  3 10-bit values are packed in each little endian 32 bits
+///        after the CAN id, then channels 20-23 have a byte each
+void DsLogReader::ReadRevPdh
+(
+    const uint8_t*      data,
+    DsLogRecord&        record
+)
+{
+    record.pdCanId = data[0];
+    record.channelCount = 24;
+    auto currents = data + 1;
+    for (auto channel=0; channel<20; ++channel)
+    {
+        auto group = currents + (channel / 3) * 4;
+        uint32_t bits = group[0] | (group[1] << 8) | (group[2] << 16);
+        if (channel < 18)
+        {
+            bits |= static_cast<uint32_t>(group[3]) << 24;      // the last group only has 3 bytes
+        }
+        record.currents[channel] = ((bits >> ((channel % 3) * 10)) & 0x3FF) / 8.0;
+    }
+    for (auto channel=20; channel<24; ++channel)
+    {
+        record.currents[channel] = currents[27 + channel - 20] / 16.0;
+    }
+}
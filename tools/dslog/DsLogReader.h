@@ -0,0 +1,140 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// DsLogReader.h
+//========================================================================================================
+///
+/// File Description:
+///     Reads the Driver Station's .dslog files one record at a time (versions 3 and 4).
+///
+///     All values are big endian.  The header is int32 version, int64 seconds and uint64 fraction
+///     of a second since 1/1/1904 (LabVIEW time).  A record is written every 20 ms:
+///
+///         uint8   trip time (0.5 ms)              uint8   status (bits are 0 when the flag is set)
+///         int8    packet loss (4 %)               uint8   CAN utilization (0.5 %)
+///         uint16  battery voltage (1/256 V)       uint8   wifi signal (0.5 dB)
+///                 (0xFFFF - unknown)
+///         uint8   roboRIO CPU (0.5 %)             uint16  bandwidth (1/256 Mb/s)
+///
+///     followed by the power distribution data:
+///         version 3:  CTRE PDP - CAN id, 16 currents (10 bits, 1/8 A), 3 bytes (not used)
+///         version 4:  4 bytes with the type in the last byte, then
+///                     CTRE PDP (type 25) - same as version 3
+///                     REV PDH (type 33)  - CAN id, 20 currents (10 bits, 1/8 A, 3 per 32 bits), 4 currents (1/16 A), 1 byte (not used)
+///                     anything else      - no power distribution data
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <array>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+
+/// @struct DsLogRecord
+/// @brief  one 20 ms sample from the driver station log
+struct DsLogRecord
+{
+    double                  time;               ///< seconds since the start of the log
+    double                  tripTimeMs;
+    double                  packetLoss;         ///< 0.0 - 1.0
+    double                  batteryVoltage;     ///< 0.0 if the robot isn't reporting it
+    double                  cpu;                ///< roboRIO CPU 0.0 - 1.0
+    double                  canUtilization;     ///< 0.0 - 1.0
+    double                  wifiDb;
+    double                  bandwidthMb;
+
+    bool                    brownout;
+    bool                    watchdog;
+    bool                    dsTeleop;
+    bool                    dsAuto;
+    bool                    dsDisabled;
+    bool                    robotTeleop;
+    bool                    robotAuto;
+    bool                    robotDisabled;
+
+    int                     pdCanId;            ///< -1 if there is no power distribution data
+    int                     channelCount;       ///< number of valid entries in currents
+    std::array<double, 24>  currents;           ///< amps
+};
+
+
+class DsLogReader
+{
+    public:
+        /// @brief Power distribution type ids used in version 4 logs
+        static constexpr uint8_t PD_TYPE_CTRE = 25;
+        static constexpr uint8_t PD_TYPE_REV  = 33;
+
+        /// @brief seconds between the LabVIEW epoch (1/1/1904) and the unix epoch (1/1/1970)
+        static constexpr double LABVIEW_TO_UNIX_SECONDS = 2082844800.0;
+
+        /// @brief time between records
+        static constexpr double RECORD_PERIOD = 0.020;
+
+        DsLogReader() = default;
+        ~DsLogReader() = default;
+
+        /// @brief Open a .dslog file and read its header
+        /// @param [in] const std::string&: file name
+        /// @returns bool: true - ready to read records, false - see GetError
+        bool Open
+        (
+            const std::string&      fileName
+        );
+
+        /// @brief Read the next record
+        /// @param [out] DsLogRecord&: record
+        /// @returns bool: true - record was read, false - end of the file (or a partial record)
+        bool Next
+        (
+            DsLogRecord&            record
+        );
+
+        /// @returns int: log version (3 or 4)
+        int GetVersion() const { return m_version; }
+
+        /// @returns double: unix time (seconds) of the first record
+        double GetStartTime() const { return m_startTime; }
+
+        /// @returns const std::string&: why Open failed
+        const std::string& GetError() const { return m_error; }
+
+    private:
+        /// @brief decode the CTRE PDP currents (16 channels)
+        static void ReadCtrePdp
+        (
+            const uint8_t*          data,
+            DsLogRecord&            record
+        );
+
+        /// @brief decode the REV PDH currents (24 channels)
+        static void ReadRevPdh
+        (
+            const uint8_t*          data,
+            DsLogRecord&            record
+        );
+
+        std::ifstream           m_file;
+        int                     m_version = 0;
+        double                  m_startTime = 0.0;
+        uint64_t                m_count = 0;
+        std::string             m_error;
+};
@@ -0,0 +1,221 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// DsLogTool.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Match health report for the Driver Station logs (C:\Users\Public\Documents\FRC\Log Files).
+///     The .dsevents file with the same name as the .dslog file is used if it exists.
+///
+///     Build (from this directory):
+///         g++ -std=c++17 -O2 -I. DsLogReader.cpp DsEventsReader.cpp DsLogAnalyzer.cpp DsLogTool.cpp -o dslog
+///
+///     Usage:
+///         dslog [options] <file.dslog> [file.dsevents]
+///             --csv <file>        also write every record to a CSV file
+///             --events            also list the events (without the stack frames that repeat errors)
+///             --low-voltage <V>   report windows below this voltage (default 7.0)
+///
+//========================================================================================================
+
+// C++ Includes
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Team 302 includes
+#include <DsEventsReader.h>
+#include <DsLogAnalyzer.h>
+#include <DsLogReader.h>
+
+using namespace std;
+
+namespace
+{
+    void Usage
+    (
+        const char*     program
+    )
+    {
+        cerr << "usage: " << program << " [--csv <file>] [--events] [--low-voltage <V>] <file.dslog> [file.dsevents]" << endl;
+    }
+
+    /// @brief write every record to a CSV file
+    bool WriteCsv
+    (
+        const string&   dslogFile,
+        const string&   csvFile
+    )
+    {
+        DsLogReader reader;
+        if (!reader.Open(dslogFile))
+        {
+            cerr << reader.GetError() << endl;
+            return false;
+        }
+        ofstream out(csvFile);
+        if (!out.is_open())
+        {
+            cerr << "couldn't create " << csvFile << endl;
+            return false;
+        }
+
+        out << "time (s),trip time (ms),packet loss (%),battery (V),CPU (%),CAN (%),wifi (dB),bandwidth (Mb/s),"
+               "brownout,watchdog,ds auton,ds teleop,ds disabled,robot auton,robot teleop,robot disabled";
+        for (auto channel=0; channel<24; ++channel)
+        {
+            out << ",channel " << channel << " (A)";
+        }
+        out << '\n';
+
+        DsLogRecord record;
+        char text[256];
+        while (reader.Next(record))
+        {
+            snprintf(text, sizeof(text), "%.2f,%.1f,%.0f,%.3f,%.1f,%.1f,%.1f,%.3f,%d,%d,%d,%d,%d,%d,%d,%d",
+                     record.time, record.tripTimeMs, record.packetLoss * 100.0, record.batteryVoltage,
+                     record.cpu * 100.0, record.canUtilization * 100.0, record.wifiDb, record.bandwidthMb,
+                     record.brownout, record.watchdog, record.dsAuto, record.dsTeleop, record.dsDisabled,
+                     record.robotAuto, record.robotTeleop, record.robotDisabled);
+            out << text;
+            for (auto channel=0; channel<24; ++channel)
+            {
+                if (channel < record.channelCount)
+                {
+                    snprintf(text, sizeof(text), ",%.3f", record.currents[channel]);
+                    out << text;
+                }
+                else
+                {
+                    out << ',';
+                }
+            }
+            out << '\n';
+        }
+        return true;
+    }
+}
+
+int main
+(
+    int     argc,
+    char**  argv
+)
+{
+    string dslogFile;
+    string dseventsFile;
+    string csvFile;
+    auto listEvents = false;
+    auto lowVoltage = 7.0;
+
+    for (auto inx=1; inx<argc; ++inx)
+    {
+        string arg(argv[inx]);
+        if (arg == "--csv" && inx+1 < argc)
+        {
+            csvFile = argv[++inx];
+        }
+        else if (arg == "--events")
+        {
+            listEvents = true;
+        }
+        else if (arg == "--low-voltage" && inx+1 < argc)
+        {
+            lowVoltage = atof(argv[++inx]);
+        }
+        else if (arg.rfind("--", 0) == 0)
+        {
+            Usage(argv[0]);
+            return 2;
+        }
+        else if (dslogFile.empty())
+        {
+            dslogFile = arg;
+        }
+        else if (dseventsFile.empty())
+        {
+            dseventsFile = arg;
+        }
+        else
+        {
+            Usage(argv[0]);
+            return 2;
+        }
+    }
+    if (dslogFile.empty())
+    {
+        Usage(argv[0]);
+        return 2;
+    }
+
+    if (dseventsFile.empty())
+    {
+        auto dot = dslogFile.rfind(".dslog");
+        if (dot != string::npos)
+        {
+            dseventsFile = dslogFile.substr(0, dot) + ".dsevents";
+            if (!ifstream(dseventsFile).good())
+            {
+                dseventsFile.clear();
+            }
+        }
+    }
+
+    DsLogAnalyzer analyzer(lowVoltage);
+    if (!analyzer.Analyze(dslogFile, dseventsFile))
+    {
+        cerr << analyzer.GetError() << endl;
+        return 1;
+    }
+
+    cout << dslogFile;
+    if (!dseventsFile.empty())
+    {
+        cout << "  +  " << dseventsFile;
+    }
+    cout << '\n';
+    analyzer.Report(cout);
+
+    if (listEvents)
+    {
+        cout << "\nevent list:\n";
+        char prefix[64];
+        for (auto& event : analyzer.GetEvents())
+        {
+            if (event.type == DsEvent::EVENT_TYPE::ERROR_ECHO)
+            {
+                continue;
+            }
+            snprintf(prefix, sizeof(prefix), "%8.2f  %-16s ", event.time, DsEventsReader::GetTypeName(event.type));
+            cout << prefix << event.text;
+            if (!event.location.empty())
+            {
+                cout << "  [" << event.location << ']';
+            }
+            cout << '\n';
+        }
+    }
+
+    if (!csvFile.empty() && !WriteCsv(dslogFile, csvFile))
+    {
+        return 1;
+    }
+    return 0;
+}
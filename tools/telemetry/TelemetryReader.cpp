@@ -0,0 +1,165 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// TelemetryReader.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Desktop reader for the telemetry files written on the robot by TelemetryRecorder
+///
+//========================================================================================================
+
+// C++ Includes
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Team 302 includes
+#include <TelemetryReader.h>
+#include <utils/TelemetryFormat.h>
+
+using namespace std;
+
+namespace
+{
+    /// @brief read a little endian value (the robot and desktop PCs are both little endian)
+    template<typename T>
+    bool ReadValue
+    (
+        ifstream&   file,
+        T&          value
+    )
+    {
+        return static_cast<bool>(file.read(reinterpret_cast<char*>(&value), sizeof(value)));
+    }
+}
+
+/// @brief Read a whole telemetry file.  A partial block at the end of the file is ignored.
+/// @param [in] const std::string&: file name
+/// @returns bool: true - file was read, false - see GetError
+bool TelemetryReader::Read
+(
+    const string&       fileName
+)
+{
+    m_timestamps.clear();
+    m_signals.clear();
+    m_blocks = 0;
+    m_truncated = false;
+    m_error.clear();
+
+    ifstream file(fileName, ios::in | ios::binary);
+    if (!file.is_open())
+    {
+        m_error = "couldn't open " + fileName;
+        return false;
+    }
+
+    // header
+    char magic[sizeof(TelemetryFormat::FILE_MAGIC)];
+    uint16_t version = 0;
+    uint16_t count = 0;
+    if (!file.read(magic, sizeof(magic)) || memcmp(magic, TelemetryFormat::FILE_MAGIC, sizeof(magic)) != 0)
+    {
+        m_error = fileName + " is not a telemetry file";
+        return false;
+    }
+    if (!ReadValue(file, version) || version != TelemetryFormat::VERSION)
+    {
+        m_error = "unsupported telemetry version " + to_string(version);
+        return false;
+    }
+    if (!ReadValue(file, count))
+    {
+        m_error = "header is truncated";
+        return false;
+    }
+
+    m_signals.resize(count);
+    for (auto& signal : m_signals)
+    {
+        uint8_t type = 0;
+        uint16_t length = 0;
+        if (!ReadValue(file, type) || !ReadValue(file, length))
+        {
+            m_error = "header is truncated";
+            return false;
+        }
+        signal.type = static_cast<TelemetryFormat::SIGNAL_TYPE>(type);
+        signal.name.resize(length);
+        if (length > 0 && !file.read(signal.name.data(), length))
+        {
+            m_error = "header is truncated";
+            return false;
+        }
+    }
+
+    // blocks:  read each one completely before adding it, so a partial block is dropped
+    vector<uint64_t> timestamps;
+    vector<double> values;
+    while (true)
+    {
+        uint32_t blockMagic = 0;
+        uint32_t rows = 0;
+        if (!ReadValue(file, blockMagic))
+        {
+            break;              // normal end of the file
+        }
+        if (blockMagic != TelemetryFormat::BLOCK_MAGIC || !ReadValue(file, rows))
+        {
+            m_truncated = true;
+            break;
+        }
+
+        timestamps.resize(rows);
+        values.resize(static_cast<size_t>(rows) * count);
+        if (!file.read(reinterpret_cast<char*>(timestamps.data()), rows * sizeof(uint64_t)) ||
+            !file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(double)))
+        {
+            m_truncated = true;
+            break;
+        }
+
+        m_timestamps.insert(m_timestamps.end(), timestamps.begin(), timestamps.end());
+        for (auto inx=0U; inx<m_signals.size(); ++inx)
+        {
+            auto column = values.begin() + static_cast<ptrdiff_t>(inx) * rows;
+            m_signals[inx].values.insert(m_signals[inx].values.end(), column, column + rows);
+        }
+        ++m_blocks;
+    }
+    return true;
+}
+
+/// @brief Find a signal by name
+/// @param [in] const std::string&: signal name
+/// @returns int: index into GetSignals or -1 if it wasn't recorded
+int TelemetryReader::FindSignal
+(
+    const string&       name
+) const
+{
+    for (auto inx=0U; inx<m_signals.size(); ++inx)
+    {
+        if (m_signals[inx].name == name)
+        {
+            return static_cast<int>(inx);
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,91 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// TelemetryReader.h
+//========================================================================================================
+///
+/// File Description:
+///     Desktop reader for the telemetry files written on the robot by TelemetryRecorder
+///     (format is described in src/main/cpp/utils/TelemetryFormat.h).
+///
+//========================================================================================================
+
+#pragma once
+
+// C++ Includes
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Team 302 includes
+#include <utils/TelemetryFormat.h>
+
+
+class TelemetryReader
+{
+    public:
+
+        /// @struct Signal
+        /// @brief  a recorded signal and all of its values (one per timestamp)
+        struct Signal
+        {
+            std::string                     name;
+            TelemetryFormat::SIGNAL_TYPE    type;
+            std::vector<double>             values;
+        };
+
+        TelemetryReader() = default;
+        ~TelemetryReader() = default;
+
+        /// @brief Read a whole telemetry file.  A partial block at the end of the file is ignored.
+        /// @param [in] const std::string&: file name
+        /// @returns bool: true - file was read, false - see GetError
+        bool Read
+        (
+            const std::string&      fileName
+        );
+
+        /// @brief Find a signal by name
+        /// @param [in] const std::string&: signal name
+        /// @returns int: index into GetSignals or -1 if it wasn't recorded
+        int FindSignal
+        (
+            const std::string&      name
+        ) const;
+
+        /// @returns const std::vector<uint64_t>&: FPGA time (microseconds) of each row
+        const std::vector<uint64_t>& GetTimestamps() const { return m_timestamps; }
+
+        /// @returns const std::vector<Signal>&: recorded signals
+        const std::vector<Signal>& GetSignals() const { return m_signals; }
+
+        /// @returns uint32_t: number of complete blocks that were read
+        uint32_t GetBlockCount() const { return m_blocks; }
+
+        /// @returns bool: true - the file ended in the middle of a block
+        bool IsTruncated() const { return m_truncated; }
+
+        /// @returns const std::string&: why Read failed
+        const std::string& GetError() const { return m_error; }
+
+    private:
+        std::vector<uint64_t>   m_timestamps;
+        std::vector<Signal>     m_signals;
+        uint32_t                m_blocks = 0;
+        bool                    m_truncated = false;
+        std::string             m_error;
+};
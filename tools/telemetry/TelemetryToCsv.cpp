@@ -0,0 +1,136 @@
+
+//====================================================================================================================================================
+// Copyright 2022 Lake Orion Robotics FIRST Team 302
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"),
+// to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense,
+// and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+//
+// The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF
+// MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+// DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE
+// OR OTHER DEALINGS IN THE SOFTWARE.
+//====================================================================================================================================================
+
+//========================================================================================================
+/// TelemetryToCsv.cpp
+//========================================================================================================
+///
+/// File Description:
+///     Converts a telemetry file copied off of the robot (USB stick or /home/lvuser/logs) to CSV.
+///     The first column is the time in seconds since the first row, followed by one column per signal.
+///
+///     Build (from this directory):
+///         g++ -std=c++17 -O2 -I. -I../../src/main/cpp TelemetryReader.cpp TelemetryToCsv.cpp -o telemetry2csv
+///
+///     Usage:
+///         telemetry2csv <telemetry file> [csv file]      (writes to the console if there isn't a csv file)
+///
+//========================================================================================================
+
+// C++ Includes
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <string>
+
+// Team 302 includes
+#include <TelemetryReader.h>
+#include <utils/TelemetryFormat.h>
+
+using namespace std;
+
+namespace
+{
+    /// @brief quote a CSV field if it has a comma or a quote in it
+    string CsvField
+    (
+        const string&   text
+    )
+    {
+        if (text.find_first_of(",\"") == string::npos)
+        {
+            return text;
+        }
+        string quoted("\"");
+        for (auto ch : text)
+        {
+            quoted += ch;
+            if (ch == '"')
+            {
+                quoted += '"';
+            }
+        }
+        quoted += '"';
+        return quoted;
+    }
+}
+
+int main
+(
+    int     argc,
+    char**  argv
+)
+{
+    if (argc < 2 || argc > 3)
+    {
+        cerr << "usage: " << argv[0] << " <telemetry file> [csv file]" << endl;
+        return 2;
+    }
+
+    TelemetryReader reader;
+    if (!reader.Read(argv[1]))
+    {
+        cerr << reader.GetError() << endl;
+        return 1;
+    }
+    if (reader.IsTruncated())
+    {
+        cerr << "warning: " << argv[1] << " ends with a partial block; it was skipped" << endl;
+    }
+
+    ofstream csvFile;
+    if (argc == 3)
+    {
+        csvFile.open(argv[2]);
+        if (!csvFile.is_open())
+        {
+            cerr << "couldn't create " << argv[2] << endl;
+            return 1;
+        }
+    }
+    ostream& out = argc == 3 ? csvFile : cout;
+
+    auto& signals = reader.GetSignals();
+    out << "time (s)";
+    for (auto& signal : signals)
+    {
+        out << ',' << CsvField(signal.name);
+    }
+    out << '\n';
+
+    auto& timestamps = reader.GetTimestamps();
+    char text[64];
+    for (auto row=0U; row<timestamps.size(); ++row)
+    {
+        snprintf(text, sizeof(text), "%.6f", static_cast<double>(timestamps[row] - timestamps[0]) / 1000000.0);
+        out << text;
+        for (auto& signal : signals)
+        {
+            auto value = signal.values[row];
+            if (signal.type == TelemetryFormat::SIGNAL_TYPE::DOUBLE)
+            {
+                snprintf(text, sizeof(text), ",%.9g", value);
+            }
+            else
+            {
+                snprintf(text, sizeof(text), ",%lld", static_cast<long long>(value));
+            }
+            out << text;
+        }
+        out << '\n';
+    }
+    return 0;
+}